@@ -0,0 +1,23 @@
+#include "alloc.h"
+
+static void *st_allocator_libc_malloc(size_t size, void *ctx)
+{
+    return malloc(size);
+}
+
+static void *st_allocator_libc_realloc(void *ptr, size_t size, void *ctx)
+{
+    return realloc(ptr, size);
+}
+
+static void st_allocator_libc_free(void *ptr, void *ctx)
+{
+    free(ptr);
+}
+
+const st_allocator_t st_allocator_libc = {
+    &st_allocator_libc_malloc,
+    &st_allocator_libc_realloc,
+    &st_allocator_libc_free,
+    NULL,
+};
@@ -0,0 +1,44 @@
+#ifndef alloc_h
+#define alloc_h
+
+#include <stdlib.h>
+
+// Allocator hooks, called with the context they were set up with. They
+// behave like the libc functions: realloc of NULL allocates, and memory from
+// one allocator is only ever resized and freed by the same one. free is
+// never called with NULL.
+typedef struct {
+    void *(*malloc)(size_t size, void *ctx);
+    void *(*realloc)(void *ptr, size_t size, void *ctx);
+    void (*free)(void *ptr, void *ctx);
+    void *ctx;                      // Context passed to the hooks
+} st_allocator_t;
+
+// The libc allocator, used wherever NULL is passed for an allocator
+extern const st_allocator_t st_allocator_libc;
+
+// The allocator to use for a possibly NULL allocator
+static inline const st_allocator_t *st_allocator(
+        const st_allocator_t *allocator)
+{
+    return allocator != NULL ? allocator : &st_allocator_libc;
+}
+
+static inline void *st_malloc(const st_allocator_t *a, size_t size)
+{
+    return a->malloc(size, a->ctx);
+}
+
+static inline void *st_realloc(const st_allocator_t *a, void *ptr,
+        size_t size)
+{
+    return a->realloc(ptr, size, a->ctx);
+}
+
+static inline void st_free(const st_allocator_t *a, void *ptr)
+{
+    if (ptr != NULL)
+        a->free(ptr, a->ctx);
+}
+
+#endif
@@ -0,0 +1,174 @@
+#include "arena.h"
+
+#include <string.h>
+
+// Alignment of all allocations
+#define ST_ARENA_ALIGN (2 * sizeof(void *))
+
+typedef struct st_arena_block st_arena_block_t;
+
+struct st_arena_block {
+    st_arena_block_t *next;         // Next block in the arena
+    size_t size;                    // Number of bytes in the block
+    size_t used;                    // Number of bytes in use
+    uint8_t *data;                  // The memory of the block
+};
+
+struct st_arena {
+    st_arena_block_t *head;         // First block
+    st_arena_block_t *current;      // Block allocations are made from
+    size_t block_size;              // Default size of new blocks
+    st_allocator_t allocator;       // Allocator of the blocks
+};
+
+// Initialize a new arena
+st_status st_arena_init(st_arena_t **arena, size_t block_size,
+        const st_allocator_t *allocator)
+{
+    allocator = st_allocator(allocator);
+
+    *arena = st_malloc(allocator, sizeof(**arena));
+    if (*arena == NULL)
+        return st_out_of_memory;
+
+    // Blocks are allocated on first use, so an arena that is never used
+    // costs nothing
+    (*arena)->head = NULL;
+    (*arena)->current = NULL;
+    (*arena)->block_size = block_size;
+    (*arena)->allocator = *allocator;
+
+    return st_ok;
+}
+
+// Free the arena and all memory allocated from it
+void st_arena_free(st_arena_t *arena)
+{
+    if (arena == NULL)
+        return;
+
+    st_arena_block_t *block = arena->head;
+    while (block != NULL) {
+        st_arena_block_t *next = block->next;
+        st_free(&arena->allocator, block);
+        block = next;
+    }
+
+    st_free(&arena->allocator, arena);
+}
+
+// Allocate a new block with room for at least size bytes and link it in after
+// the current block
+static st_status st_arena_add_block(st_arena_t *arena, size_t size)
+{
+    if (size < arena->block_size)
+        size = arena->block_size;
+
+    st_arena_block_t *block = st_malloc(&arena->allocator,
+            sizeof(*block) + size);
+    if (block == NULL)
+        return st_out_of_memory;
+
+    block->data = ((uint8_t *)block) + sizeof(*block);
+    block->size = size;
+    block->used = 0;
+
+    if (arena->current == NULL) {
+        block->next = arena->head;
+        arena->head = block;
+    } else {
+        block->next = arena->current->next;
+        arena->current->next = block;
+    }
+
+    arena->current = block;
+
+    return st_ok;
+}
+
+// Allocate memory from the arena
+st_status st_arena_alloc(st_arena_t *arena, size_t size, void **ptr)
+{
+    st_arena_block_t *block = arena->current;
+    size_t offset = 0;
+
+    if (block != NULL) {
+        offset = (block->used + ST_ARENA_ALIGN - 1) & ~(ST_ARENA_ALIGN - 1);
+    }
+
+    if (block == NULL || offset + size > block->size) {
+        // Move on to a block kept from before the last reset that is large
+        // enough, otherwise add a new one. A block that is found further
+        // along is moved up, so that a reused arena stops allocating once it
+        // has seen its largest sizes.
+        st_arena_block_t **link = block == NULL ? &arena->head : &block->next;
+        st_arena_block_t **found = link;
+
+        while (*found != NULL && (*found)->size < size)
+            found = &(*found)->next;
+
+        if (*found != NULL) {
+            st_arena_block_t *next = *found;
+
+            *found = next->next;
+            next->next = *link;
+            *link = next;
+
+            next->used = 0;
+            arena->current = next;
+        } else {
+            st_status rc = st_arena_add_block(arena, size);
+            if (rc != st_ok)
+                return rc;
+        }
+
+        block = arena->current;
+        offset = 0;
+    }
+
+    *ptr = block->data + offset;
+    block->used = offset + size;
+
+    return st_ok;
+}
+
+// Grow an allocation
+st_status st_arena_grow(st_arena_t *arena, void **ptr,
+        size_t old_size, size_t new_size)
+{
+    st_arena_block_t *block = arena->current;
+
+    // Grow the last allocation in place
+    if (*ptr != NULL && block != NULL &&
+            (uint8_t *)*ptr + old_size == block->data + block->used &&
+            (uint8_t *)*ptr + new_size <= block->data + block->size) {
+        block->used += new_size - old_size;
+        return st_ok;
+    }
+
+    void *tmp;
+    st_status rc = st_arena_alloc(arena, new_size, &tmp);
+    if (rc != st_ok)
+        return rc;
+
+    if (old_size > 0)
+        memcpy(tmp, *ptr, old_size);
+
+    *ptr = tmp;
+
+    return st_ok;
+}
+
+const st_allocator_t *st_arena_allocator(st_arena_t *arena)
+{
+    return &arena->allocator;
+}
+
+// Release everything allocated from the arena
+void st_arena_reset(st_arena_t *arena)
+{
+    arena->current = arena->head;
+
+    if (arena->head != NULL)
+        arena->head->used = 0;
+}
@@ -0,0 +1,36 @@
+#ifndef arena_h
+#define arena_h
+
+#include "styre.h"
+#include "alloc.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+
+typedef struct st_arena st_arena_t;
+
+// Initialize a new arena that allocates memory in blocks of block_size bytes
+// from allocator, or from libc when it is NULL
+st_status st_arena_init(st_arena_t **arena, size_t block_size,
+        const st_allocator_t *allocator);
+
+// Free the arena and all memory allocated from it
+void st_arena_free(st_arena_t *arena);
+
+// Allocate memory from the arena
+st_status st_arena_alloc(st_arena_t *arena, size_t size, void **ptr);
+
+// Grow an allocation from old_size to new_size bytes. The most recent
+// allocation is grown in place when there is room, otherwise the contents
+// are copied to a new allocation and *ptr is updated.
+st_status st_arena_grow(st_arena_t *arena, void **ptr,
+        size_t old_size, size_t new_size);
+
+// Get the allocator the blocks of the arena come from
+const st_allocator_t *st_arena_allocator(st_arena_t *arena);
+
+// Release everything allocated from the arena in constant time. The blocks
+// are kept and reused by later allocations.
+void st_arena_reset(st_arena_t *arena);
+
+#endif
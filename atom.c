@@ -0,0 +1,581 @@
+// Generated by tools/gen_atoms.py, do not edit
+#include "atom.h"
+
+#include <string.h>
+
+#define ST_ATOM_TABLE_BITS 10
+#define ST_ATOM_BUCKETS 256
+
+// All names, NUL-separated
+static const char st_atom_pool[] =
+    "a\0"
+    "abbr\0"
+    "acronym\0"
+    "address\0"
+    "applet\0"
+    "area\0"
+    "article\0"
+    "aside\0"
+    "audio\0"
+    "b\0"
+    "base\0"
+    "basefont\0"
+    "bdi\0"
+    "bdo\0"
+    "bgsound\0"
+    "big\0"
+    "blink\0"
+    "blockquote\0"
+    "body\0"
+    "br\0"
+    "button\0"
+    "canvas\0"
+    "caption\0"
+    "center\0"
+    "cite\0"
+    "code\0"
+    "col\0"
+    "colgroup\0"
+    "data\0"
+    "datalist\0"
+    "dd\0"
+    "del\0"
+    "details\0"
+    "dfn\0"
+    "dialog\0"
+    "dir\0"
+    "div\0"
+    "dl\0"
+    "dt\0"
+    "em\0"
+    "embed\0"
+    "fieldset\0"
+    "figcaption\0"
+    "figure\0"
+    "font\0"
+    "footer\0"
+    "form\0"
+    "frame\0"
+    "frameset\0"
+    "h1\0"
+    "h2\0"
+    "h3\0"
+    "h4\0"
+    "h5\0"
+    "h6\0"
+    "head\0"
+    "header\0"
+    "hgroup\0"
+    "hr\0"
+    "html\0"
+    "i\0"
+    "iframe\0"
+    "image\0"
+    "img\0"
+    "input\0"
+    "ins\0"
+    "isindex\0"
+    "kbd\0"
+    "keygen\0"
+    "label\0"
+    "legend\0"
+    "li\0"
+    "link\0"
+    "listing\0"
+    "main\0"
+    "map\0"
+    "mark\0"
+    "marquee\0"
+    "math\0"
+    "menu\0"
+    "menuitem\0"
+    "meta\0"
+    "meter\0"
+    "nav\0"
+    "nobr\0"
+    "noembed\0"
+    "noframes\0"
+    "noscript\0"
+    "object\0"
+    "ol\0"
+    "optgroup\0"
+    "option\0"
+    "output\0"
+    "p\0"
+    "param\0"
+    "picture\0"
+    "plaintext\0"
+    "pre\0"
+    "progress\0"
+    "q\0"
+    "rb\0"
+    "rp\0"
+    "rt\0"
+    "rtc\0"
+    "ruby\0"
+    "s\0"
+    "samp\0"
+    "script\0"
+    "search\0"
+    "section\0"
+    "select\0"
+    "slot\0"
+    "small\0"
+    "source\0"
+    "spacer\0"
+    "span\0"
+    "strike\0"
+    "strong\0"
+    "style\0"
+    "sub\0"
+    "summary\0"
+    "sup\0"
+    "svg\0"
+    "table\0"
+    "tbody\0"
+    "td\0"
+    "template\0"
+    "textarea\0"
+    "tfoot\0"
+    "th\0"
+    "thead\0"
+    "time\0"
+    "title\0"
+    "tr\0"
+    "track\0"
+    "tt\0"
+    "u\0"
+    "ul\0"
+    "var\0"
+    "video\0"
+    "wbr\0"
+    "xmp\0"
+    "accept\0"
+    "accept-charset\0"
+    "accesskey\0"
+    "action\0"
+    "align\0"
+    "allow\0"
+    "alt\0"
+    "aria-describedby\0"
+    "aria-expanded\0"
+    "aria-hidden\0"
+    "aria-label\0"
+    "aria-labelledby\0"
+    "async\0"
+    "autocomplete\0"
+    "autofocus\0"
+    "autoplay\0"
+    "background\0"
+    "bgcolor\0"
+    "border\0"
+    "charset\0"
+    "checked\0"
+    "class\0"
+    "color\0"
+    "cols\0"
+    "colspan\0"
+    "content\0"
+    "contenteditable\0"
+    "controls\0"
+    "coords\0"
+    "crossorigin\0"
+    "datetime\0"
+    "decoding\0"
+    "default\0"
+    "defer\0"
+    "dirname\0"
+    "disabled\0"
+    "download\0"
+    "draggable\0"
+    "enctype\0"
+    "enterkeyhint\0"
+    "face\0"
+    "for\0"
+    "formaction\0"
+    "formenctype\0"
+    "formmethod\0"
+    "formnovalidate\0"
+    "formtarget\0"
+    "headers\0"
+    "height\0"
+    "hidden\0"
+    "high\0"
+    "href\0"
+    "hreflang\0"
+    "http-equiv\0"
+    "id\0"
+    "integrity\0"
+    "inputmode\0"
+    "is\0"
+    "ismap\0"
+    "itemid\0"
+    "itemprop\0"
+    "itemref\0"
+    "itemscope\0"
+    "itemtype\0"
+    "kind\0"
+    "lang\0"
+    "language\0"
+    "list\0"
+    "loading\0"
+    "loop\0"
+    "low\0"
+    "max\0"
+    "maxlength\0"
+    "media\0"
+    "method\0"
+    "min\0"
+    "minlength\0"
+    "multiple\0"
+    "muted\0"
+    "name\0"
+    "nonce\0"
+    "novalidate\0"
+    "onblur\0"
+    "onchange\0"
+    "onclick\0"
+    "onerror\0"
+    "onfocus\0"
+    "oninput\0"
+    "onkeydown\0"
+    "onkeyup\0"
+    "onload\0"
+    "onmouseout\0"
+    "onmouseover\0"
+    "onsubmit\0"
+    "open\0"
+    "optimum\0"
+    "pattern\0"
+    "ping\0"
+    "placeholder\0"
+    "playsinline\0"
+    "poster\0"
+    "preload\0"
+    "property\0"
+    "readonly\0"
+    "referrerpolicy\0"
+    "rel\0"
+    "required\0"
+    "rev\0"
+    "reversed\0"
+    "role\0"
+    "rows\0"
+    "rowspan\0"
+    "sandbox\0"
+    "scope\0"
+    "selected\0"
+    "shape\0"
+    "size\0"
+    "sizes\0"
+    "spellcheck\0"
+    "src\0"
+    "srcdoc\0"
+    "srclang\0"
+    "srcset\0"
+    "start\0"
+    "step\0"
+    "tabindex\0"
+    "target\0"
+    "translate\0"
+    "type\0"
+    "usemap\0"
+    "valign\0"
+    "value\0"
+    "width\0"
+    "wrap\0"
+    "xmlns\0"
+    ;
+
+// Offset of each name in the pool, by atom
+static const uint16_t st_atom_offsets[st_atom_count] = {
+        0,     0,     2,     7,    15,    23,    30,    35,    43,    49,
+       55,    57,    62,    71,    75,    79,    87,    91,    97,   108,
+      113,   116,   123,   130,   138,   145,   150,   155,   159,   168,
+      173,   182,   185,   189,   197,   201,   208,   212,   216,   219,
+      222,   225,   231,   240,   251,   258,   263,   270,   275,   281,
+      290,   293,   296,   299,   302,   305,   308,   313,   320,   327,
+      330,   335,   337,   344,   350,   354,   360,   364,   372,   376,
+      383,   389,   396,   399,   404,   412,   417,   421,   426,   434,
+      439,   444,   453,   458,   464,   468,   473,   481,   490,   499,
+      506,   509,   518,   525,   532,   534,   540,   548,   558,   562,
+      571,   573,   576,   579,   582,   586,   591,   593,   598,   605,
+      612,   620,   627,   632,   638,   645,   652,   657,   664,   671,
+      677,   681,   689,   693,   697,   703,   709,   712,   721,   730,
+      736,   739,   745,   750,   756,   759,   765,   768,   770,   773,
+      777,   783,   787,   791,   798,   813,   823,   830,   836,   842,
+      846,   863,   877,   889,   900,   916,   922,   935,   945,   954,
+      965,   973,   980,   988,   996,  1002,  1008,  1013,  1021,  1029,
+     1045,  1054,  1061,  1073,  1082,  1091,  1099,  1105,  1113,  1122,
+     1131,  1141,  1149,  1162,  1167,  1171,  1182,  1194,  1205,  1220,
+     1231,  1239,  1246,  1253,  1258,  1263,  1272,  1283,  1286,  1296,
+     1306,  1309,  1315,  1322,  1331,  1339,  1349,  1358,  1363,  1368,
+     1377,  1382,  1390,  1395,  1399,  1403,  1413,  1419,  1426,  1430,
+     1440,  1449,  1455,  1460,  1466,  1477,  1484,  1493,  1501,  1509,
+     1517,  1525,  1535,  1543,  1550,  1561,  1573,  1582,  1587,  1595,
+     1603,  1608,  1620,  1632,  1639,  1647,  1656,  1665,  1680,  1684,
+     1693,  1697,  1706,  1711,  1716,  1724,  1732,  1738,  1747,  1753,
+     1758,  1764,  1775,  1779,  1786,  1794,  1801,  1807,  1812,  1821,
+     1828,  1838,  1843,  1850,  1857,  1863,  1869,  1874,
+};
+
+// Length of each name, by atom
+static const uint8_t st_atom_lengths[st_atom_count] = {
+      0,   1,   4,   7,   7,   6,   4,   7,   5,   5,   1,   4,
+      8,   3,   3,   7,   3,   5,  10,   4,   2,   6,   6,   7,
+      6,   4,   4,   3,   8,   4,   8,   2,   3,   7,   3,   6,
+      3,   3,   2,   2,   2,   5,   8,  10,   6,   4,   6,   4,
+      5,   8,   2,   2,   2,   2,   2,   2,   4,   6,   6,   2,
+      4,   1,   6,   5,   3,   5,   3,   7,   3,   6,   5,   6,
+      2,   4,   7,   4,   3,   4,   7,   4,   4,   8,   4,   5,
+      3,   4,   7,   8,   8,   6,   2,   8,   6,   6,   1,   5,
+      7,   9,   3,   8,   1,   2,   2,   2,   3,   4,   1,   4,
+      6,   6,   7,   6,   4,   5,   6,   6,   4,   6,   6,   5,
+      3,   7,   3,   3,   5,   5,   2,   8,   8,   5,   2,   5,
+      4,   5,   2,   5,   2,   1,   2,   3,   5,   3,   3,   6,
+     14,   9,   6,   5,   5,   3,  16,  13,  11,  10,  15,   5,
+     12,   9,   8,  10,   7,   6,   7,   7,   5,   5,   4,   7,
+      7,  15,   8,   6,  11,   8,   8,   7,   5,   7,   8,   8,
+      9,   7,  12,   4,   3,  10,  11,  10,  14,  10,   7,   6,
+      6,   4,   4,   8,  10,   2,   9,   9,   2,   5,   6,   8,
+      7,   9,   8,   4,   4,   8,   4,   7,   4,   3,   3,   9,
+      5,   6,   3,   9,   8,   5,   4,   5,  10,   6,   8,   7,
+      7,   7,   7,   9,   7,   6,  10,  11,   8,   4,   7,   7,
+      4,  11,  11,   6,   7,   8,   8,  14,   3,   8,   3,   8,
+      4,   4,   7,   7,   5,   8,   5,   4,   5,  10,   3,   6,
+      7,   6,   5,   4,   8,   6,   9,   4,   6,   6,   5,   5,
+      4,   5,
+};
+
+// Hash of each name, by atom
+static const uint32_t st_atom_hashes[st_atom_count] = {
+             0, 3826002220, 3593516222, 4105856554,  745154899,  590830993,
+    2601460036,  392652633, 3686849735, 3764468121, 3876335077, 1037866200,
+     823571557, 2041628174, 2075183412, 2998284661, 1405799865,  123827593,
+    3784120478, 3685382517, 1328268469, 1135768689, 2199331441, 4011007077,
+      93078660,   29650526, 4180765940, 4069381233,  150307336, 3631407781,
+    2312197729, 1562169397, 3478752842, 1499984805, 3478605747,  178778297,
+    3915559316, 3848448840, 1696390349, 1293727493, 1075471351,  672900686,
+    2496207869, 3073362581, 1638323465,  659427984,  290031026, 1079560007,
+    3523899814, 2141851358, 2419799442, 2403021823, 2386244204, 2369466585,
+    2352688966, 2335911347,  845761475, 3834172512, 2232610590, 1329254207,
+    3614812112, 3960223172, 3489695137, 3008443898, 2229740804, 4191711099,
+    2565440279, 1402801787, 2063899956, 2765827126, 4137097213,   34929764,
+    1077001542,  232457833, 3028748767, 3935363592, 3751997361, 3346719904,
+      44886091, 4001929615, 2581912890, 1909488017, 2180927320, 3311476706,
+     395242994, 2595364686, 4109336743, 2211684488, 1405741969, 3099987130,
+    1664365302, 3705274861, 3890322324, 2041138948, 4111221743, 1309554226,
+     825217929, 1776993568, 1249556454, 3406319174, 4094444124, 1599373397,
+    1297376255, 1230265779, 1070575216,  471128909, 4127999362, 3222025668,
+     540962730, 2150836393, 4242345164,  297952813, 1888831345, 2730816652,
+     466561496, 3926805205,  687964865,  632598351, 3307167098, 2888859350,
+    3696113941,  279201555, 3394116799, 3880226465, 1251777503, 2340213611,
+    1027948613, 1766500875, 3601512955, 3216274459, 1095059089, 2853211801,
+    1564253156, 2556802313, 1195724803, 2067622972, 1296390517, 4027333648,
+    1598240564, 2317739966, 3472427884,  635182538, 3597690986,  136609321,
+    3664010344, 2599313522, 3294899967, 1613521886, 2930878514,  455432284,
+    4005641867, 2291708750, 2498232767, 4210825463, 3974665941, 2717370895,
+    2136217965, 4130563834,  287169096, 1269553309, 3427432841,  525480503,
+    2010794635,  554782406, 2872970239, 1031692888, 3611606822, 3779457653,
+    2428421058, 2072117730, 4246785559, 3361328551, 2980068933, 3437915536,
+    3826787032, 2470140894,  436337467, 3437940111,  871591685,  822653945,
+    1679799348, 1788374867,  633389021,  292255708, 2901640080, 2387943645,
+     601714569, 1883882542, 1988118954,  825333354, 3596999145, 3585981250,
+    4128829753, 1037941245, 2594445528, 4125943108, 3186503078,  926444256,
+    1893017276, 2927854244, 1312329493, 2177355457,  331209851, 1541454343,
+    1334448775, 1931524034, 1229512022, 3641958979, 1894398805, 3119462523,
+     217798785, 1758234807, 3723446379, 1330735745, 3617776409, 1566971041,
+    4238008067, 2873489200, 3381609815, 3270049495,  328483777,  476878992,
+    2369371622, 4178082296,  501224756, 2544672201, 3416745768, 4065424616,
+    2011273686,  532808616, 1210720820, 2559365499,  324669626, 2705178636,
+    1347429181,  294019289, 3778676136, 3546203337,  738244450, 2268922153,
+     375255177, 2097883034, 1840077901, 2342418716, 1930668294, 3602055880,
+    3456888823, 1600014360, 1223986548, 2223801888,  854878930, 3533348019,
+     268382745,  708293528, 1675575855, 3659520292, 3190485995, 1309284212,
+    2646858022,  597743964, 1161159933, 2652390747, 3543982537, 2764273937,
+    1927343745,  795906719, 1697318111, 3343129103, 2041888296,  845187144,
+    2903429077, 1361572173, 1297068826, 1520291810, 1113510858, 2508680735,
+    2145121445, 2376145825,
+};
+
+// Displacement of each bucket
+static const uint16_t st_atom_displacements[ST_ATOM_BUCKETS] = {
+        0,     0,     0,     0,     1,     0,     0,     0,     1,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     1,     0,     0,     0,     0,
+        2,     0,     2,     0,     0,     0,     1,     0,     2,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     1,     2,     0,     0,     1,     0,
+        0,     0,     0,     1,     0,     0,     0,     0,     0,     1,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        1,     1,     0,     0,     0,     0,     0,     1,     1,     0,
+        0,     0,     1,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     2,     0,     0,     1,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     1,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     2,     0,     0,     0,     0,     1,     0,     1,     0,
+        1,     0,     0,     0,     0,     0,     1,     0,     0,     0,
+        0,     0,     0,     0,     1,     1,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     1,     0,     0,
+        0,     0,     0,     1,     0,     0,     0,     0,     2,     0,
+        0,     0,     2,     0,     0,     2,     0,     1,     0,     0,
+        0,     0,     1,     0,     0,     0,     1,     1,     0,     0,
+        0,     1,     0,     0,     0,     0,
+};
+
+// The atom in each slot of the table
+static const uint16_t st_atom_slots[1 << ST_ATOM_TABLE_BITS] = {
+        0,   115,     0,     0,     0,   133,   107,     0,     0,     0,
+      239,     0,   229,     0,   127,     0,   238,     0,    43,     0,
+        0,     0,     0,     0,   156,   121,     0,   247,    13,   157,
+        0,   114,     0,     5,     0,     0,   119,     0,     0,   131,
+        0,     0,   232,     0,     0,     0,     0,   173,     0,     0,
+        0,   116,     0,     0,     0,    64,   171,     0,    29,     0,
+        0,     0,     0,   140,     0,     0,     0,     0,   275,   235,
+        0,     0,     0,     0,    62,     0,     0,     0,    34,     0,
+        0,     0,     0,     0,   225,     0,   192,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,    53,   243,     0,   158,
+        0,    46,     0,     0,     0,     0,     0,    80,     0,     0,
+        0,     0,     0,   145,     0,   130,    21,     0,     0,     0,
+        0,     0,     0,     0,   126,     0,     0,     0,     0,     0,
+        0,     0,    67,   186,     0,     0,   195,     0,     0,     0,
+        0,     0,     0,    11,   168,     0,     0,     0,   134,     0,
+        0,     0,   274,     0,     0,     0,     0,     0,   250,     0,
+      144,     0,   124,     0,   111,     0,   242,   154,     0,     0,
+        0,     0,     0,     0,     0,   161,     0,     0,     0,   254,
+        0,     0,     0,   218,     0,     0,   106,     0,     0,   141,
+      222,     0,    82,     0,     0,     0,     0,     0,   187,     0,
+        0,   260,     0,     0,     0,     0,     0,   159,   270,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+      151,     0,     0,     0,    10,     0,     0,     0,     0,   193,
+        4,     0,    69,     0,   196,   122,   244,     0,     0,     0,
+        0,     0,   258,     0,   182,   149,     0,    20,     0,   248,
+        0,   152,     0,     0,   108,    88,     0,     0,     0,     0,
+        0,     0,     0,     0,   169,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,    22,   146,    35,   142,     0,
+        0,     0,   150,     0,     0,     0,     0,    51,   113,     0,
+      128,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,   224,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     1,     0,
+        0,     0,     0,     6,     0,     0,     0,     0,     0,     0,
+        3,     0,     0,     0,    15,     0,     0,     0,   230,     0,
+      209,    18,   226,    73,     0,    93,     0,     0,   272,     0,
+        0,     0,   147,     0,     0,     0,     0,     0,   262,    92,
+        0,     0,     0,     0,   256,    68,     0,     0,     0,     0,
+        0,     0,     0,    50,     0,     0,   100,     0,     0,     0,
+      103,   184,    54,     0,     0,     0,    36,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,    63,   246,     0,
+      267,    79,     0,     0,     0,     0,    89,     0,   112,     0,
+        0,   208,     0,   233,     0,     0,     0,     0,     0,   266,
+        0,     0,     0,   259,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,   135,     0,    59,    99,     0,
+        0,     0,     0,     0,   199,     0,    32,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,    41,
+      257,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,   101,    94,   167,     0,   219,     0,   143,     0,     0,
+        0,     0,    47,     0,   210,     0,     0,    95,     0,     0,
+        0,     0,     0,   129,     0,     0,     0,     0,     0,     0,
+        0,   180,   198,     0,     0,   178,     0,     0,     0,     0,
+        0,     0,     0,   253,   220,     0,     0,   170,     0,   227,
+        0,     0,   164,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,   162,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,   136,    84,     0,     0,     0,    30,    45,
+        0,     0,     0,     0,    81,     0,     0,     0,     0,     0,
+      194,   163,     0,     0,     0,     0,   204,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,   200,     0,     0,   174,
+       42,    58,     0,     0,     0,   277,     0,     0,     0,     0,
+        0,    78,     0,    97,   251,     0,     0,     0,   177,    27,
+      189,     0,   213,   109,     0,     0,     0,     0,   269,    40,
+        0,     0,     0,   276,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,    71,     0,     0,     0,    23,     0,     0,   179,
+      221,     0,     0,    17,     0,     0,     0,     0,     0,     0,
+       38,   249,     0,     0,     0,   138,     0,    55,   215,     0,
+        0,     0,     0,     8,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,   211,   185,     0,     0,   205,     0,   176,
+        0,     0,     0,     0,    66,     0,   120,     0,     0,     0,
+        0,    98,   110,     0,     0,     0,     0,     0,     0,     0,
+       44,    19,     0,   190,     0,     9,     0,    26,     0,    75,
+      125,     0,     0,     0,   273,     0,     0,     0,    24,     0,
+        0,     0,     0,   166,   172,     0,     0,     0,   117,   245,
+      203,     0,     0,     0,     0,     0,     0,   201,     0,   231,
+        0,    74,     0,   139,     0,    60,   137,   132,    39,     0,
+        0,    65,     0,     0,     0,    37,     0,     0,   191,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,   160,
+      197,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,   237,    52,     0,     0,    33,     0,
+        0,     0,     0,   183,     0,     0,     0,     0,    91,    76,
+        0,     0,     0,   264,    83,     0,    31,     0,     0,    48,
+        0,     0,     0,    14,     0,     0,     0,     0,     0,     0,
+      118,   255,     0,     0,     0,   265,     0,     0,    90,    72,
+        0,     0,     0,     0,     0,     0,     0,    28,     0,     0,
+        0,     0,    49,     0,     0,     0,     0,     0,     0,   165,
+        0,     0,     0,     0,    56,    70,    57,     0,     0,     0,
+      223,     0,    87,    96,     0,   228,     0,     0,    86,     0,
+      206,     0,     0,     0,   217,     0,     0,     0,     0,   148,
+      153,     0,   155,   271,     0,   175,     0,     0,   241,     0,
+      252,     0,     7,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,    61,     0,    12,    16,     0,     0,
+      181,     0,     0,     0,    25,     0,     0,     0,     0,    85,
+        0,   240,     0,     0,     0,     0,     0,    77,   207,   188,
+        0,     0,     0,   268,   261,     0,   123,     0,   202,     0,
+        0,     0,     0,   104,   212,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,   214,   216,     0,     0,
+        0,     0,     0,     0,   102,     0,     2,   105,     0,   234,
+      236,   263,     0,     0,
+};
+
+st_atom_t st_atom_lookup_hash(uint32_t hash, const uint8_t *name, size_t len)
+{
+    uint32_t disp = st_atom_displacements[hash & (ST_ATOM_BUCKETS - 1)];
+    uint32_t slot = ((hash >> 8) ^ disp) * 2654435761u;
+
+    st_atom_t atom = st_atom_slots[slot >> (32 - ST_ATOM_TABLE_BITS)];
+
+    // The slot holds the only name that can have this hash, check that it is
+    // the one we are looking for
+    if (atom == st_atom_unknown || st_atom_lengths[atom] != len ||
+            memcmp(st_atom_pool + st_atom_offsets[atom], name, len) != 0)
+        return st_atom_unknown;
+
+    return atom;
+}
+
+st_atom_t st_atom_lookup(const uint8_t *name, size_t len)
+{
+    uint32_t hash = ST_ATOM_HASH_INIT;
+
+    for (size_t i = 0; i < len; i++)
+        hash = ST_ATOM_HASH_UPDATE(hash, name[i]);
+
+    return st_atom_lookup_hash(hash, name, len);
+}
+
+const char *st_atom_to_string(st_atom_t atom, size_t *len)
+{
+    if (atom <= st_atom_unknown || atom >= st_atom_count)
+        return NULL;
+
+    if (len != NULL)
+        *len = st_atom_lengths[atom];
+
+    return st_atom_pool + st_atom_offsets[atom];
+}
+
+uint32_t st_atom_hash(st_atom_t atom)
+{
+    if (atom <= st_atom_unknown || atom >= st_atom_count)
+        return ST_ATOM_HASH_INIT;
+
+    return st_atom_hashes[atom];
+}
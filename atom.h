@@ -0,0 +1,309 @@
+// Generated by tools/gen_atoms.py, do not edit
+#ifndef atom_h
+#define atom_h
+
+#include <stdlib.h>
+#include <stdint.h>
+
+// Interned names. Names without an atom are st_atom_unknown.
+typedef enum {
+    st_atom_unknown = 0,
+    st_atom_a,
+    st_atom_abbr,
+    st_atom_acronym,
+    st_atom_address,
+    st_atom_applet,
+    st_atom_area,
+    st_atom_article,
+    st_atom_aside,
+    st_atom_audio,
+    st_atom_b,
+    st_atom_base,
+    st_atom_basefont,
+    st_atom_bdi,
+    st_atom_bdo,
+    st_atom_bgsound,
+    st_atom_big,
+    st_atom_blink,
+    st_atom_blockquote,
+    st_atom_body,
+    st_atom_br,
+    st_atom_button,
+    st_atom_canvas,
+    st_atom_caption,
+    st_atom_center,
+    st_atom_cite,
+    st_atom_code,
+    st_atom_col,
+    st_atom_colgroup,
+    st_atom_data,
+    st_atom_datalist,
+    st_atom_dd,
+    st_atom_del,
+    st_atom_details,
+    st_atom_dfn,
+    st_atom_dialog,
+    st_atom_dir,
+    st_atom_div,
+    st_atom_dl,
+    st_atom_dt,
+    st_atom_em,
+    st_atom_embed,
+    st_atom_fieldset,
+    st_atom_figcaption,
+    st_atom_figure,
+    st_atom_font,
+    st_atom_footer,
+    st_atom_form,
+    st_atom_frame,
+    st_atom_frameset,
+    st_atom_h1,
+    st_atom_h2,
+    st_atom_h3,
+    st_atom_h4,
+    st_atom_h5,
+    st_atom_h6,
+    st_atom_head,
+    st_atom_header,
+    st_atom_hgroup,
+    st_atom_hr,
+    st_atom_html,
+    st_atom_i,
+    st_atom_iframe,
+    st_atom_image,
+    st_atom_img,
+    st_atom_input,
+    st_atom_ins,
+    st_atom_isindex,
+    st_atom_kbd,
+    st_atom_keygen,
+    st_atom_label,
+    st_atom_legend,
+    st_atom_li,
+    st_atom_link,
+    st_atom_listing,
+    st_atom_main,
+    st_atom_map,
+    st_atom_mark,
+    st_atom_marquee,
+    st_atom_math,
+    st_atom_menu,
+    st_atom_menuitem,
+    st_atom_meta,
+    st_atom_meter,
+    st_atom_nav,
+    st_atom_nobr,
+    st_atom_noembed,
+    st_atom_noframes,
+    st_atom_noscript,
+    st_atom_object,
+    st_atom_ol,
+    st_atom_optgroup,
+    st_atom_option,
+    st_atom_output,
+    st_atom_p,
+    st_atom_param,
+    st_atom_picture,
+    st_atom_plaintext,
+    st_atom_pre,
+    st_atom_progress,
+    st_atom_q,
+    st_atom_rb,
+    st_atom_rp,
+    st_atom_rt,
+    st_atom_rtc,
+    st_atom_ruby,
+    st_atom_s,
+    st_atom_samp,
+    st_atom_script,
+    st_atom_search,
+    st_atom_section,
+    st_atom_select,
+    st_atom_slot,
+    st_atom_small,
+    st_atom_source,
+    st_atom_spacer,
+    st_atom_span,
+    st_atom_strike,
+    st_atom_strong,
+    st_atom_style,
+    st_atom_sub,
+    st_atom_summary,
+    st_atom_sup,
+    st_atom_svg,
+    st_atom_table,
+    st_atom_tbody,
+    st_atom_td,
+    st_atom_template,
+    st_atom_textarea,
+    st_atom_tfoot,
+    st_atom_th,
+    st_atom_thead,
+    st_atom_time,
+    st_atom_title,
+    st_atom_tr,
+    st_atom_track,
+    st_atom_tt,
+    st_atom_u,
+    st_atom_ul,
+    st_atom_var,
+    st_atom_video,
+    st_atom_wbr,
+    st_atom_xmp,
+    st_atom_accept,
+    st_atom_accept_charset,
+    st_atom_accesskey,
+    st_atom_action,
+    st_atom_align,
+    st_atom_allow,
+    st_atom_alt,
+    st_atom_aria_describedby,
+    st_atom_aria_expanded,
+    st_atom_aria_hidden,
+    st_atom_aria_label,
+    st_atom_aria_labelledby,
+    st_atom_async,
+    st_atom_autocomplete,
+    st_atom_autofocus,
+    st_atom_autoplay,
+    st_atom_background,
+    st_atom_bgcolor,
+    st_atom_border,
+    st_atom_charset,
+    st_atom_checked,
+    st_atom_class,
+    st_atom_color,
+    st_atom_cols,
+    st_atom_colspan,
+    st_atom_content,
+    st_atom_contenteditable,
+    st_atom_controls,
+    st_atom_coords,
+    st_atom_crossorigin,
+    st_atom_datetime,
+    st_atom_decoding,
+    st_atom_default,
+    st_atom_defer,
+    st_atom_dirname,
+    st_atom_disabled,
+    st_atom_download,
+    st_atom_draggable,
+    st_atom_enctype,
+    st_atom_enterkeyhint,
+    st_atom_face,
+    st_atom_for,
+    st_atom_formaction,
+    st_atom_formenctype,
+    st_atom_formmethod,
+    st_atom_formnovalidate,
+    st_atom_formtarget,
+    st_atom_headers,
+    st_atom_height,
+    st_atom_hidden,
+    st_atom_high,
+    st_atom_href,
+    st_atom_hreflang,
+    st_atom_http_equiv,
+    st_atom_id,
+    st_atom_integrity,
+    st_atom_inputmode,
+    st_atom_is,
+    st_atom_ismap,
+    st_atom_itemid,
+    st_atom_itemprop,
+    st_atom_itemref,
+    st_atom_itemscope,
+    st_atom_itemtype,
+    st_atom_kind,
+    st_atom_lang,
+    st_atom_language,
+    st_atom_list,
+    st_atom_loading,
+    st_atom_loop,
+    st_atom_low,
+    st_atom_max,
+    st_atom_maxlength,
+    st_atom_media,
+    st_atom_method,
+    st_atom_min,
+    st_atom_minlength,
+    st_atom_multiple,
+    st_atom_muted,
+    st_atom_name,
+    st_atom_nonce,
+    st_atom_novalidate,
+    st_atom_onblur,
+    st_atom_onchange,
+    st_atom_onclick,
+    st_atom_onerror,
+    st_atom_onfocus,
+    st_atom_oninput,
+    st_atom_onkeydown,
+    st_atom_onkeyup,
+    st_atom_onload,
+    st_atom_onmouseout,
+    st_atom_onmouseover,
+    st_atom_onsubmit,
+    st_atom_open,
+    st_atom_optimum,
+    st_atom_pattern,
+    st_atom_ping,
+    st_atom_placeholder,
+    st_atom_playsinline,
+    st_atom_poster,
+    st_atom_preload,
+    st_atom_property,
+    st_atom_readonly,
+    st_atom_referrerpolicy,
+    st_atom_rel,
+    st_atom_required,
+    st_atom_rev,
+    st_atom_reversed,
+    st_atom_role,
+    st_atom_rows,
+    st_atom_rowspan,
+    st_atom_sandbox,
+    st_atom_scope,
+    st_atom_selected,
+    st_atom_shape,
+    st_atom_size,
+    st_atom_sizes,
+    st_atom_spellcheck,
+    st_atom_src,
+    st_atom_srcdoc,
+    st_atom_srclang,
+    st_atom_srcset,
+    st_atom_start,
+    st_atom_step,
+    st_atom_tabindex,
+    st_atom_target,
+    st_atom_translate,
+    st_atom_type,
+    st_atom_usemap,
+    st_atom_valign,
+    st_atom_value,
+    st_atom_width,
+    st_atom_wrap,
+    st_atom_xmlns,
+    st_atom_count,
+} st_atom_t;
+
+// Incremental 32-bit FNV-1a hash of the lowercased UTF-8 bytes of a name
+#define ST_ATOM_HASH_INIT 2166136261u
+#define ST_ATOM_HASH_UPDATE(hash, byte) \
+    (((hash) ^ (uint8_t)(byte)) * 16777619u)
+
+// Look up the atom of a lowercased name
+st_atom_t st_atom_lookup(const uint8_t *name, size_t len);
+
+// Look up the atom of a lowercased name with an already computed hash
+st_atom_t st_atom_lookup_hash(uint32_t hash,
+        const uint8_t *name, size_t len);
+
+// Get the name of an atom, NULL for st_atom_unknown
+const char *st_atom_to_string(st_atom_t atom, size_t *len);
+
+// Get the hash of the name of an atom
+uint32_t st_atom_hash(st_atom_t atom);
+
+#endif
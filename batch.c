@@ -0,0 +1,269 @@
+#include "batch.h"
+
+#include <string.h>
+#include <assert.h>
+
+// Create a new batch
+st_status st_token_batch_init(st_token_batch_t **batch, size_t capacity,
+        size_t attr_capacity, size_t data_capacity,
+        const st_allocator_t *allocator)
+{
+    // Offsets and lengths into data are 32 bit
+    if (capacity == 0 || data_capacity > UINT32_MAX
+            || attr_capacity > UINT32_MAX)
+        return st_invalid_config;
+
+    allocator = st_allocator(allocator);
+
+    *batch = st_malloc(allocator, sizeof(**batch));
+    if (*batch == NULL)
+        return st_out_of_memory;
+
+    memset(*batch, 0, sizeof(**batch));
+
+    st_token_batch_t *b = *batch;
+
+    b->allocator = *allocator;
+
+    b->capacity = capacity;
+    b->types = st_malloc(allocator, capacity * sizeof(*b->types));
+    b->offsets = st_malloc(allocator, capacity * sizeof(*b->offsets));
+    b->lengths = st_malloc(allocator, capacity * sizeof(*b->lengths));
+    b->span_starts = st_malloc(allocator, capacity * sizeof(*b->span_starts));
+    b->span_ends = st_malloc(allocator, capacity * sizeof(*b->span_ends));
+    b->error_offsets = st_malloc(allocator,
+            capacity * sizeof(*b->error_offsets));
+    b->atoms = st_malloc(allocator, capacity * sizeof(*b->atoms));
+    b->attr_start = st_malloc(allocator, capacity * sizeof(*b->attr_start));
+    b->attr_count = st_malloc(allocator, capacity * sizeof(*b->attr_count));
+
+    size_t attr_bytes = attr_capacity * sizeof(uint32_t);
+
+    b->attr_capacity = attr_capacity;
+    b->attr_atoms = st_malloc(allocator,
+            attr_capacity * sizeof(*b->attr_atoms));
+    b->attr_name_offsets = st_malloc(allocator, attr_bytes);
+    b->attr_name_lengths = st_malloc(allocator, attr_bytes);
+    b->attr_value_offsets = st_malloc(allocator, attr_bytes);
+    b->attr_value_lengths = st_malloc(allocator, attr_bytes);
+
+    b->data_capacity = data_capacity;
+    b->data = st_malloc(allocator, data_capacity);
+
+    if (b->types == NULL || b->offsets == NULL || b->lengths == NULL
+            || b->span_starts == NULL || b->span_ends == NULL
+            || b->error_offsets == NULL || b->atoms == NULL
+            || b->attr_start == NULL || b->attr_count == NULL
+            || b->attr_atoms == NULL
+            || b->attr_name_offsets == NULL || b->attr_name_lengths == NULL
+            || b->attr_value_offsets == NULL
+            || b->attr_value_lengths == NULL || b->data == NULL) {
+        st_token_batch_free(b);
+        return st_out_of_memory;
+    }
+
+    return st_ok;
+}
+
+// Free the batch and its columns
+void st_token_batch_free(st_token_batch_t *batch)
+{
+    if (batch == NULL)
+        return;
+
+    const st_allocator_t *a = &batch->allocator;
+
+    st_free(a, batch->types);
+    st_free(a, batch->offsets);
+    st_free(a, batch->lengths);
+    st_free(a, batch->span_starts);
+    st_free(a, batch->span_ends);
+    st_free(a, batch->error_offsets);
+    st_free(a, batch->atoms);
+    st_free(a, batch->attr_start);
+    st_free(a, batch->attr_count);
+    st_free(a, batch->attr_atoms);
+    st_free(a, batch->attr_name_offsets);
+    st_free(a, batch->attr_name_lengths);
+    st_free(a, batch->attr_value_offsets);
+    st_free(a, batch->attr_value_lengths);
+    st_free(a, batch->data);
+    st_free(a, batch);
+}
+
+void st_token_batch_clear(st_token_batch_t *batch)
+{
+    batch->count = 0;
+    batch->num_attrs = 0;
+    batch->data_used = 0;
+}
+
+// Copy bytes to the end of data, and return their offset
+static uint32_t st_token_batch_copy(st_token_batch_t *batch,
+        const uint8_t *ptr, size_t len)
+{
+    uint32_t offset = batch->data_used;
+
+    if (len > 0) {
+        memcpy(batch->data + offset, ptr, len);
+        batch->data_used += len;
+    }
+
+    return offset;
+}
+
+// Add a token without attributes
+static void st_token_batch_push(st_token_batch_t *batch,
+        st_token_type_t type, uint32_t offset, uint32_t len, st_atom_t atom,
+        size_t start, size_t end)
+{
+    size_t i = batch->count++;
+
+    batch->types[i] = type;
+    batch->offsets[i] = offset;
+    batch->lengths[i] = len;
+    batch->span_starts[i] = start;
+    batch->span_ends[i] = end;
+    batch->atoms[i] = atom;
+    batch->attr_start[i] = batch->num_attrs;
+    batch->attr_count[i] = 0;
+}
+
+size_t st_token_batch_add_text(st_token_batch_t *batch,
+        const uint8_t *ptr, size_t len, size_t start, size_t end)
+{
+    size_t room = batch->data_capacity - batch->data_used;
+    size_t last = batch->count - 1;
+
+    // Only part of the run fits
+    if (len > room) {
+        len = room;
+        if (end - start > len)
+            end = start + len;
+    }
+
+    // Text that follows text extends it
+    if (batch->count > 0 && batch->types[last] == st_token_type_text
+            && batch->offsets[last] + batch->lengths[last]
+                == batch->data_used) {
+        batch->lengths[last] += len;
+        batch->span_ends[last] = end;
+        st_token_batch_copy(batch, ptr, len);
+        return len;
+    }
+
+    if (len == 0 || batch->count == batch->capacity)
+        return 0;
+
+    uint32_t offset = st_token_batch_copy(batch, ptr, len);
+    st_token_batch_push(batch, st_token_type_text, offset, len,
+            st_atom_unknown, start, end);
+
+    return len;
+}
+
+// Copy a tag token with its attributes
+static st_status st_token_batch_add_tag(st_token_batch_t *batch,
+        st_token_t *token, size_t start, size_t end)
+{
+    size_t num_attrs = st_token_attr_num(token);
+    const uint8_t *ptr;
+    size_t len, bytes;
+
+    // Check that everything fits before anything is copied
+    st_token_tag_name_view(token, &ptr, &bytes);
+    for (size_t i = 0; i < num_attrs; i++) {
+        st_token_attr_name_view(token, i, &ptr, &len);
+        bytes += len;
+        st_token_attr_value_view(token, i, &ptr, &len);
+        bytes += len;
+    }
+
+    if (num_attrs > batch->attr_capacity || bytes > batch->data_capacity)
+        return st_invalid_config;
+
+    if (num_attrs > batch->attr_capacity - batch->num_attrs
+            || bytes > batch->data_capacity - batch->data_used)
+        return st_out_of_memory;
+
+    st_token_tag_name_view(token, &ptr, &len);
+    st_token_batch_push(batch, st_token_type(token),
+            st_token_batch_copy(batch, ptr, len), len,
+            st_token_tag_atom(token), start, end);
+    batch->attr_count[batch->count - 1] = num_attrs;
+
+    for (size_t i = 0; i < num_attrs; i++) {
+        size_t a = batch->num_attrs++;
+
+        batch->attr_atoms[a] = st_token_attr_atom(token, i);
+
+        st_token_attr_name_view(token, i, &ptr, &len);
+        batch->attr_name_offsets[a] = st_token_batch_copy(batch, ptr, len);
+        batch->attr_name_lengths[a] = len;
+
+        st_token_attr_value_view(token, i, &ptr, &len);
+        batch->attr_value_offsets[a] = st_token_batch_copy(batch, ptr, len);
+        batch->attr_value_lengths[a] = len;
+    }
+
+    return st_ok;
+}
+
+st_status st_token_batch_add(st_token_batch_t *batch, st_token_t *token)
+{
+    st_token_type_t type = st_token_type(token);
+    const uint8_t *ptr;
+    size_t len, start, end;
+    st_status rc;
+
+    st_token_span(token, &start, &end);
+
+    // A character token, from a custom decoder, is stored as text so that
+    // the characters of a run are merged into one token
+    if (type == st_token_type_text || type == st_token_type_character) {
+        if ((rc = st_token_text(token, &ptr, &len)) != st_ok) {
+            return rc;
+        }
+
+        if (len > batch->data_capacity)
+            return st_invalid_config;
+
+        // Text that follows text takes no new token
+        size_t room = batch->data_capacity - batch->data_used;
+        if (len > room || (batch->count == batch->capacity
+                    && batch->types[batch->count - 1] != st_token_type_text))
+            return st_out_of_memory;
+
+        st_token_batch_add_text(batch, ptr, len, start, end);
+        return st_ok;
+    }
+
+    if (batch->count == batch->capacity)
+        return st_out_of_memory;
+
+    switch (type) {
+        case st_token_type_start_tag:
+        case st_token_type_end_tag:
+            return st_token_batch_add_tag(batch, token, start, end);
+
+        case st_token_type_error:
+            ptr = (const uint8_t *)st_token_error_message(token);
+            len = strlen((const char *)ptr);
+            if (len > batch->data_capacity)
+                return st_invalid_config;
+            if (len > batch->data_capacity - batch->data_used)
+                return st_out_of_memory;
+
+            st_token_batch_push(batch, type,
+                    st_token_batch_copy(batch, ptr, len), len,
+                    st_atom_unknown, start, end);
+            batch->error_offsets[batch->count - 1] =
+                st_token_error_offset(token);
+            return st_ok;
+
+        default:
+            st_token_batch_push(batch, type, batch->data_used, 0,
+                    st_atom_unknown, start, end);
+            return st_ok;
+    }
+}
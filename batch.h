@@ -0,0 +1,73 @@
+#ifndef batch_h
+#define batch_h
+
+#include "styre.h"
+#include "token.h"
+#include "atom.h"
+#include "alloc.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+
+// A batch of tokens stored as columns. Token i has type types[i], and its
+// text, its tag name, or the message of an error, is lengths[i] bytes at
+// data + offsets[i]. Its source is the bytes from span_starts[i] to
+// span_ends[i] in the input, as from st_token_span, and an error was found
+// at error_offsets[i]. The attributes of a tag are attr_count[i] entries
+// from attr_start[i] in the attribute columns. Names and values are stored
+// in data the same way. Character tokens are stored as text, and adjacent
+// text is merged into one token.
+typedef struct {
+    size_t count;                   // Number of tokens in the batch
+    size_t capacity;                // Number of tokens the columns hold
+    st_token_type_t *types;         // Type of each token
+    uint32_t *offsets;              // Offset of the text or tag name in data
+    uint32_t *lengths;              // Length of the text or tag name
+    size_t *span_starts;            // Offset of the source in the input
+    size_t *span_ends;              // Offset just past the source
+    size_t *error_offsets;          // Offset of the character of an error
+    st_atom_t *atoms;               // Atom of the tag name
+    uint32_t *attr_start;           // First attribute of a tag
+    uint32_t *attr_count;           // Number of attributes of a tag
+
+    size_t num_attrs;               // Number of attributes in the batch
+    size_t attr_capacity;           // Number of attributes the columns hold
+    st_atom_t *attr_atoms;          // Atom of each attribute name
+    uint32_t *attr_name_offsets;    // Offset of the name in data
+    uint32_t *attr_name_lengths;    // Length of the name
+    uint32_t *attr_value_offsets;   // Offset of the value in data
+    uint32_t *attr_value_lengths;   // Length of the value
+
+    uint8_t *data;                  // Bytes of text, names and values
+    size_t data_used;               // Number of bytes used
+    size_t data_capacity;           // Number of bytes data holds
+
+    st_allocator_t allocator;       // Allocator of the batch and its columns
+} st_token_batch_t;
+
+// Create a batch that holds up to capacity tokens, attr_capacity attributes
+// and data_capacity bytes of text, names, values and error messages. A tag
+// or an error that does not fit in an empty batch can not be added. The
+// batch is allocated from allocator, or from libc when it is NULL.
+st_status st_token_batch_init(st_token_batch_t **batch, size_t capacity,
+        size_t attr_capacity, size_t data_capacity,
+        const st_allocator_t *allocator);
+void st_token_batch_free(st_token_batch_t *batch);
+
+// Empty the batch
+void st_token_batch_clear(st_token_batch_t *batch);
+
+// Copy a token into the batch. Returns st_out_of_memory, and adds nothing,
+// when the batch does not have room for it, and st_invalid_config when an
+// empty batch would not have room for it either.
+st_status st_token_batch_add(st_token_batch_t *batch, st_token_t *token);
+
+// Add as much of a run of text as there is room for, merged with a text
+// token that ends the batch. The run comes from the source between start and
+// end. When only part of it fits, the part spans as many bytes of the source
+// as it has, which is exact for all text but that of character references.
+// Returns the number of bytes added.
+size_t st_token_batch_add_text(st_token_batch_t *batch,
+        const uint8_t *ptr, size_t len, size_t start, size_t end);
+
+#endif
@@ -0,0 +1,641 @@
+// Benchmarks for the tokenizer and the helpers on its hot paths, run over
+// synthetic documents that are generated the same way on every run.
+//
+// Build and run with `make bench`, and pass a name to run only the
+// benchmarks that contain it: ./benchmark tokenizer/entities
+//
+// Every benchmark reports MB/s of input, tokens/s and allocations per token.
+// For the microbenchmarks a token is what one call handles: a codepoint for
+// utf8_next_codepoint, a chunk of codepoints for utf8_encode_unicode, a piece
+// of text for st_buffer_append and a block of output for st_transcode.
+// Allocations are counted by wrapping malloc, calloc and realloc at link time.
+//
+// Built with `make STATS=1 bench`, the tokenizer counters are printed after
+// the benchmarks of each corpus.
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+#include <time.h>
+
+#include "utf8.h"
+#include "buffer.h"
+#include "tokenizer.h"
+#include "token.h"
+#include "transcode.h"
+
+// Least time a benchmark is repeated for, in seconds
+#define BENCH_MIN_TIME 0.25
+
+// Codepoints handed to utf8_encode_unicode at once
+#define BENCH_ENCODE_CHUNK 4096
+
+// Bytes of UTF-8 st_transcode writes at once
+#define BENCH_TRANSCODE_BLOCK 65536
+
+// Encodings the text corpus is transcoded from
+static const st_encoding_t bench_encodings[] = {
+    st_encoding_windows_1252,
+    st_encoding_utf16le,
+};
+
+//
+// Allocation counting
+//
+static size_t bench_allocations;
+
+void *__real_malloc(size_t size);
+void *__real_calloc(size_t num, size_t size);
+void *__real_realloc(void *ptr, size_t size);
+
+void *__wrap_malloc(size_t size)
+{
+    bench_allocations++;
+    return __real_malloc(size);
+}
+
+void *__wrap_calloc(size_t num, size_t size)
+{
+    bench_allocations++;
+    return __real_calloc(num, size);
+}
+
+void *__wrap_realloc(void *ptr, size_t size)
+{
+    bench_allocations++;
+    return __real_realloc(ptr, size);
+}
+
+//
+// Corpus generation
+//
+typedef enum {
+    bench_corpus_text = 0,          // Long paragraphs with a little markup
+    bench_corpus_attributes,        // Nested tags with many attributes
+    bench_corpus_script,            // Large inline scripts
+    bench_corpus_entities,          // Text full of character references
+    bench_corpus_count,
+} bench_corpus_type_t;
+
+static const char *bench_corpus_names[bench_corpus_count] = {
+    "text",
+    "attributes",
+    "script",
+    "entities",
+};
+
+typedef struct {
+    uint8_t *buf;
+    size_t len;
+    size_t capacity;
+    uint64_t state;                 // State of the random generator
+} bench_corpus_t;
+
+static const char *bench_words[] = {
+    "the", "of", "and", "to", "in", "is", "that", "for", "it", "as", "was",
+    "with", "be", "by", "on", "not", "he", "this", "are", "or", "his",
+    "from", "at", "which", "but", "have", "an", "had", "they", "you",
+    "were", "their", "one", "all", "we", "can", "her", "has", "there",
+    "been", "if", "more", "when", "will", "would", "who", "so", "no",
+    "document", "tokenizer", "performance", "attribute", "character",
+    "reference", "throughput", "latency", "budget", "parser", "stream",
+    "café", "naïve", "résumé", "Ελληνικά", "русский", "日本語", "中文",
+    "한국어", "עברית", "العربية", "😀",
+};
+
+#define BENCH_NUM_WORDS (sizeof(bench_words) / sizeof(*bench_words))
+
+// The words before the first one that is not ASCII, for names and URLs
+#define BENCH_NUM_ASCII_WORDS 59
+
+static const char *bench_entities[] = {
+    "&amp;", "&lt;", "&gt;", "&quot;", "&nbsp;", "&copy;", "&hellip;",
+    "&mdash;", "&eacute;", "&#169;", "&#x2014;", "&#39;", "&amp", "&nbsp",
+    "&rarr;", "&NotNestedGreaterGreater;",
+};
+
+#define BENCH_NUM_ENTITIES (sizeof(bench_entities) / sizeof(*bench_entities))
+
+static const char *bench_tags[] = {
+    "div", "span", "a", "li", "section", "p", "td", "button", "label",
+};
+
+#define BENCH_NUM_TAGS (sizeof(bench_tags) / sizeof(*bench_tags))
+
+// xorshift64*, seeded the same for every corpus
+static uint32_t bench_random(bench_corpus_t *c, uint32_t n)
+{
+    c->state ^= c->state >> 12;
+    c->state ^= c->state << 25;
+    c->state ^= c->state >> 27;
+
+    return (uint32_t)((c->state * 2685821657736338717ull) >> 32) % n;
+}
+
+static void bench_put(bench_corpus_t *c, const char *str)
+{
+    size_t len = strlen(str);
+
+    if (c->len + len > c->capacity) {
+        c->capacity = (c->capacity + len) * 2;
+        c->buf = realloc(c->buf, c->capacity);
+        if (c->buf == NULL) {
+            fprintf(stderr, "Out of memory\n");
+            exit(1);
+        }
+    }
+
+    memcpy(c->buf + c->len, str, len);
+    c->len += len;
+}
+
+static const char *bench_ascii_word(bench_corpus_t *c)
+{
+    return bench_words[bench_random(c, BENCH_NUM_ASCII_WORDS)];
+}
+
+static void bench_put_words(bench_corpus_t *c, size_t n)
+{
+    for (size_t i = 0; i < n; i++) {
+        if (i > 0)
+            bench_put(c, " ");
+        bench_put(c, bench_words[bench_random(c, BENCH_NUM_WORDS)]);
+    }
+}
+
+static void bench_put_number(bench_corpus_t *c, uint32_t n)
+{
+    char number[16];
+
+    snprintf(number, sizeof(number), "%u", (unsigned)n);
+    bench_put(c, number);
+}
+
+static void bench_put_text(bench_corpus_t *c)
+{
+    bench_put(c, "<p>");
+    for (size_t i = bench_random(c, 8) + 2; i > 0; i--) {
+        bench_put_words(c, bench_random(c, 30) + 5);
+        switch (bench_random(c, 4)) {
+            case 0:
+                bench_put(c, " <b>");
+                bench_put_words(c, bench_random(c, 3) + 1);
+                bench_put(c, "</b> ");
+                break;
+            case 1:
+                bench_put(c, " <a href=\"/wiki/");
+                bench_put(c, bench_ascii_word(c));
+                bench_put(c, "\">");
+                bench_put_words(c, bench_random(c, 3) + 1);
+                bench_put(c, "</a> ");
+                break;
+            default:
+                bench_put(c, ". ");
+        }
+    }
+    bench_put(c, "</p>\n");
+}
+
+static void bench_put_attributes(bench_corpus_t *c)
+{
+    const char *tag = bench_tags[bench_random(c, BENCH_NUM_TAGS)];
+
+    bench_put(c, "<");
+    bench_put(c, tag);
+    bench_put(c, " class=\"");
+    bench_put_words(c, bench_random(c, 4) + 1);
+    bench_put(c, "\" id=\"node-");
+    bench_put_number(c, bench_random(c, 100000));
+    bench_put(c, "\"");
+
+    for (size_t i = bench_random(c, 6); i > 0; i--) {
+        bench_put(c, " data-");
+        bench_put(c, bench_ascii_word(c));
+        bench_put(c, "=\"");
+        bench_put_number(c, bench_random(c, 1000));
+        bench_put(c, "\"");
+    }
+
+    if (bench_random(c, 2) == 0) {
+        bench_put(c, " style='width: ");
+        bench_put_number(c, bench_random(c, 100));
+        bench_put(c, "%; display: none'");
+    }
+
+    bench_put(c, " aria-label=\"");
+    bench_put_words(c, bench_random(c, 3) + 1);
+    bench_put(c, "\">");
+
+    if (bench_random(c, 3) == 0)
+        bench_put_attributes(c);
+    else
+        bench_put_words(c, bench_random(c, 3));
+
+    bench_put(c, "</");
+    bench_put(c, tag);
+    bench_put(c, ">\n");
+}
+
+// The tokenizer does not have the script data states yet, so scripts are
+// tokenized as text and are written without a '<'
+static void bench_put_script(bench_corpus_t *c)
+{
+    bench_put(c, "<script type=\"text/javascript\">\n");
+    for (size_t i = bench_random(c, 40) + 10; i > 0; i--) {
+        switch (bench_random(c, 5)) {
+            case 0:
+                bench_put(c, "  var ");
+                bench_put(c, bench_ascii_word(c));
+                bench_put(c, " = document.getElementById(\"node-");
+                bench_put_number(c, bench_random(c, 100000));
+                bench_put(c, "\");\n");
+                break;
+            case 1:
+                bench_put(c, "  if (count > ");
+                bench_put_number(c, bench_random(c, 1000));
+                bench_put(c, " && ready) { update(count, 'done'); }\n");
+                break;
+            case 2:
+                bench_put(c, "  for (var i = items.length; i--;) "
+                        "{ total += items[i].value * 2; }\n");
+                break;
+            case 3:
+                bench_put(c, "  // ");
+                bench_put_words(c, bench_random(c, 10) + 2);
+                bench_put(c, "\n");
+                break;
+            default:
+                bench_put(c, "  console.log(\"");
+                bench_put_words(c, bench_random(c, 6) + 1);
+                bench_put(c, "\");\n");
+        }
+    }
+    bench_put(c, "</script>\n");
+}
+
+static void bench_put_entities(bench_corpus_t *c)
+{
+    bench_put(c, "<p title=\"a &amp; b &#x2014; ");
+    bench_put(c, bench_words[bench_random(c, BENCH_NUM_WORDS)]);
+    bench_put(c, "\">");
+    for (size_t i = bench_random(c, 30) + 10; i > 0; i--) {
+        bench_put_words(c, bench_random(c, 3) + 1);
+        bench_put(c, " ");
+        bench_put(c, bench_entities[bench_random(c, BENCH_NUM_ENTITIES)]);
+        bench_put(c, " ");
+    }
+    bench_put(c, "<a href=\"/search?q=");
+    bench_put(c, bench_ascii_word(c));
+    bench_put(c, "&amp;page=2&lang=en\">next</a></p>\n");
+}
+
+// Generate a document of about len bytes
+static void bench_corpus_generate(bench_corpus_t *c,
+        bench_corpus_type_t type, size_t len)
+{
+    memset(c, 0, sizeof(*c));
+    c->state = 0x9E3779B97F4A7C15ull;
+
+    bench_put(c, "<html><head><title>Benchmark</title></head><body>\n");
+    while (c->len < len) {
+        switch (type) {
+            case bench_corpus_text:
+                bench_put_text(c);
+                break;
+            case bench_corpus_attributes:
+                bench_put_attributes(c);
+                break;
+            case bench_corpus_script:
+                bench_put_script(c);
+                break;
+            case bench_corpus_entities:
+                bench_put_entities(c);
+                break;
+            default:
+                break;
+        }
+    }
+    bench_put(c, "</body></html>\n");
+}
+
+//
+// Measurement
+//
+typedef struct {
+    const uint8_t *buf;             // Input of the benchmark
+    size_t len;
+    uint32_t *codepoints;           // Decoded input, for encoding
+    size_t num_codepoints;
+    st_tokenizer_t *t;
+    st_transcoder_t *transcoder;
+    uint8_t *out;                   // Output of the transcoder
+    size_t tokens;                  // Tokens handled by the last iteration
+} bench_t;
+
+typedef void (*bench_cb)(bench_t *b);
+
+static double bench_now(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// Run a benchmark until it has taken long enough, and print its results
+static void bench_run(const char *name, const char *filter, bench_t *b,
+        bench_cb func)
+{
+    size_t iterations = 0, tokens = 0, allocations;
+    double start, elapsed;
+
+    if (filter != NULL && strstr(name, filter) == NULL)
+        return;
+
+    // Once to warm up, and to check that it works
+    b->tokens = 0;
+    func(b);
+    if (b->tokens == 0) {
+        fprintf(stderr, "%s: no tokens\n", name);
+        exit(1);
+    }
+
+    allocations = bench_allocations;
+    start = bench_now();
+    do {
+        b->tokens = 0;
+        func(b);
+        tokens += b->tokens;
+        iterations++;
+        elapsed = bench_now() - start;
+    } while (elapsed < BENCH_MIN_TIME);
+    allocations = bench_allocations - allocations;
+
+    printf("%-28s %10zu %10.1f %14.0f %12.4f\n", name, b->len,
+            b->len * iterations / elapsed / 1e6, tokens / elapsed,
+            (double)allocations / tokens);
+}
+
+static void bench_utf8_next_codepoint(bench_t *b)
+{
+    size_t i = 0, bytes;
+    uint32_t codepoint;
+
+    while (utf8_next_codepoint(b->buf + i, b->len - i, &codepoint, &bytes)
+            == st_ok) {
+        i += bytes;
+        b->tokens++;
+    }
+}
+
+static void bench_utf8_encode_unicode(bench_t *b)
+{
+    uint8_t *out;
+    size_t bytes;
+
+    for (size_t i = 0; i < b->num_codepoints; i += BENCH_ENCODE_CHUNK) {
+        size_t n = b->num_codepoints - i;
+
+        if (n > BENCH_ENCODE_CHUNK)
+            n = BENCH_ENCODE_CHUNK;
+
+        if (utf8_encode_unicode(b->codepoints + i, n, &out, &bytes, NULL)
+                != st_ok) {
+            fprintf(stderr, "utf8_encode_unicode failed\n");
+            exit(1);
+        }
+
+        free(out);
+        b->tokens++;
+    }
+}
+
+// Append the input in pieces of 1 to 64 bytes, as names and values grow
+static void bench_st_buffer_append(bench_t *b)
+{
+    st_buffer_t *buffer;
+    size_t i = 0, n = 1;
+
+    if (st_buffer_init(&buffer, 64, NULL) != st_ok)
+        exit(1);
+
+    while (i < b->len) {
+        if (n > b->len - i)
+            n = b->len - i;
+
+        if (st_buffer_append(&buffer, b->buf + i, n) != st_ok) {
+            fprintf(stderr, "st_buffer_append failed\n");
+            exit(1);
+        }
+
+        i += n;
+        n = n % 64 + 1;
+        b->tokens++;
+    }
+
+    st_buffer_free(buffer);
+}
+
+// Write codepoints in an encoding, with '?' for those that a single-byte
+// encoding does not have
+static uint8_t *bench_encode(const uint32_t *codepoints, size_t n,
+        st_encoding_t encoding, size_t *len)
+{
+    const uint16_t *high = st_encoding_high_half(encoding);
+    uint8_t *out = malloc(n * 4), *o = out;
+
+    if (out == NULL)
+        exit(1);
+
+    for (size_t i = 0; i < n; i++) {
+        uint32_t cp = codepoints[i];
+
+        if (encoding == st_encoding_utf16le) {
+            if (cp >= 0x10000) {
+                cp -= 0x10000;
+                *o++ = (0xD800 + (cp >> 10)) & 0xFF;
+                *o++ = (0xD800 + (cp >> 10)) >> 8;
+                cp = 0xDC00 + (cp & 0x3FF);
+            }
+            *o++ = cp & 0xFF;
+            *o++ = cp >> 8;
+        } else if (cp < 0x80) {
+            *o++ = cp;
+        } else {
+            size_t b = 0;
+
+            while (b < 128 && high[b] != cp)
+                b++;
+            *o++ = b < 128 ? 0x80 + b : '?';
+        }
+    }
+
+    *len = o - out;
+
+    return out;
+}
+
+static void bench_st_transcode(bench_t *b)
+{
+    size_t i = 0, used, written;
+
+    st_transcoder_reset(b->transcoder);
+
+    while (i < b->len) {
+        st_transcode(b->transcoder, b->buf + i, b->len - i, &used, b->out,
+                BENCH_TRANSCODE_BLOCK, &written);
+        i += used;
+        b->tokens++;
+    }
+}
+
+static void bench_document_noop(st_tokenizer_t *t, void *ctx)
+{
+}
+
+static void bench_token(st_tokenizer_t *t, st_token_t *token, void *ctx)
+{
+    bench_t *b = ctx;
+
+    // The corpora are written to tokenize without errors
+    if (st_token_type(token) == st_token_type_error) {
+        fprintf(stderr, "Error token at offset %zu\n", b->tokens);
+        exit(1);
+    }
+
+    b->tokens++;
+}
+
+static void bench_error(st_tokenizer_t *t, const char *msg, void *ctx)
+{
+}
+
+static void bench_st_tokenizer_run(bench_t *b)
+{
+    if (st_tokenizer_set_string(b->t, b->buf, b->len) != st_ok ||
+            st_tokenizer_run(b->t) != st_ok) {
+        fprintf(stderr, "st_tokenizer_run failed\n");
+        exit(1);
+    }
+}
+
+int main(int argc, char **argv)
+{
+    static const size_t sizes[] = { 64 << 10, 1 << 20, 8 << 20 };
+    const char *filter = argc > 1 ? argv[1] : NULL;
+    st_tokenizer_callbacks_t callbacks = {
+        &bench_document_noop,
+        &bench_document_noop,
+        &bench_token,
+        &bench_error,
+    };
+    bench_corpus_t corpus;
+    bench_t b;
+    char name[64];
+    size_t i, j, bytes;
+    size_t num_encodings = sizeof(bench_encodings) / sizeof(*bench_encodings);
+    uint8_t *encoded[sizeof(bench_encodings) / sizeof(*bench_encodings)];
+    size_t encoded_len[sizeof(bench_encodings) / sizeof(*bench_encodings)];
+
+    printf("%-28s %10s %10s %14s %12s\n", "benchmark", "bytes", "MB/s",
+            "tokens/s", "allocs/token");
+
+    // Microbenchmarks, on the text corpus
+    memset(&b, 0, sizeof(b));
+    bench_corpus_generate(&corpus, bench_corpus_text, 1 << 20);
+    b.buf = corpus.buf;
+    b.len = corpus.len;
+
+    b.codepoints = malloc(b.len * sizeof(*b.codepoints));
+    if (b.codepoints == NULL)
+        return 1;
+    for (i = 0; utf8_next_codepoint(b.buf + i, b.len - i,
+                &b.codepoints[b.num_codepoints], &bytes) == st_ok; i += bytes)
+        b.num_codepoints++;
+
+    bench_run("utf8_next_codepoint", filter, &b,
+            &bench_utf8_next_codepoint);
+    bench_run("utf8_encode_unicode", filter, &b,
+            &bench_utf8_encode_unicode);
+    bench_run("st_buffer_append", filter, &b, &bench_st_buffer_append);
+
+    // The text corpus in other encodings, kept for the tokenizer below
+    b.out = malloc(BENCH_TRANSCODE_BLOCK);
+    if (b.out == NULL)
+        return 1;
+
+    for (i = 0; i < num_encodings; i++) {
+        encoded[i] = bench_encode(b.codepoints, b.num_codepoints,
+                bench_encodings[i], &encoded_len[i]);
+        b.buf = encoded[i];
+        b.len = encoded_len[i];
+
+        if (st_transcoder_init(&b.transcoder, bench_encodings[i], NULL)
+                != st_ok)
+            return 1;
+
+        snprintf(name, sizeof(name), "st_transcode/%s",
+                st_encoding_name(bench_encodings[i]));
+        bench_run(name, filter, &b, &bench_st_transcode);
+
+        st_transcoder_free(b.transcoder);
+    }
+
+    free(b.out);
+    free(b.codepoints);
+    free(corpus.buf);
+
+    // The whole tokenizer, reused for every run as a long running user would
+    memset(&b, 0, sizeof(b));
+    if (st_tokenizer_init(&b.t, &callbacks, &b, NULL) != 0)
+        return 1;
+
+    for (i = 0; i < bench_corpus_count; i++) {
+        st_tokenizer_stats_clear(b.t);
+
+        for (j = 0; j < sizeof(sizes) / sizeof(*sizes); j++) {
+            bench_corpus_generate(&corpus, i, sizes[j]);
+            b.buf = corpus.buf;
+            b.len = corpus.len;
+
+            snprintf(name, sizeof(name), "tokenizer/%s/%zuk",
+                    bench_corpus_names[i], sizes[j] >> 10);
+            bench_run(name, filter, &b, &bench_st_tokenizer_run);
+
+            free(corpus.buf);
+        }
+
+#ifdef ST_TOKENIZER_STATS
+        st_tokenizer_stats_t stats;
+
+        if (st_tokenizer_stats(b.t, &stats) == st_ok &&
+                stats.tokens[st_token_type_text] > 0) {
+            printf("\n");
+            st_tokenizer_stats_dump(&stats, stdout);
+            printf("\n");
+        }
+#endif
+    }
+
+    // The text corpus converted as it is tokenized
+    for (i = 0; i < num_encodings; i++) {
+        b.buf = encoded[i];
+        b.len = encoded_len[i];
+
+        if (st_tokenizer_set_encoding(b.t, bench_encodings[i]) != st_ok)
+            return 1;
+
+        snprintf(name, sizeof(name), "tokenizer/text/%s",
+                st_encoding_name(bench_encodings[i]));
+        bench_run(name, filter, &b, &bench_st_tokenizer_run);
+
+        free(encoded[i]);
+    }
+
+    st_tokenizer_destroy(b.t);
+
+    return 0;
+}
@@ -6,36 +6,55 @@ struct st_buffer {
     uint8_t *ptr;
     size_t used;
     size_t allocated;
+    st_allocator_t allocator;       // Allocator the buffer is resized with
 };
 
 // Initialize a new buffer
-st_status st_buffer_init(st_buffer_t **buffer, size_t initial_size)
+st_status st_buffer_init(st_buffer_t **buffer, size_t initial_size,
+        const st_allocator_t *allocator)
 {
-    *buffer = malloc(sizeof(**buffer) + initial_size);
+    allocator = st_allocator(allocator);
+
+    *buffer = st_malloc(allocator, sizeof(**buffer) + initial_size);
     if (*buffer == NULL)
         return st_out_of_memory;
 
     (*buffer)->ptr = ((uint8_t *)*buffer) + sizeof(**buffer);
     (*buffer)->used = 0;
     (*buffer)->allocated = initial_size;
+    (*buffer)->allocator = *allocator;
 
     return st_ok;
 }
 
+// Free the buffer
+void st_buffer_free(st_buffer_t *buffer)
+{
+    if (buffer == NULL)
+        return;
+
+    st_free(&buffer->allocator, buffer);
+}
+
 // Append some bytes to the buffer
 st_status st_buffer_append(st_buffer_t **buffer,
         const void *val, size_t len)
 {
     // Expand the buffer if needed
     if ((*buffer)->used + len > (*buffer)->allocated) {
-        st_buffer_t *tmp = realloc(*buffer, (*buffer)->allocated * 2);
+        size_t allocated = (*buffer)->allocated * 2;
+        if (allocated < (*buffer)->used + len)
+            allocated = (*buffer)->used + len;
+
+        st_buffer_t *tmp = st_realloc(&(*buffer)->allocator, *buffer,
+                sizeof(**buffer) + allocated);
 
         if (tmp == NULL)
             return st_out_of_memory;
 
         // Update pointer to memory
         tmp->ptr = ((uint8_t *)tmp) + sizeof(**buffer);
-        tmp->allocated *= 2;
+        tmp->allocated = allocated;
 
         // Update the buffer pointer
         *buffer = tmp;
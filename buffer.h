@@ -2,14 +2,20 @@
 #define buffer_h
 
 #include "styre.h"
+#include "alloc.h"
 
 #include <stdint.h>
 #include <stdlib.h>
 
 typedef struct st_buffer st_buffer_t;
 
-// Initialize a new buffer
-st_status st_buffer_init(st_buffer_t **buffer, size_t initial_size);
+// Initialize a new buffer, allocated from allocator or from libc when it is
+// NULL
+st_status st_buffer_init(st_buffer_t **buffer, size_t initial_size,
+        const st_allocator_t *allocator);
+
+// Free the buffer
+void st_buffer_free(st_buffer_t *buffer);
 
 // Append some bytes to the buffer
 st_status st_buffer_append(st_buffer_t **buffer, const void *val, size_t len);
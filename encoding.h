@@ -0,0 +1,60 @@
+// Generated by tools/gen_encodings.py, do not edit
+#ifndef encoding_h
+#define encoding_h
+
+#include "styre.h"
+
+#include <stdlib.h>
+#include <stdint.h>
+
+// Encodings the input can be transcoded from, by their names in the
+// Encoding Standard. The single-byte ones come after
+// ST_ENCODING_FIRST_SINGLE_BYTE.
+typedef enum {
+    st_encoding_utf8 = 0,               // UTF-8
+    st_encoding_utf16le,                // UTF-16LE
+    st_encoding_utf16be,                // UTF-16BE
+    st_encoding_ibm866,                 // IBM866
+    st_encoding_iso_8859_2,             // ISO-8859-2
+    st_encoding_iso_8859_3,             // ISO-8859-3
+    st_encoding_iso_8859_4,             // ISO-8859-4
+    st_encoding_iso_8859_5,             // ISO-8859-5
+    st_encoding_iso_8859_6,             // ISO-8859-6
+    st_encoding_iso_8859_7,             // ISO-8859-7
+    st_encoding_iso_8859_8,             // ISO-8859-8
+    st_encoding_iso_8859_10,            // ISO-8859-10
+    st_encoding_iso_8859_13,            // ISO-8859-13
+    st_encoding_iso_8859_14,            // ISO-8859-14
+    st_encoding_iso_8859_15,            // ISO-8859-15
+    st_encoding_iso_8859_16,            // ISO-8859-16
+    st_encoding_koi8_r,                 // KOI8-R
+    st_encoding_macintosh,              // macintosh
+    st_encoding_windows_874,            // windows-874
+    st_encoding_windows_1250,           // windows-1250
+    st_encoding_windows_1251,           // windows-1251
+    st_encoding_windows_1252,           // windows-1252
+    st_encoding_windows_1253,           // windows-1253
+    st_encoding_windows_1254,           // windows-1254
+    st_encoding_windows_1255,           // windows-1255
+    st_encoding_windows_1256,           // windows-1256
+    st_encoding_windows_1257,           // windows-1257
+    st_encoding_windows_1258,           // windows-1258
+} st_encoding_t;
+
+#define ST_ENCODING_FIRST_SINGLE_BYTE st_encoding_ibm866
+#define ST_ENCODING_COUNT 28
+
+// Find the encoding with a label, such as the charset of a Content-Type
+// header. Case and surrounding whitespace are ignored. Returns
+// st_not_found for labels that are not known.
+st_status st_encoding_lookup(const char *label, size_t len,
+        st_encoding_t *encoding);
+
+// Get the name of an encoding, NULL for values that are not encodings
+const char *st_encoding_name(st_encoding_t encoding);
+
+// Get the codepoints of bytes 0x80 to 0xFF of a single-byte encoding,
+// U+FFFD for bytes it does not use, or NULL for the other encodings
+const uint16_t *st_encoding_high_half(st_encoding_t encoding);
+
+#endif
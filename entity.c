@@ -0,0 +1,1880 @@
+// Generated by tools/gen_entities.py, do not edit
+#include "entity.h"
+
+#define ST_ENTITY_LAST 1       // Last edge of a node
+#define ST_ENTITY_FINAL 2      // The edge ends a name
+#define ST_ENTITY_LEAF 4       // No edges leave the target
+
+typedef struct {
+    uint8_t byte;                   // Byte of the name
+    uint8_t flags;
+    uint16_t node;                  // First edge of the target
+    uint16_t skip;                  // Names reached through the edges
+                                    // before this one
+} st_entity_edge_t;
+
+// The edges of all nodes, the root first
+static const st_entity_edge_t st_entity_edges[3871] = {
+    { 65, 0,    52,    0}, { 66, 0,    68,   27}, { 67, 0,    76,   39},
+    { 68, 0,    90,   75}, { 69, 0,   101,  129}, { 70, 0,   117,  159},
+    { 71, 0,   122,  167}, { 72, 0,   134,  189}, { 73, 0,   142,  201},
+    { 74, 0,   156,  230}, { 75, 0,   161,  237}, { 76, 0,   168,  245},
+    { 77, 0,   179,  305}, { 78, 0,   187,  314}, { 79, 0,   196,  386},
+    { 80, 0,   210,  415}, { 81, 0,   219,  434}, { 82, 0,   223,  439},
+    { 83, 0,   235,  484}, { 84, 0,   248,  524}, { 85, 0,   259,  547},
+    { 86, 0,   273,  587}, { 87, 0,   282,  604}, { 88, 0,   287,  609},
+    { 89, 0,   291,  613}, { 90, 0,   300,  624}, { 97, 0,   308,  634},
+    { 98, 0,   324,  703}, { 99, 0,   340,  819}, {100, 0,   355,  918},
+    {101, 0,   374,  984}, {102, 0,   392, 1051}, {103, 0,   404, 1090},
+    {104, 0,   421, 1150}, {105, 0,   431, 1178}, {106, 0,   446, 1234},
+    {107, 0,   452, 1242}, {108, 0,   460, 1252}, {109, 0,   483, 1406},
+    {110, 0,   497, 1446}, {111, 0,   521, 1614}, {112, 0,   539, 1675},
+    {113, 0,   551, 1744}, {114, 0,   557, 1755}, {115, 0,   578, 1859},
+    {116, 0,   597, 2017}, {117, 0,   610, 2075}, {118, 0,   628, 2127},
+    {119, 0,   643, 2169}, {120, 0,   650, 2180}, {121, 0,   664, 2204},
+    {122, 1,   672, 2218}, { 69, 0,   682,    0}, { 77, 0,   683,    2},
+    { 97, 0,   684,    4}, { 98, 0,   685,    6}, { 99, 0,   686,    7},
+    {102, 0,   688,   10}, {103, 0,   689,   11}, {108, 0,   690,   13},
+    {109, 0,   691,   14}, {110, 0,   692,   15}, {111, 0,   693,   16},
+    {112, 0,   695,   18}, {114, 0,   696,   19}, {115, 0,   697,   21},
+    {116, 0,   699,   23}, {117, 1,   700,   25}, { 97, 0,   701,    0},
+    { 99, 0,   703,    3}, {101, 0,   704,    4}, {102, 0,   688,    7},
+    {111, 0,   707,    8}, {114, 0,   708,    9}, {115, 0,   709,   10},
+    {117, 1,   710,   11}, { 72, 0,   711,    0}, { 79, 0,   712,    1},
+    { 97, 0,   713,    3}, { 99, 0,   716,    7}, {100, 0,   720,   12},
+    {101, 0,   721,   13}, {102, 0,   688,   15}, {104, 0,   723,   16},
+    {105, 0,   724,   17}, {108, 0,   725,   21}, {111, 0,   726,   24},
+    {114, 0,   730,   32}, {115, 0,   709,   33}, {117, 1,   731,   34},
+    { 68, 0,   732,    0}, { 74, 0,   711,    2}, { 83, 0,   711,    3},
+    { 90, 0,   711,    4}, { 97, 0,   734,    5}, { 99, 0,   737,    8},
+    {101, 0,   739,   10}, {102, 0,   688,   12}, {105, 0,   740,   13},
+    {111, 0,   742,   20}, {115, 1,   746,   52}, { 78, 0,   748,    0},
+    { 84, 0,   749,    1}, { 97, 0,   684,    3}, { 99, 0,   750,    5},
+    {100, 0,   720,    9}, {102, 0,   688,   10}, {103, 0,   689,   11},
+    {108, 0,   753,   13}, {109, 0,   754,   14}, {111, 0,   693,   17},
+    {112, 0,   756,   19}, {113, 0,   757,   20}, {115, 0,   758,   23},
+    {116, 0,   760,   25}, {117, 0,   700,   26}, {120, 1,   761,   28},
+    { 99, 0,   703,    0}, {102, 0,   688,    1}, {105, 0,   763,    2},
+    {111, 0,   764,    4}, {115, 1,   709,    7}, { 74, 0,   711,    0},
+    { 84, 2,   767,    1}, { 97, 0,   768,    3}, { 98, 0,   685,    5},
+    { 99, 0,   769,    6}, {100, 0,   720,    9}, {102, 0,   688,   10},
+    {103, 0,   772,   11}, {111, 0,   707,   12}, {114, 0,   773,   13},
+    {115, 0,   709,   20}, {116, 1,   772,   21}, { 65, 0,   774,    0},
+    { 97, 0,   775,    1}, { 99, 0,   777,    3}, {102, 0,   688,    4},
+    {105, 0,   778,    5}, {111, 0,   779,    6}, {115, 0,   746,    8},
+    {117, 1,   781,   10}, { 69, 0,   711,    0}, { 74, 0,   782,    1},
+    { 79, 0,   711,    2}, { 97, 0,   684,    3}, { 99, 0,   686,    5},
+    {100, 0,   720,    8}, {102, 0,   688,    9}, {103, 0,   689,   10},
+    {109, 0,   783,   12}, {110, 0,   786,   16}, {111, 0,   788,   21},
+    {115, 0,   709,   24}, {116, 0,   791,   25}, {117, 1,   792,   26},
+    { 99, 0,   794,    0}, {102, 0,   688,    2}, {111, 0,   707,    3},
+    {115, 0,   796,    4}, {117, 1,   798,    6}, { 72, 0,   711,    0},
+    { 74, 0,   711,    1}, { 97, 0,   799,    2}, { 99, 0,   800,    3},
+    {102, 0,   688,    5}, {111, 0,   707,    6}, {115, 1,   709,    7},
+    { 74, 0,   711,    0}, { 84, 2,   767,    1}, { 97, 0,   802,    3},
+    { 99, 0,   807,    8}, {101, 0,   810,   11}, {102, 0,   688,   43},
+    {108, 0,   812,   44}, {109, 0,   814,   46}, {111, 0,   815,   47},
+    {115, 0,   818,   56}, {116, 1,   772,   59}, { 97, 0,   821,    0},
+    { 99, 0,   703,    1}, {101, 0,   822,    2}, {102, 0,   688,    4},
+    {105, 0,   824,    5}, {111, 0,   707,    6}, {115, 0,   709,    7},
+    {117, 1,   772,    8}, { 74, 0,   711,    0}, { 97, 0,   825,    1},
+    { 99, 0,   807,    2}, {101, 0,   826,    5}, {102, 0,   688,   12},
+    {111, 0,   829,   13}, {115, 0,   709,   68}, {116, 0,   699,   69},
+    {117, 1,   772,   71}, { 69, 0,   782,    0}, { 97, 0,   684,    1},
+    { 99, 0,   686,    3}, {100, 0,   833,    6}, {102, 0,   688,    7},
+    {103, 0,   689,    8}, {109, 0,   834,   10}, {111, 0,   707,   13},
+    {112, 0,   837,   14}, {114, 0,   772,   16}, {115, 0,   838,   17},
+    {116, 0,   840,   20}, {117, 0,   700,   23}, {118, 1,   841,   25},
+    { 97, 0,   842,    0}, { 99, 0,   703,    1}, {102, 0,   688,    2},
+    {104, 0,   723,    3}, {105, 0,   772,    4}, {108, 0,   843,    5},
+    {111, 0,   844,    6}, {114, 0,   846,    8}, {115, 1,   850,   17},
+    { 85, 0,   852,    0}, {102, 0,   688,    2}, {111, 0,   707,    3},
+    {115, 1,   709,    4}, { 66, 0,   853,    0}, { 69, 0,   854,    1},
+    { 97, 0,   855,    3}, { 99, 0,   807,    7}, {101, 0,   858,   10},
+    {102, 0,   688,   14}, {104, 0,   860,   15}, {105, 0,   861,   16},
+    {111, 0,   862,   39}, {114, 0,   864,   41}, {115, 0,   865,   42},
+    {117, 1,   867,   44}, { 72, 0,   868,    0}, { 79, 0,   870,    2},
+    { 97, 0,   825,    3}, { 99, 0,   871,    4}, {102, 0,   688,    9},
+    {104, 0,   876,   10}, {105, 0,   877,   14}, {109, 0,   878,   15},
+    {111, 0,   707,   16}, {113, 0,   879,   17}, {115, 0,   709,   25},
+    {116, 0,   881,   26}, {117, 1,   882,   27}, { 72, 0,   886,    0},
+    { 82, 0,   887,    2}, { 83, 0,   888,    3}, { 97, 0,   890,    5},
+    { 99, 0,   807,    7}, {102, 0,   688,   10}, {104, 0,   892,   11},
+    {105, 0,   894,   15}, {111, 0,   707,   19}, {114, 0,   895,   20},
+    {115, 1,   746,   21}, { 97, 0,   896,    0}, { 98, 0,   898,    4},
+    { 99, 0,   686,    6}, {100, 0,   833,    9}, {102, 0,   688,   10},
+    {103, 0,   689,   11}, {109, 0,   691,   13}, {110, 0,   899,   14},
+    {111, 0,   693,   20}, {112, 0,   901,   22}, {114, 0,   909,   35},
+    {115, 0,   709,   36}, {116, 0,   791,   37}, {117, 1,   700,   38},
+    { 68, 0,   910,    0}, { 98, 0,   881,    1}, { 99, 0,   703,    2},
+    {100, 0,   911,    3}, {101, 0,   912,    5}, {102, 0,   688,   13},
+    {111, 0,   707,   14}, {115, 0,   709,   15}, {118, 1,   914,   16},
+    { 99, 0,   777,    0}, {101, 0,   915,    1}, {102, 0,   688,    2},
+    {111, 0,   707,    3}, {115, 1,   709,    4}, {102, 0,   688,    0},
+    {105, 0,   772,    1}, {111, 0,   707,    2}, {115, 1,   709,    3},
+    { 65, 0,   711,    0}, { 73, 0,   711,    1}, { 85, 0,   711,    2},
+    { 97, 0,   684,    3}, { 99, 0,   794,    5}, {102, 0,   688,    7},
+    {111, 0,   707,    8}, {115, 0,   709,    9}, {117, 1,   916,   10},
+    { 72, 0,   711,    0}, { 97, 0,   825,    1}, { 99, 0,   737,    2},
+    {100, 0,   720,    4}, {101, 0,   917,    5}, {102, 0,   688,    7},
+    {111, 0,   707,    8}, {115, 1,   709,    9}, { 97, 0,   684,    0},
+    { 98, 0,   685,    2}, { 99, 0,   919,    3}, {101, 0,   682,   11},
+    {102, 0,   925,   13}, {103, 0,   689,   15}, {108, 0,   927,   17},
+    {109, 0,   929,   20}, {110, 0,   931,   24}, {111, 0,   693,   47},
+    {112, 0,   933,   49}, {114, 0,   696,   57}, {115, 0,   940,   59},
+    {116, 0,   699,   63}, {117, 0,   700,   65}, {119, 1,   943,   67},
+    { 78, 0,   720,    0}, { 97, 0,   945,    1}, { 98, 0,   947,    9},
+    { 99, 0,   948,   11}, {100, 0,   950,   13}, {101, 0,   951,   14},
+    {102, 0,   688,   22}, {105, 0,   956,   23}, {107, 0,   957,   36},
+    {108, 0,   958,   37}, {110, 0,   961,   48}, {111, 0,   963,   51},
+    {112, 0,   967,   99}, {114, 0,   968,  100}, {115, 0,   970,  103},
+    {117, 1,   974,  110}, { 97, 0,   976,    0}, { 99, 0,   979,   10},
+    {100, 0,   720,   17}, {101, 0,   983,   18}, {102, 0,   688,   24},
+    {104, 0,   986,   25}, {105, 0,   989,   29}, {108, 0,   990,   44},
+    {111, 0,   991,   46}, {114, 0,   995,   63}, {115, 0,   997,   65},
+    {116, 0,   999,   70}, {117, 0,  1000,   71}, {119, 0,   943,   96},
+    {121, 1,  1007,   98}, { 65, 0,  1008,    0}, { 72, 0,   881,    1},
+    { 97, 0,  1009,    2}, { 98, 0,  1013,    7}, { 99, 0,   737,    9},
+    {100, 0,  1015,   11}, {101, 0,  1018,   15}, {102, 0,  1021,   19},
+    {104, 0,  1023,   21}, {105, 0,  1024,   23}, {106, 0,   711,   35},
+    {108, 0,  1029,   36}, {111, 0,  1030,   38}, {114, 0,  1035,   51},
+    {115, 0,  1037,   54}, {116, 0,  1040,   58}, {117, 0,  1042,   61},
+    {119, 0,  1044,   63}, {122, 1,  1045,   64}, { 68, 0,  1047,    0},
+    { 97, 0,  1049,    2}, { 99, 0,  1051,    5}, {100, 0,   720,   11},
+    {101, 0,   772,   12}, {102, 0,  1055,   13}, {103, 0,  1057,   15},
+    {108, 0,  1060,   20}, {109, 0,  1064,   25}, {110, 0,  1067,   32},
+    {111, 0,   693,   34}, {112, 0,  1069,   36}, {113, 0,  1072,   42},
+    {114, 0,  1076,   52}, {115, 0,  1078,   54}, {116, 0,  1081,   57},
+    {117, 0,  1083,   60}, {120, 1,  1085,   63}, { 97, 0,  1088,    0},
+    { 99, 0,   703,    1}, {101, 0,  1089,    2}, {102, 0,  1090,    3},
+    {105, 0,   782,    7}, {106, 0,   782,    8}, {108, 0,  1093,    9},
+    {110, 0,  1096,   12}, {111, 0,  1097,   13}, {112, 0,  1099,   17},
+    {114, 0,  1100,   18}, {115, 1,   709,   38}, { 69, 0,  1102,    0},
+    { 97, 0,  1104,    2}, { 98, 0,   685,    6}, { 99, 0,   794,    7},
+    {100, 0,   720,    9}, {101, 0,  1107,   10}, {102, 0,   688,   22},
+    {103, 0,  1111,   23}, {105, 0,  1113,   25}, {106, 0,   711,   26},
+    {108, 0,  1114,   27}, {110, 0,  1118,   31}, {111, 0,   707,   38},
+    {114, 0,  1122,   39}, {115, 0,  1123,   40}, {116, 2,  1125,   44},
+    {118, 1,  1131,   58}, { 65, 0,  1008,    0}, { 97, 0,  1133,    1},
+    { 98, 0,   881,    8}, { 99, 0,   777,    9}, {101, 0,  1137,   10},
+    {102, 0,   688,   14}, {107, 0,  1140,   15}, {111, 0,  1141,   17},
+    {115, 0,  1146,   23}, {121, 1,  1149,   26}, { 97, 0,   684,    0},
+    { 99, 0,  1151,    2}, {101, 0,  1154,    6}, {102, 0,  1156,    9},
+    {103, 0,   689,   11}, {105, 0,  1158,   13}, {106, 0,   782,   18},
+    {109, 0,  1162,   19}, {110, 0,  1165,   26}, {111, 0,  1170,   37},
+    {112, 0,  1174,   41}, {113, 0,  1175,   42}, {115, 0,  1176,   44},
+    {116, 0,  1178,   51}, {117, 1,   792,   53}, { 99, 0,   794,    0},
+    {102, 0,   688,    2}, {109, 0,  1180,    3}, {111, 0,   707,    4},
+    {115, 0,   796,    5}, {117, 1,   798,    7}, { 97, 0,  1181,    0},
+    { 99, 0,   800,    2}, {102, 0,   688,    4}, {103, 0,  1182,    5},
+    {104, 0,   711,    6}, {106, 0,   711,    7}, {111, 0,   707,    8},
+    {115, 1,   709,    9}, { 65, 0,  1183,    0}, { 66, 0,   853,    3},
+    { 69, 0,  1111,    4}, { 72, 0,   881,    6}, { 97, 0,  1186,    7},
+    { 98, 0,  1195,   30}, { 99, 0,  1198,   37}, {100, 0,  1202,   42},
+    {101, 0,  1206,   48}, {102, 0,  1211,   76}, {103, 0,  1214,   79},
+    {104, 0,  1216,   81}, {106, 0,   711,   85}, {108, 0,  1218,   86},
+    {109, 0,  1223,   91}, {110, 0,  1118,   94}, {111, 0,  1225,  101},
+    {112, 0,  1233,  119}, {114, 0,  1234,  121}, {115, 0,  1239,  127},
+    {116, 2,  1245,  137}, {117, 0,  1253,  150}, {118, 1,  1131,  152},
+    { 68, 0,  1254,    0}, { 97, 0,  1255,    1}, { 99, 0,  1259,   12},
+    {100, 0,   910,   14}, {101, 0,  1261,   15}, {102, 0,   688,   16},
+    {104, 0,   860,   17}, {105, 0,  1262,   18}, {108, 0,  1265,   29},
+    {110, 0,  1267,   31}, {111, 0,  1268,   32}, {112, 0,   772,   34},
+    {115, 0,  1270,   35}, {117, 1,  1272,   37}, { 71, 0,  1275,    0},
+    { 76, 0,  1277,    3}, { 82, 0,   864,    8}, { 86, 0,  1280,    9},
+    { 97, 0,  1282,   11}, { 98, 0,  1287,   22}, { 99, 0,  1289,   26},
+    {100, 0,   910,   33}, {101, 0,  1294,   34}, {102, 0,   688,   45},
+    {103, 0,  1301,   46}, {104, 0,  1305,   55}, {105, 0,  1308,   58},
+    {106, 0,   711,   62}, {108, 0,  1311,   63}, {109, 0,  1318,   79},
+    {111, 0,  1319,   80}, {112, 0,  1321,   93}, {114, 0,  1324,  103},
+    {115, 0,  1328,  110}, {116, 0,  1335,  137}, {117, 0,  1339,  145},
+    {118, 0,  1341,  149}, {119, 1,  1350,  163}, { 83, 0,   772,    0},
+    { 97, 0,  1353,    1}, { 99, 0,  1355,    4}, {100, 0,  1357,    8},
+    {101, 0,   782,   13}, {102, 0,  1362,   14}, {103, 0,  1364,   16},
+    {104, 0,  1367,   20}, {105, 0,  1369,   22}, {108, 0,  1370,   23},
+    {109, 0,  1374,   28}, {111, 0,   707,   33}, {112, 0,  1377,   34},
+    {114, 0,  1380,   37}, {115, 0,  1387,   50}, {116, 0,  1390,   54},
+    {117, 0,   700,   58}, {118, 1,  1391,   60}, { 97, 0,  1392,    0},
+    { 99, 0,   703,    7}, {101, 0,  1393,    8}, {102, 0,   688,   13},
+    {104, 0,  1394,   14}, {105, 0,  1397,   18}, {108, 0,  1400,   21},
+    {109, 0,   772,   35}, {111, 0,  1402,   36}, {114, 0,  1405,   40},
+    {115, 0,   850,   66}, {117, 1,  1415,   68}, {102, 0,   688,    0},
+    {105, 0,  1369,    1}, {111, 0,   707,    2}, {112, 0,   967,    3},
+    {115, 0,   709,    4}, {117, 1,  1416,    5}, { 65, 0,  1183,    0},
+    { 66, 0,   853,    3}, { 72, 0,   881,    4}, { 97, 0,  1419,    5},
+    { 98, 0,  1195,   30}, { 99, 0,  1198,   37}, {100, 0,  1426,   42},
+    {101, 0,  1430,   47}, {102, 0,  1211,   54}, {104, 0,  1433,   57},
+    {105, 0,  1435,   62}, {108, 0,  1438,   73}, {109, 0,  1441,   76},
+    {110, 0,  1442,   78}, {111, 0,  1443,   79}, {112, 0,  1447,   86},
+    {114, 0,   853,   89}, {115, 0,  1449,   90}, {116, 0,  1453,   96},
+    {117, 0,  1456,  102}, {120, 1,   772,  103}, { 97, 0,   825,    0},
+    { 98, 0,   950,    1}, { 99, 0,  1457,    2}, {100, 0,  1467,   16},
+    {101, 0,  1468,   19}, {102, 0,  1475,   30}, {104, 0,  1476,   32},
+    {105, 0,  1480,   39}, {108, 0,   853,   53}, {109, 0,  1482,   54},
+    {111, 0,  1486,   62}, {112, 0,  1489,   67}, {113, 0,  1490,   70},
+    {114, 0,   853,   86}, {115, 0,  1493,   87}, {116, 0,  1497,   91},
+    {117, 0,  1499,   96}, {119, 0,  1504,  151}, {122, 1,   682,  156},
+    { 97, 0,  1507,    0}, { 98, 0,  1509,    2}, { 99, 0,   807,    3},
+    {100, 0,   720,    6}, {101, 0,  1510,    7}, {102, 0,   688,    8},
+    {104, 0,  1511,    9}, {105, 0,  1515,   21}, {111, 0,  1518,   28},
+    {112, 0,   967,   35}, {114, 0,  1521,   36}, {115, 0,  1524,   51},
+    {119, 1,  1527,   55}, { 65, 0,  1008,    0}, { 72, 0,   881,    1},
+    { 97, 0,  1529,    2}, { 98, 0,   898,    5}, { 99, 0,   686,    7},
+    {100, 0,  1531,   10}, {102, 0,  1021,   13}, {103, 0,   689,   15},
+    {104, 0,  1534,   17}, {108, 0,  1536,   20}, {109, 0,  1538,   24},
+    {111, 0,   693,   27}, {112, 0,  1540,   29}, {114, 0,  1546,   38},
+    {115, 0,   709,   43}, {116, 0,  1549,   44}, {117, 0,  1552,   48},
+    {119, 1,  1044,   51}, { 65, 0,  1008,    0}, { 66, 0,  1554,    1},
+    { 68, 0,   910,    3}, { 97, 0,  1555,    4}, { 99, 0,   703,   21},
+    {100, 0,   910,   22}, {101, 0,  1557,   23}, {102, 0,   688,   29},
+    {108, 0,  1560,   30}, {110, 0,  1561,   31}, {111, 0,   707,   33},
+    {112, 0,  1562,   34}, {114, 0,  1560,   35}, {115, 0,  1563,   36},
+    {122, 1,  1565,   41}, { 99, 0,   777,    0}, {101, 0,  1566,    1},
+    {102, 0,   688,    5}, {111, 0,   707,    6}, {112, 0,   772,    7},
+    {114, 0,  1568,    8}, {115, 1,   709,   10}, { 99, 0,  1570,    0},
+    {100, 0,  1560,    3}, {102, 0,   688,    4}, {104, 0,  1573,    5},
+    {105, 0,   772,    7}, {108, 0,  1573,    8}, {109, 0,  1575,   10},
+    {110, 0,  1576,   11}, {111, 0,  1577,   12}, {114, 0,  1573,   16},
+    {115, 0,  1580,   18}, {117, 0,  1582,   20}, {118, 0,  1584,   22},
+    {119, 1,  1585,   23}, { 97, 0,  1586,    0}, { 99, 0,   794,    3},
+    {101, 0,  1587,    5}, {102, 0,   688,    7}, {105, 0,   711,    8},
+    {111, 0,   707,    9}, {115, 0,   709,   10}, {117, 1,  1588,   11},
+    { 97, 0,   825,    0}, { 99, 0,   737,    1}, {100, 0,   720,    3},
+    {101, 0,  1590,    4}, {102, 0,   688,    6}, {104, 0,   711,    7},
+    {105, 0,  1592,    8}, {111, 0,   707,    9}, {115, 0,   709,   10},
+    {119, 1,  1593,   11}, {108, 1,  1595,    0}, { 80, 3,   767,    0},
+    { 99, 1,  1596,    0}, {114, 1,   708,    0}, {105, 0,  1597,    0},
+    {121, 1,   772,    2}, {114, 1,   772,    0}, {114, 1,  1598,    0},
+    {112, 1,  1599,    0}, { 97, 1,   709,    0}, {100, 1,   772,    0},
+    {103, 0,  1600,    0}, {112, 1,  1601,    1}, {112, 1,  1602,    0},
+    {105, 1,  1603,    0}, { 99, 0,   688,    0}, {115, 1,  1604,    1},
+    {105, 1,  1605,    0}, {109, 1,  1606,    0}, { 99, 0,  1607,    0},
+    {114, 1,  1608,    1}, {121, 1,   772,    0}, { 99, 0,  1610,    0},
+    {114, 0,  1611,    1}, {116, 1,   760,    2}, {112, 1,  1601,    0},
+    {101, 1,  1612,    0}, { 99, 1,   688,    0}, {109, 1,  1613,    0},
+    { 99, 1,   703,    0}, { 80, 1,  1614,    0}, { 99, 0,  1615,    0},
+    {112, 0,  1616,    1}, {121, 1,  1618,    3}, { 97, 0,  1619,    0},
+    {101, 0,  1620,    1}, {105, 0,  1621,    3}, {111, 1,  1622,    4},
+    {111, 1,  1623,    0}, {100, 0,  1624,    0}, {110, 1,  1625,    1},
+    {105, 1,   772,    0}, {114, 1,  1626,    0}, {111, 1,  1627,    0},
+    {108, 0,  1629,    0}, {110, 0,  1630,    2}, {112, 0,  1633,    5},
+    {117, 1,  1635,    7}, {111, 1,  1636,    0}, {112, 1,  1637,    0},
+    { 59, 6, 65535,    0}, {111, 1,  1639,    1}, {103, 0,  1640,    0},
+    {114, 0,   688,    1}, {115, 1,  1641,    2}, { 97, 0,  1619,    0},
+    {121, 1,   772,    1}, {108, 1,  1642,    0}, { 97, 0,  1644,    0},
+    {102, 1,  1646,    6}, {112, 0,  1601,    0}, {116, 0,  1647,    1},
+    {117, 0,  1650,    4}, {119, 1,  1651,   18}, { 99, 0,   688,    0},
+    {116, 1,  1652,    1}, { 71, 1,   772,    0}, { 72, 3,   767,    0},
+    { 97, 0,  1619,    0}, {105, 0,  1597,    1}, {121, 1,   772,    3},
+    {101, 1,  1653,    0}, { 97, 0,   709,    0}, {112, 1,  1654,    1},
+    {115, 1,  1655,    0}, {117, 1,  1656,    0}, { 99, 0,   688,    0},
+    {105, 1,  1658,    1}, { 97, 1,   772,    0}, {105, 0,  1659,    0},
+    {112, 1,  1660,    1}, {108, 1,  1661,    0}, {112, 0,  1601,    0},
+    {114, 0,  1662,    1}, {117, 1,  1663,    2}, { 59, 7, 65535,    0},
+    {109, 1,  1664,    0}, {101, 0,  1665,    0}, {105, 0,  1621,    1},
+    {121, 1,   772,    2}, { 59, 7, 65535,    0}, {101, 1,  1666,    0},
+    { 82, 1,  1667,    0}, { 99, 0,  1668,    0}, {116, 1,   772,    1},
+    {105, 1,  1621,    0}, {108, 1,  1669,    0}, {112, 0,  1601,    0},
+    {114, 1,  1670,    1}, {109, 1,  1671,    0}, {108, 1,  1672,    0},
+    { 59, 6, 65535,    0}, { 97, 0,  1673,    1}, {112, 1,  1675,    3},
+    {116, 0,  1676,    0}, {118, 1,  1678,    3}, {103, 0,  1600,    0},
+    {112, 0,  1601,    1}, {116, 1,   760,    2}, {105, 1,  1679,    0},
+    {107, 0,   711,    0}, {109, 1,  1606,    1}, {105, 0,  1621,    0},
+    {121, 1,   772,    1}, { 99, 0,   688,    0}, {101, 1,  1680,    1},
+    {107, 1,   711,    0}, {112, 1,  1681,    0}, {101, 0,  1665,    0},
+    {121, 1,   772,    1}, { 99, 0,  1615,    0}, {109, 0,  1682,    1},
+    {110, 0,  1683,    2}, {112, 0,  1684,    3}, {114, 1,   688,    4},
+    { 97, 0,  1619,    0}, {101, 0,  1665,    1}, {121, 1,   772,    2},
+    {102, 0,  1685,    0}, {115, 1,  1686,   26}, { 59, 6, 65535,    0},
+    {101, 1,  1687,    1}, {105, 1,   999,    0}, {110, 0,  1688,    0},
+    {112, 0,  1601,    6}, {119, 1,  1689,    7}, { 99, 0,   688,    0},
+    {104, 0,   772,    1}, {116, 1,  1652,    2}, {112, 1,   772,    0},
+    {100, 0,  1690,    0}, {108, 1,  1691,    1}, {110, 1,  1692,    0},
+    { 99, 1,  1615,    0}, {103, 0,  1693,    0}, {115, 0,  1694,    4},
+    {119, 1,  1695,    6}, { 66, 0,  1696,    0}, {110, 0,  1697,    1},
+    {112, 0,  1601,    2}, {116, 1,  1698,    3}, { 98, 1,  1711,    0},
+    { 97, 0,   709,    0}, {101, 0,  1712,    1}, {105, 1,  1713,    2},
+    {101, 1,  1714,    0}, { 99, 0,   688,    0}, {108, 1,  1715,    1},
+    {105, 1,  1716,    0}, {101, 1,  1718,    0}, {114, 1,  1719,    0},
+    {117, 1,  1720,    0}, {105, 0,  1721,    0}, {112, 1,  1601,    1},
+    { 59, 6, 65535,    0}, {101, 0,  1722,    1}, {105, 0,  1723,    5},
+    {111, 1,  1724,    6}, { 99, 0,   688,    0}, {105, 1,   772,    1},
+    { 79, 1,  1726,    0}, { 97, 1,  1008,    0}, { 71, 3,   767,    0},
+    { 99, 0,  1615,    0}, {110, 0,  1683,    1}, {114, 1,  1727,    2},
+    { 59, 6, 65535,    0}, {118, 1,  1728,    1}, {111, 1,   772,    0},
+    {103, 1,  1729,    0}, {112, 0,  1601,    0}, {117, 1,  1730,    1},
+    {105, 1,  1731,    0}, { 99, 0,   688,    0}, {104, 1,   772,    1},
+    {108, 1,  1732,    0}, { 67, 0,  1733,    0}, { 99, 1,   703,    1},
+    { 70, 1,  1734,    0}, { 59, 6, 65535,    0}, { 97, 0,  1619,    1},
+    {101, 0,  1665,    2}, {105, 0,  1621,    3}, {121, 1,   772,    4},
+    {111, 1,  1735,    0}, {103, 1,  1736,    0}, { 97, 1,  1737,    0},
+    {114, 0,  1623,    0}, {117, 1,  1738,    1}, { 97, 1,   688,    0},
+    { 98, 0,  1739,    0}, { 99, 0,  1741,    3}, {109, 0,   772,    8},
+    {112, 1,  1743,    9}, { 79, 1,  1746,    0}, { 65, 1,  1747,    0},
+    { 72, 0,   711,    0}, { 99, 1,   703,    1}, { 98, 0,   772,    0},
+    {117, 1,   772,    1}, {101, 0,  1748,    0}, {105, 1,  1750,    2},
+    {108, 1,  1752,    0}, {105, 1,  1753,    0}, { 99, 0,  1596,    0},
+    {114, 1,  1754,    2}, {114, 1,  1755,    0}, {100, 0,   841,    0},
+    {105, 1,  1757,    4}, { 65, 0,  1758,    0}, { 68, 0,  1759,    3},
+    { 69, 0,  1760,    4}, { 84, 0,  1761,    5}, { 97, 0,  1762,    7},
+    {100, 0,  1763,    8}, {112, 0,  1689,    9}, {115, 1,  1764,   11},
+    {105, 1,  1765,    0}, { 97, 1,  1766,    0}, { 97, 1,  1767,    0},
+    {101, 0,   772,    0}, {114, 1,  1768,    1}, {100, 1,   910,    0},
+    {100, 1,  1771,    0}, {109, 1,  1772,    0}, {114, 0,  1773,    0},
+    {116, 1,   760,    1}, { 59, 6, 65535,    0}, { 69, 0,   772,    1},
+    {100, 0,   772,    2}, {105, 0,  1597,    3}, {117, 0,  1774,    5},
+    {121, 1,   772,    7}, { 59, 6, 65535,    0}, {114, 1,   772,    1},
+    {101, 0,  1775,    0}, {112, 1,  1599,    2}, { 97, 0,  1777,    0},
+    {112, 3,   767,    2}, {100, 0,  1779,    0}, {103, 1,  1784,    5},
+    { 59, 6, 65535,    0}, { 69, 0,   772,    1}, { 97, 0,  1791,    2},
+    {101, 0,   772,    3}, {105, 0,   692,    4}, {111, 0,  1792,    5},
+    {112, 1,  1793,    6}, { 99, 0,   688,    0}, {116, 0,   772,    1},
+    {121, 1,  1794,    2}, { 99, 0,  1795,    0}, {105, 1,  1369,    1},
+    { 99, 0,  1796,    0}, {114, 1,  1797,    5}, {114, 1,  1799,    0},
+    {111, 0,  1765,    0}, {121, 1,   772,    1}, {113, 1,  1800,    0},
+    { 99, 0,  1801,    0}, {109, 0,  1802,    2}, {112, 0,  1803,    3},
+    {114, 0,  1804,    4}, {116, 1,  1805,    5}, {103, 1,  1808,    0},
+    { 97, 1,  1815,    0}, { 97, 0,  1816,    0}, {107, 0,  1818,    7},
+    {111, 1,  1820,   10}, {101, 0,  1821,    0}, {111, 1,  1623,    2},
+    {112, 0,  1601,    0}, {116, 0,  1823,    1}, {119, 0,  1825,    3},
+    {120, 1,  1826,    4}, {114, 1,  1838,    0}, {101, 0,  1612,    0},
+    {118, 1,  1839,    1}, { 99, 0,   688,    0}, {101, 0,  1840,    1},
+    {105, 0,  1841,    2}, {111, 1,  1842,    4}, {108, 0,  1843,    0},
+    {109, 1,  1844,    2}, { 99, 0,  1615,    0}, {112, 0,  1845,    1},
+    {114, 1,  1851,    8}, { 97, 0,  1853,    0}, {101, 0,  1620,    2},
+    {105, 0,  1621,    4}, {117, 1,  1855,    5}, {100, 0,  1856,    0},
+    {109, 0,  1802,    2}, {110, 1,  1857,    3}, { 99, 0,   703,    0},
+    {101, 0,  1858,    1}, {105, 1,   772,    3}, {114, 1,  1859,    0},
+    {117, 1,  1866,    0}, {108, 0,  1867,    0}, {109, 0,  1868,    3},
+    {110, 0,  1870,    9}, {112, 1,  1872,   12}, { 97, 0,  1008,    0},
+    {111, 1,  1636,    1}, { 99, 0,   688,    0}, {117, 1,  1875,    1},
+    {100, 1,   720,    0}, {100, 0,  1877,    0}, {101, 0,  1878,    2},
+    {108, 0,  1880,    4}, {112, 0,  1881,    6}, {114, 0,  1887,   13},
+    {118, 0,  1584,   23}, {119, 1,  1891,   24}, {108, 1,  1892,    0},
+    {114, 1,   688,    0}, {103, 0,  1640,    0}, {108, 0,  1893,    1},
+    {114, 0,   688,    2}, {115, 1,  1894,    3}, {107, 0,   957,    0},
+    {108, 1,  1895,    1}, { 59, 6, 65535,    0}, { 97, 0,  1896,    1},
+    {111, 1,  1898,    3}, {103, 2,   767,    0}, {108, 0,  1899,    2},
+    {109, 1,  1802,    3}, {105, 0,  1900,    0}, {114, 1,   772,    1},
+    { 97, 1,  1901,    0}, { 97, 0,  1902,    0}, {101, 0,   772,    4},
+    {103, 0,  1903,    5}, {115, 0,  1904,    6}, {118, 1,  1905,    7},
+    { 99, 1,  1908,    0}, {108, 0,  1910,    0}, {112, 0,  1601,    1},
+    {116, 0,  1911,    2}, {117, 0,  1916,    8}, {119, 1,  1917,    9},
+    { 98, 0,  1918,    0}, { 99, 1,  1908,    1}, { 99, 0,  1919,    0},
+    {111, 0,  1772,    2}, {116, 1,  1652,    3}, {100, 0,   720,    0},
+    {114, 1,  1921,    1}, { 97, 0,  1008,    0}, {104, 1,   881,    1},
+    { 97, 1,  1922,    0}, { 99, 0,   703,    0}, {105, 1,  1592,    1},
+    { 68, 0,   720,    0}, {111, 1,  1623,    1}, { 99, 0,  1596,    0},
+    {115, 1,  1923,    2}, { 97, 0,  1619,    0}, {105, 0,  1924,    1},
+    {111, 0,  1925,    4}, {121, 1,   772,    5}, { 68, 0,   720,    0},
+    {114, 1,   772,    1}, { 59, 6, 65535,    0}, {114, 0,  1598,    1},
+    {115, 1,  1926,    3}, { 59, 6, 65535,    0}, {105, 0,  1928,    1},
+    {108, 0,   772,    2}, {115, 1,  1926,    3}, { 97, 0,   709,    0},
+    {112, 0,  1929,    1}, {115, 1,  1930,    4}, {103, 0,   772,    0},
+    {115, 1,   821,    1}, { 97, 0,  1931,    0}, {108, 0,  1932,    2},
+    {115, 1,  1933,    3}, { 99, 0,  1934,    0}, {115, 0,  1936,    2},
+    {117, 0,  1938,    5}, {118, 1,  1941,    9}, { 68, 0,   720,    0},
+    { 97, 1,  1008,    1}, { 99, 0,   688,    0}, {100, 0,   720,    1},
+    {105, 1,  1658,    2}, { 97, 0,   772,    0}, {104, 3,   767,    1},
+    {109, 0,  1606,    0}, {114, 1,   860,    2}, { 99, 0,  1772,    0},
+    {105, 0,  1942,    1}, {112, 1,  1943,    2}, {108, 1,  1945,    0},
+    {109, 1,  1946,    0}, {105, 0,   782,    0}, {108, 0,  1947,    1},
+    {114, 1,   772,    3}, { 97, 0,  1623,    0}, {108, 0,  1672,    1},
+    {116, 1,  1949,    2}, {111, 1,  1601,    0}, {112, 0,  1601,    0},
+    {114, 1,  1950,    1}, { 97, 1,  1952,    0}, { 97, 0,  1953,    0},
+    {111, 1,  1955,   19}, { 59, 6, 65535,    0}, {108, 1,   772,    1},
+    { 99, 0,  1615,    0}, {109, 0,  1664,    1}, {112, 1,   772,    3},
+    { 59, 6, 65535,    0}, {108, 0,   772,    1}, {113, 0,  1956,    2},
+    {115, 1,  1959,    5}, { 59, 6, 65535,    0}, {103, 1,   772,    1},
+    {109, 1,  1963,    0}, { 59, 6, 65535,    0}, { 69, 0,   772,    1},
+    { 97, 0,   772,    2}, {106, 1,   772,    3}, { 69, 0,   772,    0},
+    { 97, 0,  1964,    1}, {101, 0,  1965,    3}, {115, 1,  1967,    6},
+    { 97, 1,  1612,    0}, { 99, 0,   688,    0}, {105, 1,  1968,    1},
+    { 59, 6, 65535,    0}, { 99, 0,  1969,    1}, {100, 0,   720,    3},
+    {108, 0,  1971,    4}, {113, 0,  1972,    5}, {114, 1,  1973,    6},
+    {101, 0,  1978,    0}, {110, 1,  1979,    1}, {105, 0,  1980,    0},
+    {108, 0,  1601,    1}, {109, 0,  1981,    2}, {114, 1,  1982,    3},
+    { 97, 0,  1984,    0}, {108, 0,  1985,    2}, {114, 1,  1986,    3},
+    {115, 1,  1987,    0}, { 97, 0,  1008,    0}, {109, 0,  1989,    1},
+    {111, 0,  1990,    2}, {112, 0,  1601,    4}, {114, 1,  1391,    5},
+    { 99, 0,   688,    0}, {108, 0,   910,    1}, {116, 1,  1652,    2},
+    { 98, 0,  1991,    0}, {112, 1,  1992,    1}, { 59, 6, 65535,    0},
+    {105, 0,  1597,    1}, {121, 1,   772,    3}, { 99, 0,   703,    0},
+    {120, 1,  1993,    1}, {102, 0,   772,    0}, {114, 1,   772,    1},
+    { 59, 6, 65535,    0}, {105, 0,  1994,    1}, {110, 0,  1996,    3},
+    {111, 1,  1899,    4}, { 97, 0,  1997,    0}, {111, 0,  1601,    5},
+    {112, 1,  1891,    6}, { 59, 6, 65535,    0}, { 99, 0,  2000,    1},
+    {102, 0,  2001,    2}, {111, 0,   999,    4}, {116, 1,  2002,    5},
+    { 99, 0,   703,    0}, {103, 0,  1600,    1}, {112, 0,  1601,    2},
+    {116, 1,   760,    3}, {114, 1,  2007,    0}, {117, 1,  2008,    0},
+    { 99, 0,   688,    0}, {105, 1,  2009,    1}, { 59, 6, 65535,    0},
+    {105, 1,  1679,    1}, { 97, 1,  2010,    0}, {112, 1,  2011,    0},
+    {114, 1,  2012,    0}, { 97, 0,  1008,    0}, {114, 0,   688,    1},
+    {116, 1,  2013,    2}, { 99, 0,  1615,    0}, {101, 0,  2014,    1},
+    {103, 0,  2015,    2}, {109, 0,  1682,    3}, {110, 0,  2016,    4},
+    {112, 0,   772,    7}, {113, 0,  2017,    8}, {114, 0,  2018,   10},
+    {116, 1,  2019,   19}, { 97, 0,  1008,    0}, { 98, 0,  1509,    1},
+    {114, 1,  2022,    2}, { 97, 0,  1619,    0}, {101, 0,  2024,    1},
+    {117, 0,  2026,    3}, {121, 1,   772,    4}, { 99, 0,   760,    0},
+    {113, 0,  2027,    1}, {114, 0,  2028,    3}, {115, 1,  2030,    5},
+    { 59, 6, 65535,    0}, {102, 0,  2031,    1}, {103, 0,   772,   11},
+    {113, 0,  1956,   12}, {115, 1,  2032,   15}, {105, 0,  1900,    0},
+    {108, 0,  2037,    1}, {114, 1,   772,    2}, { 59, 6, 65535,    0},
+    { 69, 1,   772,    1}, { 97, 0,  2038,    0}, { 98, 1,  2039,    3},
+    { 59, 6, 65535,    0}, { 97, 0,  1008,    1}, { 99, 0,  2040,    2},
+    {104, 0,  2041,    3}, {116, 1,  2042,    4}, {105, 0,   999,    0},
+    {111, 1,  2043,    1}, { 97, 0,  2044,    0}, { 98, 0,  1509,    2},
+    {110, 0,  2046,    3}, {111, 0,  2047,    7}, {112, 0,  2048,    9},
+    {116, 0,  2051,   12}, {119, 0,  2052,   13}, {122, 1,  2054,   15},
+    { 97, 1,  2057,    0}, { 97, 0,  1008,    0}, { 99, 0,  2040,    1},
+    {104, 0,  2058,    2}, {109, 0,   772,    4}, {116, 1,  2042,    5},
+    { 97, 0,   950,    0}, { 99, 0,   688,    1}, {104, 0,   772,    2},
+    {105, 0,  2059,    3}, {113, 0,  2060,    6}, {116, 1,  1652,    9},
+    { 59, 6, 65535,    0}, { 99, 0,  1969,    1}, {100, 0,   720,    3},
+    {104, 0,  2062,    4}, {105, 0,  2063,    5}, {108, 0,   853,    6},
+    {113, 0,  1972,    7}, {114, 1,  2064,    8}, {114, 1,  2066,    0},
+    { 68, 1,   720,    0}, { 99, 0,  2068,    0}, {108, 0,  2069,    2},
+    {112, 0,  2071,    5}, {114, 1,  2073,   10}, {111, 0,  2074,    0},
+    {121, 1,   772,    1}, { 97, 1,  2075,    0}, { 99, 0,  2076,    0},
+    {100, 0,  2077,    2}, {110, 1,  2081,    7}, { 99, 0,   821,    0},
+    {100, 1,   688,    1}, {112, 1,  2082,    0}, {100, 0,  2083,    0},
+    {112, 1,  1601,    1}, { 99, 0,   688,    0}, {116, 1,  2084,    1},
+    { 59, 6, 65535,    0}, {108, 0,  2085,    1}, {109, 1,  1575,    2},
+    {103, 0,   772,    0}, {116, 1,  2086,    1}, {101, 0,  2088,    0},
+    {108, 0,   772,    2}, {116, 1,  2086,    3}, { 68, 0,   910,    0},
+    {100, 1,   910,    1}, { 98, 0,  2089,    0}, { 99, 0,  1615,    1},
+    {110, 0,  1683,    2}, {112, 0,  2090,    3}, {116, 1,  2095,    8},
+    {115, 0,  2096,    0}, {117, 1,  2097,    2}, { 97, 0,  2098,    0},
+    {101, 0,  1665,    2}, {111, 0,  2100,    3}, {117, 0,   821,    5},
+    {121, 1,   772,    6}, { 59, 6, 65535,    0}, { 65, 0,  1008,    1},
+    { 97, 0,  2101,    2}, {100, 0,   720,    5}, {113, 0,  2102,    6},
+    {115, 0,  2103,    7}, {120, 1,  2105,    9}, { 69, 0,   772,    0},
+    {101, 0,  2106,    1}, {115, 0,  1967,    6}, {116, 1,   925,    7},
+    { 65, 0,  1008,    0}, { 97, 0,  1008,    1}, {112, 1,   881,    2},
+    { 59, 6, 65535,    0}, {115, 0,  2109,    1}, {118, 1,   772,    3},
+    { 65, 0,  1008,    0}, { 69, 0,   772,    1}, { 97, 0,  1008,    2},
+    {100, 0,   688,    3}, {101, 0,  2111,    4}, {115, 0,  1967,   12},
+    {116, 1,  2115,   13}, {105, 1,   692,    0}, {112, 0,  1601,    0},
+    {116, 3,  2117,    1}, { 97, 0,  2120,    0}, {111, 0,  2121,    4},
+    {114, 1,  2122,    5}, { 65, 0,  1008,    0}, { 97, 0,  2125,    1},
+    {105, 0,  1731,    4}, {116, 1,  2126,    5}, { 99, 0,  2127,    0},
+    {104, 0,  2131,    4}, {105, 0,  2132,    6}, {109, 0,  1318,    9},
+    {112, 0,   881,   10}, {113, 0,  2133,   11}, {117, 1,  2134,   13},
+    {103, 0,  1772,    0}, {105, 0,  1605,    1}, {108, 0,  1683,    3},
+    {114, 1,  2137,    4}, { 59, 6, 65535,    0}, {109, 1,  2138,    1},
+    { 68, 0,   910,    0}, { 72, 0,   853,    1}, { 97, 0,   821,    2},
+    {100, 0,   910,    3}, {103, 0,  2141,    4}, {105, 0,  2143,    6},
+    {108, 0,  2144,    7}, {114, 0,  2147,   11}, {115, 1,  1967,   13},
+    { 65, 0,  1008,    0}, { 97, 0,  2101,    1}, {110, 1,  2149,    4},
+    { 99, 0,  1596,    0}, {115, 1,  1623,    2}, {105, 0,  1924,    0},
+    {121, 1,   772,    3}, { 97, 0,  1766,    0}, { 98, 0,  1711,    1},
+    {105, 0,  2150,    2}, {111, 0,  1623,    3}, {115, 1,  2151,    4},
+    { 99, 0,  2152,    0}, {114, 1,   772,    1}, {111, 0,  2153,    0},
+    {114, 0,  1598,    1}, {116, 1,   772,    3}, { 98, 0,   881,    0},
+    {109, 1,   772,    1}, {110, 1,  1623,    0}, { 97, 0,  1008,    0},
+    { 99, 0,  2154,    1}, {105, 0,  2156,    3}, {116, 1,   772,    4},
+    { 97, 0,   709,    0}, {101, 0,  1712,    1}, {105, 1,  2157,    2},
+    { 97, 0,   688,    0}, {101, 0,  2160,    1}, {108, 1,  1932,    2},
+    { 59, 6, 65535,    0}, { 97, 0,  1008,    1}, {100, 0,  2161,    2},
+    {105, 0,  2165,    9}, {111, 0,   688,   10}, {115, 0,  2166,   11},
+    {118, 1,   772,   12}, { 99, 0,   688,    0}, {108, 0,  1715,    1},
+    {111, 1,  1772,    3}, {105, 1,  2167,    0}, { 98, 1,   881,    0},
+    {114, 1,  2169,    0}, {114, 1,  2173,    0}, {105, 0,  2086,    0},
+    {109, 0,  2178,    2}, {111, 1,  2156,    3}, { 59, 6, 65535,    0},
+    {116, 0,  2179,    1}, {118, 1,   772,    2}, { 97, 0,  2180,    0},
+    {117, 1,  2181,    3}, {105, 0,  2182,    0}, {112, 0,  1601,    1},
+    {117, 1,  2183,    2}, { 59, 6, 65535,    0}, { 69, 0,   772,    1},
+    { 97, 0,   821,    2}, { 99, 0,  2184,    3}, {101, 0,  2185,    4},
+    {105, 0,  2187,   13}, {110, 0,  2188,   15}, {111, 0,  2191,   18},
+    {115, 0,  1967,   24}, {117, 1,  2194,   25}, {110, 1,  2195,    0},
+    { 97, 0,  2196,    0}, {101, 0,  2197,    2}, {111, 1,  2198,    4},
+    { 99, 0,  2199,    0}, {100, 0,  2201,    2}, {101, 0,  2014,    3},
+    {110, 0,  2202,    4}, {113, 0,  2017,    8}, {114, 0,  2203,   10},
+    {116, 1,  2204,   22}, { 99, 0,   760,    0}, {108, 0,  2206,    1},
+    {113, 0,  2027,    2}, {115, 1,  2030,    4}, { 97, 0,  2207,    0},
+    { 99, 0,  1623,    4}, {103, 3,   767,    5}, { 97, 0,  2038,    0},
+    {111, 1,  2086,    3}, {103, 0,  2208,    0}, {110, 0,  1683,    9},
+    {115, 1,  2209,   10}, { 97, 0,  1008,    0}, {104, 0,   881,    1},
+    {109, 1,   772,    2}, {111, 1,  2043,    0}, {109, 1,  1318,    0},
+    { 97, 0,  2044,    0}, { 98, 0,  1509,    2}, {112, 0,  2048,    3},
+    {116, 1,  2051,    6}, { 97, 0,  2210,    0}, {112, 1,  2211,    2},
+    { 97, 0,   950,    0}, { 99, 0,   688,    1}, {104, 0,   772,    2},
+    {113, 1,  2060,    3}, {104, 0,  2062,    0}, {105, 0,  2063,    1},
+    {114, 1,  2212,    2}, {108, 1,  2213,    0}, { 59, 6, 65535,    0},
+    { 69, 0,   772,    1}, { 97, 0,  2098,    2}, { 99, 0,  2184,    4},
+    {101, 0,  2214,    5}, {105, 0,  1621,    7}, {110, 0,  2188,    8},
+    {112, 0,  2211,   11}, {115, 0,  1967,   12}, {121, 1,   772,   13},
+    {111, 1,  2216,    0}, { 65, 0,  1008,    0}, { 97, 0,  2101,    1},
+    { 99, 0,  2198,    4}, {109, 0,   723,    6}, {115, 0,  2217,    7},
+    {116, 0,  2218,    8}, {120, 1,  1623,   10}, {114, 1,  2219,    0},
+    { 97, 0,  2160,    0}, { 99, 0,  2221,    1}, {111, 0,  2223,    3},
+    {121, 3,   767,    5}, {103, 0,  2224,    0}, {109, 1,  2225,    3},
+    { 97, 0,  2233,    0}, {101, 0,  1941,    2}, {105, 0,  2235,    3},
+    {116, 1,  2237,    5}, {102, 0,  2239,    0}, {108, 0,  2240,    1},
+    {112, 1,  1601,    4}, { 97, 1,  2242,    0}, { 99, 0,  2244,    0},
+    {115, 0,  2246,    4}, {117, 1,  2247,   12}, { 99, 0,   688,    0},
+    {101, 0,  2250,    1}, {109, 0,  2251,    2}, {116, 1,  2252,    3},
+    { 97, 0,  2253,    0}, {114, 1,  2254,    2}, { 98, 0,  2256,    0},
+    { 99, 0,  2265,   18}, {109, 0,   772,   26}, {110, 0,  1683,   27},
+    {112, 1,  2266,   28}, { 65, 0,  1008,    0}, { 97, 0,  2101,    1},
+    {110, 1,  2217,    4}, {114, 0,  2279,    0}, {117, 1,   772,    1},
+    {114, 1,  2280,    0}, {108, 1,  2281,    0}, {101, 0,  2282,    0},
+    {105, 0,  2284,    5}, {107, 0,  2286,    8}, {111, 1,  2288,   10},
+    {108, 0,  2289,    0}, {109, 0,  2290,    1}, {110, 1,  1623,    6},
+    {101, 0,   760,    0}, {112, 0,  2291,    1}, {115, 1,   760,    6},
+    { 97, 0,  2289,    0}, {105, 0,  2295,    1}, {112, 1,  2302,   14},
+    { 99, 0,  1919,    0}, {104, 0,   711,    2}, {116, 1,  1652,    3},
+    {105, 0,  2303,    0}, {111, 1,  2304,    1}, { 99, 0,  1596,    0},
+    {114, 1,   688,    2}, { 97, 0,  1008,    0}, { 98, 0,  1711,    1},
+    {104, 1,   881,    2}, { 97, 0,  1901,    0}, { 98, 1,  2039,    2},
+    { 99, 0,  2305,    0}, {116, 1,  2042,    3}, { 97, 0,   709,    0},
+    {108, 3,   767,    1}, { 97, 0,  1762,    0}, {100, 0,  1763,    1},
+    {104, 0,  2307,    2}, {108, 0,  1932,    4}, {115, 0,  2308,    5},
+    {117, 1,  2309,    8}, { 99, 0,  2305,    0}, {105, 0,  1765,    3},
+    {116, 1,  2042,    4}, {100, 0,   720,    0}, {105, 0,  1679,    1},
+    {114, 1,  1921,    2}, { 97, 0,  1008,    0}, {109, 1,  1606,    1},
+    { 97, 1,  2310,    0}, {110, 0,  2311,    0}, {114, 1,  2312,    1},
+    {101, 0,  2319,    0}, {108, 0,  1985,    3}, {114, 1,  2322,    4},
+    {116, 1,  2042,    0}, {115, 1,  2324,    0}, {114, 1,  2325,    0},
+    { 99, 0,   688,    0}, {117, 1,  2326,    1}, {105, 1,  2328,    0},
+    {100, 0,  2329,    0}, {105, 1,  2331,    3}, { 59, 6, 65535,    0},
+    {101, 1,  1180,    1}, { 97, 0,   821,    0}, {105, 0,  1621,    1},
+    {117, 1,   821,    2}, { 65, 0,  1008,    0}, { 97, 1,  1008,    1},
+    { 97, 1,   821,    0}, {105, 1,  1792,    0}, {100, 0,   720,    0},
+    {112, 0,  2332,    1}, {116, 1,  1838,    3}, { 99, 0,   688,    0},
+    {113, 1,  2334,    1}, {112, 0,  2082,    0}, {116, 1,  2042,    1},
+    {101, 1,  2335,    0}, {101, 1,   915,    0}, { 99, 1,  2336,    0},
+    {110, 3,   767,    0}, { 99, 0,   703,    0}, {109, 1,  1606,    1},
+    {101, 0,  2338,    0}, {116, 1,   760,    1}, {103, 1,  2339,    0},
+    {106, 0,   772,    0}, {110, 1,  2340,    1}, {105, 1,  2341,    0},
+    {117, 1,  1774,    0}, {114, 1,  2342,    0}, { 97, 1,  2343,    0},
+    {104, 1,   760,    0}, {111, 1,  2153,    0}, {102, 1,   772,    0},
+    {108, 1,  2344,    0}, {110, 1,  2341,    0}, {105, 1,  2345,    0},
+    {108, 1,  2346,    0}, {108, 3,   767,    0}, {107, 1,  2347,    0},
+    {118, 0,   772,    0}, {119, 1,  1891,    1}, { 97, 1,  2348,    0},
+    {110, 1,  2349,    0}, {118, 1,  2335,    0}, {112, 1,  2350,    0},
+    { 89, 3,   767,    0}, {117, 1,  2351,    0}, { 59, 6, 65535,    0},
+    {105, 1,  2352,    1}, {108, 1,  2353,    0}, {114, 1,  1600,    0},
+    {100, 1,  1856,    0}, {114, 1,  2354,    0}, {110, 1,  2355,    0},
+    {116, 1,   772,    0}, {105, 1,  2356,    0}, {116, 1,  2357,    0},
+    { 99, 1,  2358,    0}, { 99, 0,  2359,    0}, {115, 1,  2360,    1},
+    {111, 1,  2361,    0}, {103, 0,  2362,    0}, {105, 0,  1369,    1},
+    {116, 1,  2363,    2}, {102, 0,   772,    0}, {114, 1,  2364,    1},
+    {110, 1,  2365,    0}, {115, 1,  1792,    0}, { 59, 6, 65535,    0},
+    { 67, 1,  1575,    1}, {116, 1,  2366,    0}, {103, 1,  2367,    0},
+    {104, 1,  2150,    0}, { 59, 6, 65535,    0}, {116, 1,   760,    1},
+    { 99, 0,  2368,    0}, {109, 1,  2369,    5}, {102, 1,  2370,    0},
+    { 59, 6, 65535,    0}, { 68, 0,   720,    1}, { 69, 1,  2371,    2},
+    { 98, 1,  2372,    0}, {110, 1,  2373,    0}, {114, 1,  2379,    0},
+    {109, 1,  2380,    0}, {116, 1,  2381,    0}, {105, 1,  1925,    0},
+    { 97, 0,  2382,    0}, {105, 1,  2383,    2}, {109, 1,   772,    0},
+    {115, 1,  2384,    0}, {111, 1,  2385,    0}, {108, 1,  2386,    0},
+    { 65, 1,  2387,    0}, {114, 1,  2388,    0}, {109, 1,  2389,    0},
+    {100, 1,  2390,    0}, { 97, 1,  2391,    0}, { 68, 1,   711,    0},
+    {101, 1,  2280,    0}, { 98, 1,  2392,    0}, {105, 1,  2393,    0},
+    {112, 1,  2394,    0}, {105, 1,  1683,    0}, { 99, 0,   688,    0},
+    {103, 1,  2396,    1}, {108, 1,  2397,    0}, { 59, 6, 65535,    0},
+    {101, 1,  2398,    1}, {105, 1,  2400,    0}, {108, 1,  2289,    0},
+    {114, 1,   711,    0}, {112, 1,   760,    0}, { 98, 1,  2401,    0},
+    {103, 1,   772,    0}, {108, 1,  2402,    0}, {116, 1,  2403,    0},
+    {115, 1,  2413,    0}, {102, 1,  2419,    0}, {103, 1,  2420,    0},
+    {101, 1,  2424,    0}, {105, 1,  2425,    0}, {108, 1,  2426,    0},
+    {117, 1,  2427,    0}, { 97, 1,  2428,    0}, {116, 1,  2429,    0},
+    { 76, 1,  2430,    0}, {114, 1,  2431,    0}, { 66, 1,  2432,    0},
+    { 59, 6, 65535,    0}, { 67, 0,  2433,    1}, { 68, 0,  2435,    3},
+    { 69, 0,  2436,    4}, { 71, 0,  2439,    8}, { 72, 0,  2440,   15},
+    { 76, 0,  2441,   17}, { 78, 0,  2442,   26}, { 80, 0,  2443,   28},
+    { 82, 0,  2444,   31}, { 83, 0,  2446,   35}, { 84, 0,  2448,   47},
+    { 86, 1,  2449,   51}, {108, 1,  1895,    0}, {103, 1,   760,    0},
+    { 99, 1,  1619,    0}, {110, 1,  2450,    0}, { 97, 1,  2451,    0},
+    {108, 0,  2346,    0}, {109, 1,  2452,    2}, {114, 1,  2453,    0},
+    {116, 1,  2455,    0}, {115, 1,  2456,    0}, {110, 1,  2457,    0},
+    { 99, 1,  2458,    0}, {109, 1,  2335,    0}, {100, 0,  2459,    0},
+    {112, 1,  2460,    1}, { 84, 3,   767,    0}, {114, 1,  2461,    0},
+    {101, 1,  2463,    0}, {104, 1,  2464,    0}, {110, 1,  2465,    0},
+    {103, 1,  2466,    0}, {101, 1,  2467,    0}, { 72, 1,   711,    0},
+    { 84, 1,   711,    0}, {114, 1,  2468,    0}, {109, 1,   760,    0},
+    {108, 1,  2469,    0}, { 97, 1,  2470,    0}, { 59, 6, 65535,    0},
+    {115, 1,  2471,    1}, { 99, 0,  2472,    0}, {104, 1,  2473,    4},
+    { 59, 6, 65535,    0}, {101, 0,  2474,    1}, {115, 1,  2475,    3},
+    { 82, 1,  2476,    0}, { 68, 1,  1979,    0}, {114, 0,  2477,    0},
+    {116, 1,   760,    1}, { 99, 0,  2478,    0}, {110, 1,  2479,    1},
+    {100, 1,  2480,    0}, {112, 1,  2481,    0}, {114, 1,  2482,    0},
+    { 99, 0,   703,    0}, {101, 1,  1612,    1}, {111, 1,  2484,    0},
+    {114, 1,  2485,    0}, {111, 1,  2486,    0}, {113, 1,  2487,    0},
+    {101, 1,  2488,    0}, {114, 1,  1815,    0}, {111, 1,  2489,    0},
+    {105, 1,  2490,    0}, {110, 1,  1683,    0}, {115, 1,  2030,    0},
+    {115, 1,  2492,    0}, { 98, 0,   881,    0}, {116, 0,  2493,    1},
+    {121, 1,  2495,    6}, {103, 1,  2335,    0}, {108, 1,   772,    0},
+    {111, 1,  2496,    0}, {116, 1,  2497,    0}, {102, 0,  2498,    0},
+    {112, 1,  2030,    1}, { 99, 0,   688,    0}, {108, 1,  1683,    1},
+    { 59, 6, 65535,    0}, { 97, 0,  2499,    1}, {100, 0,   772,    2},
+    {115, 0,  2166,    3}, {118, 1,   772,    4}, { 59, 6, 65535,    0},
+    {101, 0,   772,    1}, {108, 0,  2335,    2}, {109, 0,  2500,    3},
+    {114, 0,  2501,   12}, {115, 0,  2502,   15}, {122, 1,   853,   17},
+    { 99, 1,  2152,    0}, {115, 1,   772,    0}, {114, 1,  2504,    0},
+    {109, 1,  2505,    0}, {111, 1,  1622,    0}, {107, 1,  2506,    0},
+    {118, 0,  1584,    0}, {119, 1,  2510,    1}, {107, 1,  2511,    0},
+    {117, 1,   860,    0}, { 97, 1,  2513,    0}, {112, 1,  2514,    0},
+    {115, 1,   723,    0}, {110, 1,  2515,    0}, { 97, 0,   772,    0},
+    {104, 0,   772,    1}, {119, 1,  2012,    2}, { 99, 0,  1570,    0},
+    {111, 0,  2516,    3}, {115, 0,  2519,    6}, {116, 0,  2521,    8},
+    {117, 0,  1267,   10}, {118, 0,  1584,   11}, {119, 1,  1585,   12},
+    {114, 1,  2522,    0}, { 99, 0,  2523,    0}, {110, 1,  2280,    6},
+    { 49, 0,  2524,    0}, { 51, 1,  2526,    2}, { 99, 1,  2280,    0},
+    { 59, 6, 65535,    0}, {113, 1,  2102,    1}, { 59, 6, 65535,    0},
+    {116, 1,  2527,    1}, {116, 1,  2528,    0}, { 68, 0,  2529,    0},
+    { 72, 0,  2533,    4}, { 85, 0,  2529,    9}, { 86, 0,  2538,   13},
+    { 98, 0,  2545,   20}, {100, 0,  2529,   21}, {104, 0,  2533,   25},
+    {109, 0,  2546,   30}, {112, 0,  2082,   31}, {116, 0,  2051,   32},
+    {117, 0,  2529,   33}, {118, 1,  2538,   37}, {105, 1,  1723,    0},
+    { 98, 1,  2547,    0}, {109, 1,   723,    0}, {109, 1,  2548,    0},
+    {108, 1,  2550,    0}, {108, 1,  2553,    0}, {112, 1,  2555,    0},
+    { 59, 6, 65535,    0}, { 97, 0,  2499,    1}, { 98, 0,  2558,    2},
+    { 99, 0,  2559,    3}, {100, 0,   720,    5}, {115, 1,   772,    6},
+    {101, 0,  1623,    0}, {111, 1,  2153,    1}, {112, 0,  1792,    0},
+    {114, 1,  1600,    1}, {112, 1,  2561,    0}, {105, 1,  1606,    0},
+    {116, 3,  2562,    0}, { 99, 1,  2564,    0}, { 59, 6, 65535,    0},
+    { 69, 0,   772,    1}, { 99, 0,  2565,    2}, {101, 0,   772,   11},
+    {102, 0,  1622,   12}, {109, 0,  1318,   13}, {115, 1,  1791,   14},
+    { 98, 1,  2568,    0}, {111, 1,  2569,    0}, {109, 0,  2570,    0},
+    {112, 1,  2571,    2}, {103, 0,  1926,    0}, {105, 1,  1369,    2},
+    {102, 0,   772,    0}, {114, 0,  2007,    1}, {121, 3,  2574,    2},
+    { 98, 0,  2548,    0}, {112, 1,  2548,    2}, { 97, 1,  2576,    0},
+    {112, 0,   688,    0}, {115, 1,  2354,    1}, { 97, 1,  2577,    0},
+    { 59, 6, 65535,    0}, { 98, 0,  2578,    1}, { 99, 0,  2559,    2},
+    {100, 0,   720,    4}, {111, 0,   688,    5}, {115, 1,   772,    6},
+    { 97, 0,  2579,    0}, {108, 0,  2580,    2}, {114, 0,  2581,    6},
+    {118, 1,  2582,    8}, {101, 1,   692,    0}, { 99, 1,  2583,    0},
+    {101, 1,  2010,    0}, {104, 1,  2086,    0}, { 97, 1,  2354,    0},
+    {103, 0,  1640,    0}, {114, 1,   688,    1}, {116, 1,  2584,    0},
+    {116, 1,   760,    0}, {115, 1,  2585,    0}, {114, 1,  2586,    0},
+    {109, 1,  2588,    0}, { 97, 1,  2074,    0}, {105, 1,  2153,    0},
+    { 59, 6, 65535,    0}, {105, 0,  2591,    1}, {111, 1,  2592,    4},
+    {111, 0,  2593,    0}, {114, 1,  2325,    1}, {108, 1,   881,    0},
+    { 59, 6, 65535,    0}, {101, 0,  2594,    1}, {109, 0,  2546,    3},
+    {112, 0,  2082,    4}, {115, 1,  2595,    5}, { 98, 1,  2596,    0},
+    {110, 1,  2597,    0}, {107, 1,   957,    0}, {114, 0,   772,    0},
+    {121, 1,   772,    1}, {105, 1,  2600,    0}, {110, 1,  2602,    0},
+    {116, 1,  2367,    0}, {114, 1,  2603,    0}, {108, 1,  1600,    0},
+    { 59, 6, 65535,    0}, {100, 1,   720,    1}, {110, 1,  2605,    0},
+    {116, 1,  2606,    0}, {112, 1,  2607,    0}, {114, 1,  2609,    0},
+    {117, 1,  1792,    0}, {105, 1,  2611,    0}, {105, 0,  1621,    0},
+    {111, 1,  1925,    1}, {105, 0,  1658,    0}, {108, 1,  2614,    1},
+    { 97, 0,  2615,    0}, {101, 0,  1942,    1}, {105, 1,  2616,    2},
+    {112, 1,  2617,    0}, {115, 1,  1623,    0}, {101, 0,  2618,    0},
+    {111, 1,  2619,    1}, {108, 1,  2209,    0}, { 97, 1,  2620,    0},
+    {105, 0,  1683,    0}, {108, 1,  1672,    1}, {110, 1,  1792,    0},
+    { 97, 0,  2387,    0}, {107, 1,  2086,    1}, {114, 1,  2621,    0},
+    { 99, 0,  2622,    0}, {115, 1,  1772,   18}, {119, 1,  2153,    0},
+    { 59, 6, 65535,    0}, {113, 0,   772,    1}, {115, 1,  2628,    2},
+    { 59, 6, 65535,    0}, { 99, 0,  2354,    1}, {100, 0,  2629,    2},
+    {108, 1,  2630,    5}, {101, 1,  1772,    0}, {112, 1,  2632,    0},
+    { 59, 6, 65535,    0}, {113, 1,  2634,    1}, {105, 1,  1658,    0},
+    {109, 1,  2636,    0}, { 99, 0,   772,    0}, {105, 1,   688,    1},
+    { 80, 1,   881,    0}, {117, 1,  2639,    0}, { 97, 0,  2640,    0},
+    {100, 0,   720,    2}, {101, 0,  2642,    3}, {108, 0,  2643,    5},
+    {115, 1,  1967,    6}, {114, 1,  2644,    0}, { 69, 1,   772,    0},
+    {114, 1,  2645,    0}, {105, 1,  2646,    0}, {100, 0,   711,    0},
+    {114, 1,  2647,    1}, {114, 1,  2650,    0}, {108, 1,  2651,    0},
+    { 99, 1,  1600,    0}, {101, 0,   957,    0}, {119, 1,   957,    1},
+    {116, 1,  2585,    0}, {107, 1,  2652,    0}, {117, 1,  2387,    0},
+    {104, 1,  2654,    0}, { 99, 1,  1606,    0}, {105, 0,  1369,    0},
+    {110, 1,  1623,    1}, {102, 1,  1904,    0}, { 99, 0,   688,    0},
+    {103, 0,  2655,    1}, {116, 1,  2030,    4}, { 97, 1,  2658,    0},
+    {105, 1,  2659,    0}, { 59, 6, 65535,    0}, { 99, 0,  2660,    1},
+    {101, 0,  2661,    2}, {108, 0,  2663,    4}, {112, 1,  1174,    5},
+    {111, 1,   692,    0}, {101, 1,  2664,    0}, {110, 1,  2665,    0},
+    {116, 1,  2030,    0}, {112, 1,  2670,    0}, {101, 1,  2654,    0},
+    { 97, 1,  2390,    0}, {109, 1,  1802,    0}, {114, 1,  2671,    0},
+    {103, 1,  2672,    0}, {117, 1,  2675,    0}, {114, 1,  2676,    0},
+    { 59, 6, 65535,    0}, { 97, 0,  2390,    1}, {101, 1,  2684,    2},
+    { 97, 0,  2686,    0}, {107, 1,  2687,    2}, {100, 0,  2390,    0},
+    {105, 1,  1772,    1}, { 98, 1,   772,    0}, {117, 1,  2689,    0},
+    {100, 0,  2690,    0}, {117, 1,  2691,    1}, {104, 1,   772,    0},
+    {116, 1,  2692,    0}, { 59, 6, 65535,    0}, { 99, 0,  2354,    1},
+    {100, 0,  2697,    2}, {103, 0,  2630,    5}, {115, 1,  2698,    7},
+    {111, 1,  2703,    0}, {114, 1,  2704,    0}, {108, 1,  2280,    0},
+    {111, 1,  2706,    0}, { 97, 1,  2707,    0}, {114, 1,   723,    0},
+    {117, 1,  2708,    0}, {110, 0,  1683,    0}, {114, 1,   688,    1},
+    {103, 1,  2709,    0}, {112, 1,  2712,    0}, { 97, 0,   688,    0},
+    {102, 0,   772,    1}, {108, 1,  1932,    2}, {105, 1,  2063,    0},
+    { 97, 0,  1942,    0}, { 98, 1,   881,    1}, { 59, 6, 65535,    0},
+    {101, 0,  2713,    1}, {102, 1,   772,    2}, {114, 1,  2714,    0},
+    { 97, 1,  2716,    0}, {109, 1,  2717,    0}, { 98, 0,   772,    0},
+    {117, 1,  2689,    1}, {114, 1,  1584,    0}, {109, 1,  2452,    0},
+    { 80, 0,   881,    0}, {105, 1,  2720,    1}, {100, 0,  2691,    0},
+    {117, 1,  2690,    1}, {114, 3,   767,    0}, {101, 0,   772,    0},
+    {116, 1,  2723,    1}, { 59, 6, 65535,    0}, {115, 1,  2725,    1},
+    {107, 1,  2367,    0}, {109, 1,  1736,    0}, {115, 1,  2726,    0},
+    {114, 1,  2675,    0}, { 59, 6, 65535,    0}, { 97, 0,  1942,    1},
+    { 99, 0,  2152,    2}, {100, 1,  2727,    3}, {117, 1,  2728,    0},
+    {108, 1,  1932,    0}, {101, 1,  2615,    0}, {112, 1,  2729,    0},
+    {116, 1,  2730,    0}, { 59, 6, 65535,    0}, {118, 1,   772,    1},
+    {102, 1,  2731,    0}, {108, 1,   760,    0}, { 59, 6, 65535,    0},
+    { 69, 0,   772,    1}, {105, 0,   692,    2}, {111, 0,  1792,    3},
+    {112, 1,  2732,    4}, {117, 1,  2733,    0}, {112, 3,   767,    0},
+    {109, 1,  2734,    0}, {112, 0,   772,    0}, {114, 1,  1600,    1},
+    {110, 1,  2735,    0}, {114, 1,  2736,    0}, {117, 1,  2738,    0},
+    {101, 0,   881,    0}, {105, 1,  1658,    1}, {105, 1,  2739,    0},
+    { 59, 6, 65535,    0}, {113, 0,  1956,    1}, {115, 1,   772,    4},
+    { 59, 6, 65535,    0}, {100, 1,   772,    1}, { 59, 6, 65535,    0},
+    {102, 0,  2731,    1}, {113, 0,  1956,    3}, {115, 1,  2684,    6},
+    { 59, 6, 65535,    0}, {114, 1,  2740,    1}, { 59, 6, 65535,    0},
+    {105, 0,  2741,    1}, {110, 1,  2742,    7}, {114, 1,  2743,    0},
+    {108, 1,  2355,    0}, { 59, 6, 65535,    0}, { 99, 0,  2184,    1},
+    {101, 1,  2747,    2}, {114, 1,  2749,    0}, {114, 1,  2740,    0},
+    { 59, 6, 65535,    0}, { 99, 0,  2184,    1}, {101, 0,   772,    2},
+    {114, 1,   772,    3}, {111, 1,  2223,    0}, {109, 1,  2750,    0},
+    {115, 1,  2752,    0}, { 98, 0,  2753,    0}, { 99, 0,  2757,    6},
+    {112, 1,  2753,    8}, {105, 1,  2758,    0}, { 59, 6, 65535,    0},
+    {101, 0,  2759,    1}, {115, 1,   821,    2}, {101, 0,   772,    0},
+    {116, 1,   772,    1}, {110, 1,  1996,    0}, { 65, 0,  1008,    0},
+    {101, 0,   772,    1}, {116, 1,  2760,    2}, { 65, 0,  1008,    0},
+    {116, 1,  2762,    1}, {101, 1,   881,    0}, {118, 1,   772,    0},
+    {111, 1,  2763,    0}, {105, 1,   688,    0}, {110, 1,   772,    0},
+    {105, 0,   688,    0}, {114, 1,   730,    1}, {110, 1,  2335,    0},
+    { 99, 0,  1619,    0}, {100, 0,   772,    1}, {110, 1,  1932,    2},
+    {114, 1,   821,    0}, { 59, 6, 65535,    0}, {101, 0,  2764,    1},
+    {102, 2,   767,    3}, {109, 3,   767,    5}, {103, 1,  1096,    0},
+    {108, 1,  2765,    0}, {108, 0,  2346,    0}, {109, 1,  2766,    2},
+    { 59, 6, 65535,    0}, { 97, 2,  2767,    1}, {115, 0,  2769,    4},
+    {116, 1,   772,    6}, { 99, 0,  1369,    0}, {105, 0,  2007,    1},
+    {109, 0,  2390,    2}, {112, 0,   772,    3}, {116, 1,  2771,    4},
+    {109, 1,  2772,    0}, { 99, 1,  2773,    0}, {110, 1,  2774,    0},
+    {115, 1,  2776,    0}, {110, 1,  2621,    0}, {110, 1,  2785,    0},
+    {117, 1,  2335,    0}, { 59, 6, 65535,    0}, { 99, 1,  2786,    1},
+    {109, 1,  2792,    0}, { 69, 0,   772,    0}, { 97, 0,   821,    1},
+    {115, 1,  1967,    2}, {100, 0,   772,    0}, {102, 0,  2793,    1},
+    {112, 1,  2796,    4}, {114, 1,  1963,    0}, { 99, 1,  2645,    0},
+    {116, 1,  2798,    0}, {115, 1,  2800,    0}, {116, 3,   767,    0},
+    {101, 0,   772,    0}, {117, 1,  2351,    1}, {105, 1,  2354,    0},
+    {103, 1,  2801,    0}, {114, 1,  2805,    0}, { 97, 0,  2390,    0},
+    {105, 1,  2816,    1}, {100, 1,  2690,    0}, {108, 1,  2817,    0},
+    {104, 1,  2821,    0}, {105, 1,  2822,    0}, {114, 1,  2823,    0},
+    {111, 1,  2121,    0}, {105, 1,  2825,    0}, {117, 1,  2690,    0},
+    { 59, 6, 65535,    0}, {100, 1,  2390,    1}, {116, 1,  2829,    0},
+    {119, 1,   881,    0}, {109, 1,  2832,    0}, { 59, 6, 65535,    0},
+    {111, 1,  1955,    1}, {104, 0,   711,    0}, {121, 1,   772,    1},
+    {114, 1,  2834,    0}, {109, 1,  2835,    0}, { 59, 6, 65535,    0},
+    {100, 0,   720,    1}, {101, 0,  2634,    2}, {103, 0,  1214,    4},
+    {108, 0,  1214,    6}, {110, 0,  2335,    8}, {112, 0,  2082,    9},
+    {114, 1,   853,   10}, {108, 0,  2836,    0}, {115, 1,  2837,    1},
+    {100, 0,   772,    0}, {108, 1,  2335,    1}, { 59, 6, 65535,    0},
+    {101, 1,  2684,    1}, {116, 1,   711,    0}, { 59, 6, 65535,    0},
+    { 98, 1,  2838,    1}, {100, 0,  2840,    0}, {114, 1,   772,    2},
+    { 97, 0,  2841,    0}, {117, 1,  2841,    2}, {117, 1,  2842,    0},
+    { 59, 6, 65535,    0}, { 97, 0,  2844,    1}, {102, 1,   772,    3},
+    {116, 1,  2845,    0}, {105, 1,  2620,    0}, { 97, 1,  2846,    0},
+    {114, 1,  2600,    0}, { 97, 0,  2847,    0}, {110, 1,  1792,    2},
+    { 59, 6, 65535,    0}, { 69, 0,   772,    1}, {100, 0,   720,    2},
+    {101, 0,  1926,    3}, {109, 0,  2848,    5}, {110, 0,  2849,    6},
+    {112, 0,  2082,    8}, {114, 0,   853,    9}, {115, 1,  2851,   10},
+    { 99, 1,  2786,    0}, { 49, 2,   767,    0}, { 50, 2,   767,    2},
+    { 51, 2,   767,    4}, { 59, 6, 65535,    6}, { 69, 0,   772,    7},
+    {100, 0,  2854,    8}, {101, 0,  1926,   10}, {104, 0,  2856,   12},
+    {108, 0,   853,   14}, {109, 0,  2848,   15}, {110, 0,  2849,   16},
+    {112, 0,  2082,   18}, {115, 1,  2851,   19}, {103, 1,  2475,    0},
+    {107, 1,   772,    0}, {114, 1,  2857,    0}, {114, 0,  2858,    0},
+    {116, 1,  2859,    2}, { 99, 0,  2860,    0}, {110, 1,  2645,    2},
+    { 97, 0,   821,    0}, {115, 1,  1967,    1}, {114, 1,  1587,    0},
+    {100, 1,  2335,    0}, {101, 1,  2861,    0}, { 59, 6, 65535,    0},
+    { 98, 0,   720,    1}, { 99, 0,  2152,    2}, {102, 1,  2862,    3},
+    { 97, 0,  2864,    0}, {100, 0,   720,    7}, {101, 0,   772,    8},
+    {109, 0,  2546,    9}, {112, 0,  2082,   10}, {115, 0,  2026,   11},
+    {116, 1,  1838,   12}, {101, 1,  2865,    0}, {120, 1,  1623,    0},
+    {104, 1,  2866,    0}, {111, 0,  2867,    0}, {114, 1,  2325,    2},
+    { 97, 1,  2868,    0}, {105, 1,  2869,    0}, {112, 1,  2872,    0},
+    {114, 1,  2086,    0}, {103, 1,  2873,    0}, {101, 0,  2874,    0},
+    {107, 0,  2875,    1}, {110, 0,  2876,    2}, {112, 0,  2877,    3},
+    {114, 0,  2880,    6}, {115, 0,  2882,    8}, {116, 1,  2884,   13},
+    { 59, 6, 65535,    0}, { 98, 0,   881,    1}, {101, 1,  2886,    2},
+    { 98, 0,   881,    0}, {116, 1,   772,    1}, {117, 1,  2887,    0},
+    {111, 1,   821,    0}, { 98, 0,  2889,    0}, {112, 1,  2889,    2},
+    {103, 1,  2890,    0}, { 98, 0,   881,    0}, {103, 1,  2891,    1},
+    {101, 1,  2160,    0}, {102, 0,   772,    0}, {108, 1,  1932,    1},
+    { 99, 1,  2892,    0}, {101, 1,   772,    0}, {117, 0,  1774,    0},
+    {121, 1,   772,    2}, {116, 1,  2846,    0}, {114, 1,   853,    0},
+    {106, 1,   772,    0}, {103, 3,   767,    0}, { 99, 3,   767,    0},
+    {118, 1,  2497,    0}, {121, 1,  2893,    0}, {103, 1,  2153,    0},
+    {100, 1,  2497,    0}, {115, 1,  2894,    0}, {117, 1,  2895,    0},
+    {111, 1,  2896,    0}, {101, 1,  2886,    0}, {116, 1,  2335,    0},
+    {116, 1,  2897,    0}, {101, 1,  2898,    0}, { 99, 1,   772,    0},
+    {105, 1,  1369,    0}, {108, 1,  2089,    0}, {101, 1,  2899,    0},
+    {108, 1,  2900,    0}, {107, 1,  2901,    0}, {101, 1,  2450,    0},
+    {110, 1,  2548,    0}, {114, 1,  2902,    0}, {111, 1,  2903,    0},
+    {111, 1,  2904,    0}, {116, 1,  2905,    0}, {114, 1,  2906,    0},
+    {101, 1,   688,    0}, {114, 1,  2907,    0}, {111, 1,  2499,    0},
+    {101, 1,  2908,    0}, {113, 1,  2909,    0}, {108, 1,  2910,    0},
+    { 65, 0,  2911,    0}, { 66, 0,   685,    3}, { 76, 0,  2912,    4},
+    { 82, 0,  2913,    8}, { 84, 0,  1761,   11}, { 97, 1,  1762,   13},
+    {111, 1,  2280,    0}, {101, 1,  1369,    0}, {121, 1,  2914,    0},
+    {108, 1,  2916,    0}, {108, 1,  2918,    0}, {116, 1,  1792,    0},
+    {110, 1,  2919,    0}, {101, 1,  2920,    0}, {108, 1,  1772,    0},
+    {105, 1,  2921,    0}, { 97, 1,  2109,    0}, {105, 1,  1772,    0},
+    {116, 1,  2922,    0}, {101, 1,  2923,    0}, {122, 1,  2924,    0},
+    { 68, 0,  2925,    0}, { 69, 1,  2371,    1}, {105, 1,  2926,    0},
+    {105, 1,  2452,    0}, {103, 0,  2927,    0}, {114, 1,  2928,    1},
+    {115, 1,  2929,    0}, {100, 1,   760,    0}, { 97, 1,  2930,    0},
+    { 65, 0,  2931,    0}, { 67, 0,  2933,    4}, { 68, 0,  2934,    5},
+    { 70, 0,  2935,    9}, { 82, 0,  2936,   10}, { 84, 0,  2937,   12},
+    { 85, 0,  2939,   18}, { 86, 0,  2940,   22}, { 97, 0,  1762,   24},
+    {114, 1,   864,   25}, { 69, 0,  2941,    0}, { 70, 0,  2942,    1},
+    { 71, 0,  2943,    2}, { 76, 0,  2643,    3}, { 83, 0,  2944,    4},
+    { 84, 1,   791,    5}, {116, 1,  2945,    0}, { 76, 0,  2946,    0},
+    { 82, 0,  2947,    2}, {108, 0,  2948,    3}, {114, 1,   864,    5},
+    {114, 1,  2949,    0}, {117, 1,  2951,    0}, {105, 1,  2952,    0},
+    {115, 1,  2953,    0}, {116, 1,  2954,    0}, {101, 1,  2955,    0},
+    {105, 1,  2156,    0}, {101, 1,  2956,    0}, {114, 1,  2957,    0},
+    {111, 0,  2958,    0}, {117, 1,  2959,    1}, {111, 1,  2960,    0},
+    {108, 0,   753,    0}, {113, 0,  2961,    1}, {120, 1,  2962,    3},
+    {114, 1,  2963,    0}, {117, 1,   781,    0}, {101, 1,  2964,    0},
+    {101, 1,  2966,    0}, {114, 1,  2967,    0}, {101, 0,  2968,    0},
+    {105, 1,  2969,    1}, {113, 0,  2970,    0}, {117, 1,  2971,    4},
+    {105, 1,   894,    0}, {101, 1,  2974,    0}, { 67, 1,  2975,    0},
+    {115, 1,  2976,    0}, {101, 1,  1792,    0}, { 66, 0,  2977,    0},
+    { 80, 1,  2979,    3}, {105, 1,  2980,    0}, { 77, 1,  2546,    0},
+    { 99, 1,  2981,    0}, {101, 1,  2982,    0}, {117, 1,  2983,    0},
+    {111, 1,  2984,    0}, { 59, 6, 65535,    0}, {116, 1,  1772,    1},
+    {114, 1,  2985,    0}, {116, 1,  2986,    0}, {100, 1,  2994,    0},
+    {104, 1,  2419,    0}, { 68, 1,  2995,    0}, {116, 1,  2996,    0},
+    {108, 1,  3000,    0}, {114, 1,  3001,    0}, {101, 1,  3002,    0},
+    {101, 1,  3003,    0}, { 84, 1,  3004,    0}, {114, 1,  3005,    0},
+    {101, 1,  1623,    0}, { 78, 3,   767,    0}, {101, 1,  3006,    0},
+    {107, 1,  2479,    0}, { 83, 1,  3007,    0}, {101, 1,  3008,    0},
+    {108, 1,  3012,    0}, { 59, 6, 65535,    0}, {111, 1,  1791,    1},
+    {110, 1,  3013,    0}, {114, 1,  3015,    0}, {119, 1,  3016,    0},
+    {117, 1,  3017,    0}, {101, 1,  3018,    0}, {119, 1,  3020,    0},
+    { 59, 6, 65535,    0}, {108, 1,  1600,    1}, {104, 1,  1102,    0},
+    { 59, 6, 65535,    0}, {105, 1,  3021,    1}, { 84, 1,  3022,    0},
+    { 87, 1,  3023,    0}, {101, 3,   767,    0}, {115, 1,  3024,    0},
+    {110, 1,   692,    0}, {115, 1,  3025,    0}, {116, 1,  3026,    0},
+    {112, 0,  2030,    0}, {116, 1,   772,    1}, {111, 1,  3028,    0},
+    {112, 1,  3029,    0}, { 99, 0,  3031,    0}, {101, 0,  2874,    1},
+    {112, 0,   967,    2}, {115, 1,  3032,    3}, {101, 1,  3033,    0},
+    { 59, 6, 65535,    0}, {116, 1,  3034,    1}, {117, 1,  3035,    0},
+    {116, 1,  3036,    0}, {111, 1,  3037,    0}, {100, 0,   720,    0},
+    {112, 0,  2082,    1}, {116, 1,  2051,    2}, {113, 0,  2334,    0},
+    {116, 1,   881,    1}, {114, 1,  3038,    0}, {111, 1,  3039,    0},
+    {107, 1,  3040,    0}, { 50, 0,   772,    0}, { 52, 1,   772,    1},
+    { 52, 1,   772,    0}, {111, 1,  1658,    0}, {105, 1,  2335,    0},
+    { 76, 0,   772,    0}, { 82, 0,   772,    1}, {108, 0,   772,    2},
+    {114, 1,   772,    3}, { 59, 6, 65535,    0}, { 68, 0,   772,    1},
+    { 85, 0,   772,    2}, {100, 0,   772,    3}, {117, 1,   772,    4},
+    { 59, 6, 65535,    0}, { 72, 0,   772,    1}, { 76, 0,   772,    2},
+    { 82, 0,   772,    3}, {104, 0,   772,    4}, {108, 0,   772,    5},
+    {114, 1,   772,    6}, {111, 1,  3043,    0}, {105, 1,  3044,    0},
+    { 97, 1,  2068,    0}, { 59, 6, 65535,    0}, {101, 1,   772,    1},
+    { 59, 6, 65535,    0}, { 98, 0,   772,    1}, {104, 1,  3045,    2},
+    { 59, 6, 65535,    0}, {101, 1,  1623,    1}, { 59, 6, 65535,    0},
+    { 69, 0,   772,    1}, {101, 1,  2634,    2}, {114, 1,  2334,    0},
+    { 97, 0,   821,    0}, {117, 1,   821,    1}, {115, 1,  3046,    0},
+    { 59, 6, 65535,    0}, {101, 1,  3048,    1}, {107, 1,  3049,    0},
+    { 59, 6, 65535,    0}, {101, 0,  2886,    1}, {108, 1,  3051,    2},
+    {115, 1,  3052,    0}, {110, 1,  2750,    0}, { 97, 1,  3054,    0},
+    { 59, 6, 65535,    0}, {102, 0,  2153,    1}, {108, 1,  3056,    2},
+    { 59, 6, 65535,    0}, {115, 1,   688,    1}, {114, 1,  1901,    0},
+    {114, 1,  3057,    0}, {114, 1,  3058,    0}, {114, 1,  3059,    0},
+    {121, 1,  3060,    0}, {101, 1,  1587,    0}, {101, 1,  2712,    0},
+    {116, 1,   703,    0}, {115, 1,  2350,    0}, {104, 1,  1623,    0},
+    {108, 0,   772,    0}, {114, 1,   772,    1}, { 59, 6, 65535,    0},
+    {111, 0,  3063,    1}, {115, 1,   772,    3}, {100, 1,  3064,    0},
+    {110, 1,  3043,    0}, {114, 1,  2153,    0}, {113, 1,  1926,    0},
+    {113, 1,  3065,    0}, {108, 1,  3066,    0}, { 97, 0,  1762,    0},
+    {100, 0,  3067,    1}, {104, 1,  2307,    2}, { 59, 6, 65535,    0},
+    {102, 1,   772,    1}, {103, 1,  2620,    0}, { 59, 6, 65535,    0},
+    { 99, 3,   767,    1}, {116, 1,  3068,    0}, {121, 1,  3069,    0},
+    { 49, 0,  3072,    0}, { 59, 7, 65535,    2}, { 59, 6, 65535,    0},
+    {115, 1,  1772,    1}, { 59, 6, 65535,    0}, {108, 0,  1600,    1},
+    {118, 1,   772,    2}, { 97, 1,  3074,    0}, {108, 1,  1792,    0},
+    {118, 1,  3075,    0}, { 97, 1,  3077,    0}, { 99, 1,  3078,    0},
+    {110, 1,  3079,    0}, {108, 1,  2335,    0}, {116, 1,  2355,    0},
+    { 49, 0,  3080,    0}, { 50, 0,  3086,    8}, { 51, 0,  3088,   10},
+    { 52, 0,  3091,   14}, { 53, 0,  3092,   15}, { 55, 1,  3094,   17},
+    {108, 1,  3095,    0}, {111, 1,  3096,    0}, { 59, 6, 65535,    0},
+    {101, 1,  1792,    1}, { 59, 6, 65535,    0}, {112, 1,  2732,    1},
+    { 59, 6, 65535,    0}, {113, 1,   772,    1}, { 59, 6, 65535,    0},
+    {101, 0,   772,    1}, {108, 1,   772,    2}, {101, 1,  1942,    0},
+    {112, 0,  3097,    0}, {114, 1,   688,    1}, {113, 1,  3098,    0},
+    {101, 1,  1636,    0}, {116, 1,  3100,    0}, {115, 1,   821,    0},
+    {108, 1,  1623,    0}, { 59, 6, 65535,    0}, { 99, 0,  2152,    1},
+    {119, 1,   772,    2}, {116, 1,  2568,    0}, {105, 1,   821,    0},
+    {108, 0,  3101,    0}, {114, 1,   864,    1}, {101, 1,  2153,    0},
+    {101, 0,   772,    0}, {108, 0,  2430,    1}, {112, 1,  3102,    2},
+    {114, 1,  2335,    0}, {110, 1,  3103,    0}, { 97, 1,  1772,    0},
+    {103, 0,  3068,    0}, {114, 1,  3105,    1}, { 97, 1,  3106,    0},
+    {115, 1,  2198,    0}, { 59, 6, 65535,    0}, { 69, 0,   772,    1},
+    {100, 0,   720,    2}, {115, 0,  2086,    3}, {118, 1,   772,    5},
+    { 97, 1,  2086,    0}, { 97, 1,  2153,    0}, { 59, 6, 65535,    0},
+    {100, 0,   772,    1}, {108, 1,  2335,    2}, {111, 3,   767,    0},
+    { 59, 6, 65535,    0}, { 98, 0,  3107,    1}, {102, 0,  1792,    3},
+    {104, 0,  2280,    4}, {108, 0,   821,    5}, {112, 0,  1772,    6},
+    {115, 0,  1967,    7}, {116, 1,  1772,    8}, { 59, 6, 65535,    0},
+    {115, 1,   772,    1}, { 99, 1,  3109,    0}, {101, 0,   772,    0},
+    {115, 1,  3111,    1}, {111, 1,   925,    0}, {104, 1,   881,    0},
+    {115, 1,  2690,    0}, { 97, 0,  3112,    0}, {104, 0,  3113,    2},
+    {108, 0,  3114,    4}, {114, 0,  3115,    5}, {116, 1,  3116,    9},
+    {111, 1,  3117,    0}, { 97, 0,  3118,    0}, {100, 0,   720,    1},
+    {101, 0,  3119,    2}, {103, 0,  3120,    4}, {115, 1,  1967,    5},
+    {111, 1,   688,    0}, {100, 0,   772,    0}, {117, 1,  1102,    1},
+    {114, 1,  3121,    0}, {114, 1,   692,    0}, {115, 1,  3122,    0},
+    {108, 0,  2948,    0}, {109, 0,  3123,    2}, {114, 1,   864,    3},
+    { 97, 1,  3124,    0}, {110, 1,  1771,    0}, { 59, 6, 65535,    0},
+    {108, 1,  1623,    1}, {114, 1,  2109,    0}, { 59, 6, 65535,    0},
+    {101, 0,   772,    1}, {103, 1,   772,    2}, { 59, 6, 65535,    0},
+    {101, 0,   772,    1}, {102, 1,   772,    2}, { 59, 6, 65535,    0},
+    {101, 1,  2895,    1}, {116, 1,  3125,    0}, {117, 1,  3126,    0},
+    {111, 1,  2198,    0}, {115, 1,  3127,    0}, {111, 1,  1792,    0},
+    {105, 1,  3130,    0}, {116, 1,  3131,    0}, {114, 1,  2545,    0},
+    {114, 1,  3133,    0}, {112, 1,  2548,    0}, {103, 1,  1926,    0},
+    {104, 0,  2280,    0}, {114, 1,  3135,    1}, {105, 1,  2150,    0},
+    {115, 1,  3137,    0}, {105, 1,  2548,    0}, {110, 1,  3138,    0},
+    {105, 1,  3142,    0}, { 59, 6, 65535,    0}, { 97, 0,  3144,    1},
+    {115, 0,  1772,    2}, {116, 1,   772,    3}, { 59, 6, 65535,    0},
+    { 99, 1,  3029,    1}, {114, 1,  3145,    0}, { 59, 6, 65535,    0},
+    {101, 1,  2634,    1}, {117, 1,  3148,    0}, { 59, 6, 65535,    0},
+    { 69, 0,   772,    1}, {101, 0,   772,    2}, {115, 1,  3150,    3},
+    { 99, 1,  3029,    0}, { 97, 1,  3151,    0}, {114, 1,   860,    0},
+    { 59, 6, 65535,    0}, {114, 1,  2528,    1}, {114, 1,  2528,    0},
+    {108, 1,   692,    0}, {114, 1,  3152,    0}, {111, 1,  3154,    0},
+    {101, 1,  3155,    0}, { 59, 6, 65535,    0}, {108, 1,  3156,    1},
+    {105, 0,  1658,    0}, {108, 1,   772,    1}, {101, 1,  3157,    0},
+    { 97, 1,  1623,    0}, {104, 1,  3158,    0}, { 99, 0,  3159,    0},
+    {107, 1,  2150,    2}, { 59, 6, 65535,    0}, { 97, 0,  1791,    1},
+    { 98, 0,   772,    2}, { 99, 0,  2152,    3}, {100, 0,  3160,    4},
+    {101, 0,   772,    6}, {109, 0,  1587,    7}, {115, 0,  1967,    9},
+    {116, 1,  3162,   10}, {100, 3,   767,    0}, { 59, 6, 65535,    0},
+    { 97, 0,  3118,    1}, { 99, 0,  3163,    2}, {101, 0,  2886,    3},
+    {110, 0,  3164,    4}, {115, 1,  1967,    7}, {101, 1,  2684,    0},
+    { 97, 0,  1910,    0}, {108, 0,  2430,    1}, {115, 1,  3167,    2},
+    { 59, 6, 65535,    0}, {116, 1,   860,    1}, {101, 0,  3168,    0},
+    {105, 1,  1369,    1}, {116, 1,  3029,    0}, { 59, 6, 65535,    0},
+    {100, 0,   772,    1}, {101, 0,   772,    2}, {108, 1,  2335,    3},
+    { 59, 6, 65535,    0}, { 97, 0,   821,    1}, { 98, 0,  3107,    2},
+    { 99, 0,   772,    4}, {102, 0,  1792,    5}, {104, 0,  2280,    6},
+    {108, 0,   821,    7}, {112, 0,  1772,    8}, {115, 0,  1967,    9},
+    {116, 0,  1772,   10}, {119, 1,   772,   11}, {111, 1,  3169,    0},
+    { 59, 6, 65535,    0}, {105, 0,  2156,    1}, {112, 0,  3102,    2},
+    {115, 1,   772,    3}, {116, 1,  3171,    0}, {110, 1,  3177,    0},
+    { 59, 6, 65535,    0}, {103, 1,  1623,    1}, { 59, 6, 65535,    0},
+    {101, 0,   772,    1}, {102, 0,   772,    2}, {108, 1,  1560,    3},
+    { 59, 6, 65535,    0}, { 98, 0,   772,    1}, {101, 1,   772,    2},
+    {105, 0,  3044,    0}, {110, 1,   772,    1}, {116, 1,  3178,    0},
+    { 97, 1,  3180,    0}, {108, 1,  3183,    0}, {104, 1,   821,    0},
+    { 59, 6, 65535,    0}, { 97, 1,   688,    1}, {101, 1,  2568,    0},
+    {112, 1,  2684,    0}, { 98, 0,  3184,    0}, {112, 1,  3184,    4},
+    {114, 1,  3187,    0}, {109, 1,  2153,    0}, {114, 1,  1601,    0},
+    {105, 1,  3189,    0}, {117, 1,  2646,    0}, { 69, 0,   772,    0},
+    {101, 1,   772,    1}, {101, 0,  3190,    0}, {105, 0,  1658,    5},
+    {117, 1,  2887,    6}, {111, 0,  1623,    0}, {115, 1,  3191,    1},
+    {115, 1,  3192,    0}, {101, 1,  2354,    0}, {101, 1,  3194,    0},
+    { 97, 1,  3196,    0}, {107, 1,  3199,    0}, {115, 3,  3201,    0},
+    { 59, 6, 65535,    0}, {111, 1,  1509,    1}, {110, 1,  3204,    0},
+    {122, 1,  3205,    0}, {101, 1,  3206,    0}, {114, 1,  3207,    0},
+    {114, 1,  3208,    0}, { 59, 6, 65535,    0}, {104, 0,   772,    1},
+    {108, 1,  1600,    2}, { 97, 1,  3209,    0}, {114, 1,  1623,    0},
+    {112, 1,   756,    0}, { 97, 1,   799,    0}, {111, 1,  3210,    0},
+    {104, 0,   723,    0}, {105, 0,   772,    1}, {114, 1,  3211,    2},
+    { 59, 6, 65535,    0}, {104, 1,   860,    1}, {105, 0,   877,    0},
+    {117, 1,  3212,    1}, {104, 0,  3214,    0}, {114, 1,  3215,    1},
+    {113, 1,   772,    0}, { 98, 0,   772,    0}, {112, 1,   772,    1},
+    {110, 1,  2849,    0}, {122, 1,  3216,    0}, {101, 1,  2634,    0},
+    {117, 1,   821,    0}, { 70, 1,  3217,    0}, {108, 1,   910,    0},
+    {115, 1,  2335,    0}, {117, 1,  3218,    0}, { 97, 1,  3219,    0},
+    {121, 1,  1792,    0}, {114, 1,  1254,    0}, {101, 1,  3220,    0},
+    {119, 1,  3224,    0}, {117, 1,  2380,    0}, {117, 1,  3225,    0},
+    {100, 1,  2459,    0}, {101, 1,  3226,    0}, { 97, 1,  3227,    0},
+    {105, 1,  3228,    0}, {114, 1,  3229,    0}, {117, 1,  2660,    0},
+    {101, 1,  3230,    0}, {114, 1,  3236,    0}, {101, 1,  3237,    0},
+    {105, 1,  3238,    0}, { 83, 0,  3239,    0}, { 86, 1,  3240,    1},
+    { 59, 6, 65535,    0}, { 84, 1,   791,    1}, {105, 1,  3241,    0},
+    {101, 1,  3242,    0}, {100, 1,  2914,    0}, {101, 1,  3243,    0},
+    {101, 1,  3244,    0}, {114, 1,  3245,    0}, {111, 1,  3246,    0},
+    {111, 1,  3247,    0}, {110, 1,  3248,    0}, {114, 1,  2660,    0},
+    {115, 1,  3249,    0}, {105, 1,  3250,    0}, { 99, 1,  3251,    0},
+    {110, 0,  3252,    0}, {114, 1,  3253,    1}, {101, 1,  3254,    0},
+    {111, 1,  3255,    0}, {108, 1,  2037,    0}, {105, 1,  3257,    0},
+    {101, 0,  3258,    0}, {114, 1,  3259,    3}, {112, 1,  3260,    0},
+    {101, 1,  3263,    0}, {113, 1,  3264,    0}, {117, 1,  3265,    0},
+    {114, 1,  3266,    0}, {108, 1,  3267,    0}, { 97, 1,  1762,    0},
+    {101, 1,  3268,    0}, {105, 1,  3269,    0}, {101, 1,  2088,    0},
+    { 76, 0,  3270,    0}, { 82, 1,  2947,    1}, {109, 1,  2479,    0},
+    {110, 1,  2338,    0}, { 80, 1,  2082,    0}, {105, 1,  3271,    0},
+    {100, 1,  3272,    0}, { 97, 1,  2280,    0}, {101, 1,  3274,    0},
+    {110, 1,  3275,    0}, {112, 1,  3276,    0}, {117, 1,  3277,    0},
+    {117, 1,  3278,    0}, {105, 1,  1659,    0}, {101, 1,  3279,    0},
+    {102, 0,  3280,    0}, {115, 1,  3281,    3}, {115, 1,  1694,    0},
+    {101, 1,  3282,    0}, {118, 1,  3283,    0}, {103, 1,  3284,    0},
+    {117, 1,  3285,    0}, { 98, 0,  3005,    0}, { 99, 0,  3286,    2},
+    {112, 1,  3287,    6}, {114, 1,  3288,    0}, {117, 1,  3289,    0},
+    {104, 3,   767,    0}, { 97, 0,   688,    0}, {114, 1,  3290,    1},
+    { 97, 1,  3291,    0}, { 97, 1,  3292,    0}, { 97, 1,  3293,    0},
+    {100, 1,  3294,    0}, { 99, 1,  1623,    0}, {114, 1,  3295,    0},
+    {115, 1,  3296,    0}, { 65, 0,  3297,    0}, { 67, 0,  2933,    4},
+    { 68, 0,  2934,    5}, { 70, 0,  2935,    9}, { 84, 0,  2937,   10},
+    { 85, 0,  2939,   16}, { 86, 0,  2940,   20}, { 97, 1,  1762,   22},
+    { 73, 1,  3299,    0}, {101, 1,  3300,    0}, { 68, 0,  1759,    0},
+    { 76, 0,  3270,    1}, { 82, 0,  2947,    2}, { 85, 1,  3301,    3},
+    { 67, 1,  3302,    0}, {101, 1,  3303,    0}, {116, 1,  3307,    0},
+    {101, 1,  3309,    0}, {104, 1,  2772,    0}, {115, 1,  2471,    0},
+    {102, 1,  3310,    0}, {112, 1,  3311,    0}, { 59, 6, 65535,    0},
+    { 69, 0,  2371,    1}, { 70, 0,  2942,    2}, { 84, 1,   791,    3},
+    {101, 1,  1254,    0}, { 59, 6, 65535,    0}, { 80, 1,  2082,    1},
+    {111, 1,  3312,    0}, {110, 1,  3313,    0}, {105, 1,  2383,    0},
+    { 59, 6, 65535,    0}, { 65, 1,  1762,    1}, {110, 1,  2945,    0},
+    { 99, 1,  3314,    0}, {104, 1,  3315,    0}, {105, 1,  3316,    0},
+    {121, 1,  1658,    0}, {100, 1,  3317,    0}, { 59, 6, 65535,    0},
+    {118, 1,  3319,    1}, {120, 1,  3029,    0}, { 59, 6, 65535,    0},
+    {101, 1,  2886,    1}, {111, 1,  1765,    0}, {105, 1,  3320,    0},
+    {100, 1,  3321,    0}, { 98, 1,  1509,    0}, {115, 1,  2548,    0},
+    {121, 1,  2150,    0}, {117, 1,   772,    0}, {105, 1,  3323,    0},
+    {119, 1,   772,    0}, {108, 0,  3324,    0}, {115, 0,  2595,    1},
+    {116, 1,  3325,    2}, {120, 1,   772,    0}, {110, 1,  1932,    0},
+    {115, 1,  3191,    0}, { 59, 6, 65535,    0}, {115, 1,  1658,    1},
+    {114, 1,   999,    0}, { 59, 6, 65535,    0}, {109, 1,  3326,    1},
+    {101, 1,  3327,    0}, { 59, 6, 65535,    0}, {117, 1,  3329,    1},
+    { 59, 6, 65535,    0}, {116, 1,   772,    1}, {101, 1,  3330,    0},
+    {114, 1,  3332,    0}, { 99, 1,  1575,    0}, {114, 1,  3334,    0},
+    {101, 0,  3336,    0}, {118, 0,  1584,    2}, {119, 1,  1585,    3},
+    {110, 1,  3337,    0}, {101, 3,  3338,    0}, {117, 1,  2000,    0},
+    {101, 1,  3340,    0}, {111, 1,  3341,    0}, {101, 1,  3342,    0},
+    { 59, 6, 65535,    0}, {115, 0,  2475,    1}, {118, 1,   772,    2},
+    { 51, 0,   772,    0}, { 52, 1,   772,    1}, {110, 1,  3343,    0},
+    { 59, 6, 65535,    0}, { 68, 1,  3344,    1}, {114, 1,  3345,    0},
+    {116, 1,  3346,    0}, {101, 1,  3347,    0}, { 50, 2,   767,    0},
+    { 51, 0,   772,    2}, { 52, 2,   767,    3}, { 53, 0,   772,    5},
+    { 54, 0,   772,    6}, { 56, 1,   772,    7}, { 51, 0,   772,    0},
+    { 53, 1,   772,    1}, { 52, 2,   767,    0}, { 53, 0,   772,    2},
+    { 56, 1,   772,    3}, { 53, 1,   772,    0}, { 54, 0,   772,    0},
+    { 56, 1,   772,    1}, { 56, 1,   772,    0}, { 97, 1,  1369,    0},
+    {116, 1,  3348,    0}, {112, 1,  2732,    0}, {108, 0,  2643,    0},
+    {113, 1,  3350,    1}, {110, 1,  3351,    0}, {101, 1,  1687,    0},
+    { 97, 1,  2873,    0}, { 59, 6, 65535,    0}, {116, 1,  2528,    1},
+    { 99, 1,  2660,    0}, {114, 1,  3352,    0}, { 59, 6, 65535,    0},
+    {102, 1,  1792,    1}, {101, 0,   772,    0}, {107, 1,   772,    1},
+    {108, 1,  3353,    0}, {114, 1,  3355,    0}, { 97, 1,  3356,    0},
+    {101, 1,  3357,    0}, {105, 1,  3358,    0}, {104, 1,  3359,    0},
+    {116, 1,  3360,    0}, {112, 1,  3097,    0}, {113, 1,  3362,    0},
+    {116, 1,   688,    0}, {110, 1,  2367,    0}, {116, 1,  3364,    0},
+    { 97, 1,  3366,    0}, {114, 1,  3367,    0}, {111, 1,  3368,    0},
+    {114, 1,  3372,    0}, { 59, 6, 65535,    0}, { 98, 0,   772,    1},
+    {100, 1,  3373,    2}, {109, 1,  1575,    0}, { 97, 0,  1762,    0},
+    {114, 1,   864,    1}, { 59, 6, 65535,    0}, { 97, 1,  3375,    1},
+    { 59, 6, 65535,    0}, {111, 1,  3039,    1}, {116, 1,  2684,    0},
+    { 59, 6, 65535,    0}, { 69, 0,   772,    1}, {100, 0,   720,    2},
+    {118, 1,  3376,    3}, { 59, 6, 65535,    0}, {118, 1,  3376,    1},
+    {108, 1,  3156,    0}, { 59, 6, 65535,    0}, { 99, 0,   772,    1},
+    {119, 1,   772,    2}, { 98, 0,  2335,    0}, {112, 1,  2335,    1},
+    {101, 1,  3379,    0}, {110, 1,  3380,    0}, { 59, 6, 65535,    0},
+    {111, 1,  1601,    1}, {112, 1,  2335,    0}, {115, 1,  3381,    0},
+    {108, 1,  1963,    0}, {110, 1,  2280,    0}, {102, 1,  3383,    0},
+    {107, 1,  3384,    0}, {111, 0,   772,    0}, {117, 1,   772,    1},
+    {119, 1,   860,    0}, {117, 1,  3386,    0}, { 97, 0,  3118,    0},
+    {101, 0,  3387,    1}, {115, 1,  1967,    2}, {117, 1,  2846,    0},
+    {114, 1,  3388,    0}, { 59, 6, 65535,    0}, {110, 1,  3389,    1},
+    { 97, 0,  3112,    0}, {104, 0,  3113,    2}, {108, 0,  3390,    4},
+    {114, 0,  3391,    6}, {115, 0,  3392,    7}, {116, 1,  3116,    8},
+    {103, 1,  3393,    0}, {109, 0,  1318,    0}, {112, 1,  3394,    1},
+    { 59, 6, 65535,    0}, {102, 0,   772,    1}, {118, 1,   772,    2},
+    {115, 1,  3395,    0}, { 59, 6, 65535,    0}, {101, 0,   772,    1},
+    {115, 1,  3396,    2}, {101, 0,   772,    0}, {102, 1,   772,    1},
+    {103, 1,  3397,    0}, {116, 1,  3398,    0}, {117, 1,  2026,    0},
+    {111, 0,  1772,    0}, {117, 1,  2026,    1}, { 52, 0,   772,    0},
+    {102, 1,  3310,    1}, { 59, 6, 65535,    0}, {115, 0,  3024,    1},
+    {118, 1,   772,    2}, { 97, 0,  3118,    0}, {115, 1,  1967,    1},
+    { 59, 6, 65535,    0}, { 98, 0,  2838,    1}, {100, 1,   772,    3},
+    {103, 1,  3401,    0}, {105, 1,  3402,    0}, { 97, 1,  3403,    0},
+    {110, 1,  3404,    0}, {112, 1,  3406,    0}, {114, 1,  3407,    0},
+    {116, 1,  3408,    0}, {111, 1,  3409,    0}, { 98, 0,  3410,    0},
+    {112, 1,  3410,    2}, {101, 1,  1899,    0}, {105, 1,  3411,    0},
+    { 97, 1,  1683,    0}, {117, 1,  3412,    0}, {108, 1,  3413,    0},
+    {108, 1,  3414,    0}, { 68, 0,   720,    0}, { 77, 0,  2546,    1},
+    { 80, 0,  2082,    2}, { 84, 1,  2051,    3}, {105, 1,  3415,    0},
+    {114, 1,  3416,    0}, {114, 1,  3417,    0}, {104, 1,   692,    0},
+    {116, 1,  3418,    0}, {101, 1,  3419,    0}, { 67, 0,  3420,    0},
+    { 68, 0,  3421,    1}, { 76, 0,  3422,    3}, { 82, 0,  3424,    9},
+    { 85, 0,  3425,   11}, { 86, 1,  2449,   13}, {114, 1,  3426,    0},
+    {102, 1,  3427,    0}, {103, 1,  3428,    0}, {109, 1,  3429,    0},
+    {101, 1,  3430,    0}, { 98, 1,  3431,    0}, {110, 1,  3432,    0},
+    {114, 1,  2338,    0}, {114, 1,  3433,    0}, {116, 1,  2479,    0},
+    {110, 1,  3439,    0}, {119, 1,  3440,    0}, { 97, 1,  3441,    0},
+    {101, 1,  3442,    0}, { 98, 1,  3443,    0}, {101, 1,  2338,    0},
+    {103, 1,  3444,    0}, {114, 1,  3445,    0}, {105, 1,  3446,    0},
+    {117, 0,  3447,    0}, {119, 1,  3448,    1}, {103, 1,  3449,    0},
+    {101, 1,  3450,    0}, {105, 1,  3453,    0}, { 68, 0,  3454,    0},
+    { 84, 0,  3455,    1}, { 86, 1,  2940,    2}, { 99, 1,  3456,    0},
+    {117, 1,  3457,    0}, {108, 1,  3458,    0}, {101, 1,  3459,    0},
+    { 97, 1,  3460,    0}, {102, 1,  3461,    0}, {103, 1,  3462,    0},
+    {101, 1,  3463,    0}, {118, 1,  3464,    0}, { 71, 0,  3465,    0},
+    { 76, 1,  3466,    1}, { 97, 1,  3467,    0}, {103, 1,  2362,    0},
+    { 67, 1,  1575,    0}, { 98, 1,  3468,    0}, { 97, 1,  2382,    0},
+    { 97, 1,  3469,    0}, {116, 1,  3470,    0}, {115, 1,  3471,    0},
+    { 99, 1,  3477,    0}, {101, 1,  3478,    0}, {104, 1,  3280,    0},
+    { 97, 1,  3479,    0}, { 99, 1,  2472,    0}, {101, 1,  2474,    0},
+    {116, 1,  3480,    0}, {114, 1,  3481,    0}, { 97, 1,  3482,    0},
+    {114, 1,  3483,    0}, {108, 1,  3344,    0}, {114, 1,  3484,    0},
+    {101, 1,  3485,    0}, {116, 1,  3486,    0}, {101, 1,  3487,    0},
+    {110, 0,  3252,    0}, {114, 1,  3489,    1}, {109, 1,  3490,    0},
+    {108, 1,  3491,    0}, {112, 1,  3313,    0}, {105, 1,  3492,    0},
+    { 59, 6, 65535,    0}, { 73, 0,  3493,    1}, { 83, 0,  3494,    2},
+    { 85, 1,  3495,    6}, { 59, 6, 65535,    0}, { 69, 1,  2371,    1},
+    {100, 1,  3485,    0}, {111, 1,  2658,    0}, { 97, 1,  3496,    0},
+    {119, 1,  3497,    0}, { 65, 1,  1762,    0}, { 97, 1,  3500,    0},
+    {105, 1,  3501,    0}, {100, 1,  3502,    0}, { 59, 6, 65535,    0},
+    { 97, 1,  3503,    1}, { 98, 1,  2109,    0}, {109, 1,  3029,    0},
+    { 59, 6, 65535,    0}, {103, 1,  2335,    1}, { 97, 1,  3511,    0},
+    {111, 1,  3512,    0}, {114, 1,  3513,    0}, { 97, 1,  1509,    0},
+    { 97, 0,  3124,    0}, {100, 1,  3514,    2}, {105, 1,  1623,    0},
+    {109, 0,  2380,    0}, {120, 1,  2452,    1}, { 59, 6, 65535,    0},
+    {112, 1,   772,    1}, { 59, 6, 65535,    0}, {109, 1,   772,    1},
+    {113, 1,  3519,    0}, {100, 1,  3521,    0}, { 59, 6, 65535,    0},
+    {111, 1,  3523,    1}, { 98, 1,  3524,    0}, {119, 1,  3525,    0},
+    {114, 1,  1792,    0}, {116, 1,  3526,    0}, { 68, 1,   772,    0},
+    {115, 1,  1772,    0}, { 97, 1,  3528,    0}, {110, 1,  3529,    0},
+    { 59, 6, 65535,    0}, {111, 1,  1102,    1}, {108, 1,  2643,    0},
+    {101, 1,  3387,    0}, {104, 1,  2280,    0}, {100, 0,   772,    0},
+    {117, 1,   772,    1}, {114, 1,  3530,    0}, {114, 1,  3531,    0},
+    {102, 1,  3532,    0}, {103, 1,  3533,    0}, {114, 1,  3534,    0},
+    { 59, 6, 65535,    0}, {111, 1,   925,    1}, {103, 0,  3120,    0},
+    {113, 1,  3535,    1}, { 59, 6, 65535,    0}, { 97, 1,  3536,    1},
+    {112, 1,  3537,    0}, {114, 1,  3538,    0}, { 59, 6, 65535,    0},
+    {100, 0,  3539,    1}, {108, 0,  3540,    2}, {117, 1,   821,    3},
+    {101, 1,  3541,    0}, { 59, 6, 65535,    0}, {117, 1,   772,    1},
+    {108, 1,  2684,    0}, { 97, 0,   772,    0}, { 98, 0,   772,    1},
+    { 99, 1,   772,    2}, {116, 1,  3542,    0}, {103, 1,  3544,    0},
+    { 59, 6, 65535,    0}, { 97, 1,  1792,    1}, {111, 1,  1509,    0},
+    { 59, 6, 65535,    0}, {104, 1,   772,    1}, {114, 1,  3545,    0},
+    {113, 1,  2886,    0}, {110, 1,  3546,    0}, { 97, 1,  2615,    0},
+    {101, 1,  3547,    0}, {105, 1,  3548,    0}, {113, 1,  3549,    0},
+    {100, 1,  3550,    0}, { 97, 1,  3551,    0}, {101, 1,  3552,    0},
+    {101, 1,  2800,    0}, {104, 1,  3553,    0}, { 59, 6, 65535,    0},
+    {101, 0,  3554,    1}, {110, 1,  3555,    3}, {108, 1,  3556,    0},
+    {117, 1,  1658,    0}, {100, 1,  2652,    0}, { 59, 6, 65535,    0},
+    {101, 1,   688,    1}, {111, 1,  3557,    0}, {114, 1,  3558,    0},
+    {104, 1,   909,    0}, {112, 1,  3559,    0}, {115, 1,  3560,    0},
+    { 97, 1,  3561,    0}, {110, 1,  3442,    0}, {108, 1,  1576,    0},
+    { 68, 1,  3562,    0}, {115, 1,  3563,    0}, { 73, 1,  3564,    0},
+    { 67, 1,  3565,    0}, {105, 1,  3566,    0}, {110, 1,  1719,    0},
+    {111, 1,  3567,    0}, {111, 1,  3568,    0}, {101, 0,  3570,    0},
+    {111, 1,  3571,    3}, {105, 1,  3572,    0}, {112, 1,  3573,    0},
+    {111, 1,  3575,    0}, {116, 1,  3576,    0}, {104, 1,  3579,    0},
+    { 97, 1,  3580,    0}, {114, 1,  3581,    0}, {114, 1,  3205,    0},
+    {116, 1,  3582,    0}, { 69, 0,  3583,    0}, { 70, 0,  2942,    2},
+    { 71, 0,  2943,    3}, { 76, 0,  2643,    4}, { 83, 0,  2944,    5},
+    { 84, 1,   791,    6}, {116, 1,  3584,    0}, {110, 1,  3585,    0},
+    {114, 1,  3586,    0}, { 99, 1,  3528,    0}, {108, 1,  3587,    0},
+    {108, 1,  3588,    0}, {111, 1,  3589,    0}, {108, 1,   909,    0},
+    { 98, 1,  3444,    0}, {110, 1,  3590,    0}, {104, 1,  3592,    0},
+    { 59, 6, 65535,    0}, { 65, 0,  1762,    1}, { 86, 1,  3593,    2},
+    { 97, 1,  3594,    0}, {111, 1,  3595,    0}, {101, 1,  3596,    0},
+    {116, 1,  3597,    0}, { 97, 1,  3598,    0}, {108, 1,  3599,    0},
+    { 97, 1,  1923,    0}, {110, 1,  3600,    0}, {116, 1,  3601,    0},
+    {104, 1,  3603,    0}, {102, 1,  3603,    0}, {101, 1,  3604,    0},
+    {114, 1,  3607,    0}, {101, 1,  3608,    0}, {107, 1,  3609,    0},
+    {108, 1,  3610,    0}, {116, 1,  3611,    0}, { 84, 1,  3612,    0},
+    { 59, 6, 65535,    0}, { 69, 0,  2371,    1}, { 71, 0,  2943,    2},
+    { 76, 0,  2643,    3}, { 83, 0,  2944,    4}, { 84, 1,   791,    5},
+    {101, 1,  3613,    0}, {114, 1,  3614,    0}, {114, 1,  3615,    0},
+    {105, 1,  3616,    0}, {108, 1,  3617,    0}, { 99, 1,  3618,    0},
+    {101, 1,  3620,    0}, {101, 1,  3621,    0}, {115, 1,  3622,    0},
+    {105, 1,  3626,    0}, { 69, 0,  3627,    0}, { 85, 1,  3629,    2},
+    {114, 1,  3630,    0}, {112, 1,  1675,    0}, { 97, 1,  3631,    0},
+    {114, 1,  3632,    0}, {110, 1,  3633,    0}, {117, 1,  3634,    0},
+    {110, 1,  3636,    0}, { 99, 1,  2335,    0}, { 59, 6, 65535,    0},
+    { 66, 0,   881,    1}, { 68, 1,  1759,    2}, {108, 1,  3637,    0},
+    {110, 1,  2479,    0}, {116, 1,  3641,    0}, { 97, 0,   772,    0},
+    { 98, 0,   772,    1}, { 99, 0,   772,    2}, {100, 0,   772,    3},
+    {101, 0,   772,    4}, {102, 0,   772,    5}, {103, 0,   772,    6},
+    {104, 1,   772,    7}, {110, 1,  3642,    0}, {122, 1,  3643,    0},
+    {105, 1,  3644,    0}, { 82, 0,   772,    0}, { 83, 0,   772,    1},
+    { 97, 0,  1942,    2}, { 99, 0,   777,    3}, {100, 1,   910,    4},
+    {112, 0,  2281,    0}, {115, 1,  3645,    1}, { 59, 6, 65535,    0},
+    {115, 1,  3646,    1}, {110, 1,  3647,    0}, { 97, 1,  3648,    0},
+    {110, 1,  2872,    0}, {103, 0,  3120,    0}, {108, 1,  2643,    1},
+    {116, 1,  3636,    0}, {116, 1,  3649,    0}, {111, 1,  3650,    0},
+    {112, 1,  3651,    0}, {116, 1,  2872,    0}, {104, 1,  3652,    0},
+    {101, 1,  3653,    0}, {103, 1,  3120,    0}, { 99, 1,  3654,    0},
+    {115, 1,  3559,    0}, {111, 1,  3655,    0}, {111, 1,  1955,    0},
+    {101, 1,  3656,    0}, {100, 1,  1044,    0}, { 59, 6, 65535,    0},
+    {101, 1,  3554,    1}, {108, 1,  3657,    0}, {108, 1,  3658,    0},
+    {105, 1,  3659,    0}, {102, 1,  3660,    0}, {103, 1,  3661,    0},
+    {117, 1,  3662,    0}, {111, 1,  1898,    0}, {114, 1,  3663,    0},
+    {116, 1,  3664,    0}, {116, 1,  3665,    0}, {113, 1,  2634,    0},
+    {101, 1,  3554,    0}, {101, 1,  3667,    0}, {111, 1,  3672,    0},
+    {111, 1,  3673,    0}, {116, 1,   860,    0}, {101, 1,  3674,    0},
+    {110, 1,  3675,    0}, {105, 1,  3676,    0}, {101, 1,  3677,    0},
+    {110, 1,  3678,    0}, {108, 1,  3679,    0}, { 99, 1,  3680,    0},
+    {110, 1,  3681,    0}, {116, 0,   772,    0}, {119, 1,  3016,    1},
+    {102, 1,  3682,    0}, {110, 1,  3683,    0}, {103, 1,  3684,    0},
+    { 65, 0,  1762,    0}, { 68, 1,  1759,    1}, {119, 1,  3685,    0},
+    { 82, 0,  3688,    0}, { 84, 0,  3455,    1}, { 86, 1,  2940,    2},
+    {116, 1,  3590,    0}, {108, 1,  3689,    0}, {121, 1,  3690,    0},
+    {105, 1,  3691,    0}, {113, 1,  3692,    0}, { 97, 1,  3693,    0},
+    { 72, 1,  3694,    0}, {121, 1,  3695,    0}, {101, 1,  3696,    0},
+    {101, 1,  3698,    0}, {119, 1,  3699,    0}, { 84, 0,  3455,    0},
+    { 86, 1,  2940,    1}, {116, 1,  3702,    0}, {101, 1,  3704,    0},
+    {110, 1,  3705,    0}, {119, 1,  3706,    0}, {101, 1,  3707,    0},
+    {111, 1,  3708,    0}, {108, 1,  3709,    0}, { 69, 1,  2371,    0},
+    {116, 1,  3599,    0}, { 65, 0,  1762,    0}, { 82, 1,  2947,    1},
+    {116, 1,  3313,    0}, { 77, 0,  3710,    0}, { 84, 0,  3711,    1},
+    { 86, 1,  3712,    3}, {101, 1,  3713,    0}, {115, 1,  3714,    0},
+    {105, 1,  3715,    0}, {101, 1,  3716,    0}, {101, 1,  3717,    0},
+    {114, 1,  3259,    0}, {100, 1,  3718,    0}, {115, 1,  3719,    0},
+    {101, 1,  3720,    0}, { 99, 1,  3721,    0}, {121, 1,  3722,    0},
+    {101, 0,   772,    0}, {107, 1,  2475,    1}, {110, 1,  3724,    0},
+    {112, 1,  3725,    0}, { 59, 6, 65535,    0}, { 69, 0,  2371,    1},
+    { 83, 0,  2944,    2}, { 84, 1,   791,    3}, {111, 1,  3726,    0},
+    {108, 0,   753,    0}, {113, 1,  2487,    1}, {112, 1,  3727,    0},
+    {111, 1,  3728,    0}, {121, 1,  1891,    0}, { 99, 1,  2620,    0},
+    {116, 1,  3729,    0}, { 98, 0,  3005,    0}, {112, 1,  3287,    2},
+    {105, 1,  1600,    0}, { 66, 0,   881,    0}, { 76, 0,  2430,    1},
+    { 83, 0,  3730,    2}, { 84, 1,   791,    3}, {104, 1,  2479,    0},
+    {103, 1,  3731,    0}, {101, 1,  2713,    0}, { 97, 1,  3732,    0},
+    {117, 1,  3733,    0}, {117, 1,  3329,    0}, {116, 1,  2051,    0},
+    {114, 1,  3734,    0}, {105, 1,  1946,    0}, {119, 1,  3735,    0},
+    {111, 1,  3737,    0}, {116, 1,  3738,    0}, {101, 1,  3647,    0},
+    {104, 1,  2335,    0}, {119, 1,  3741,    0}, {102, 1,  1623,    0},
+    {101, 1,  3743,    0}, {121, 1,  2350,    0}, {111, 1,  1949,    0},
+    {116, 1,  3745,    0}, {104, 1,  3532,    0}, {105, 1,  3747,    0},
+    { 97, 1,  3144,    0}, {109, 1,  2546,    0}, {101, 0,  2874,    0},
+    {112, 1,  3748,    1}, { 59, 6, 65535,    0}, {100, 0,  3539,    1},
+    {108, 0,  3749,    2}, {113, 0,   772,    4}, {114, 1,  3750,    5},
+    {110, 1,  3741,    0}, {119, 1,  1792,    0}, {116, 1,  3751,    0},
+    {103, 1,  3752,    0}, {102, 1,  1646,    0}, { 67, 1,  3420,    0},
+    {116, 1,  3753,    0}, {111, 1,  3754,    0}, { 97, 1,  3755,    0},
+    {116, 1,  2363,    0}, {116, 1,  3756,    0}, {103, 1,  3759,    0},
+    {104, 1,  3761,    0}, { 59, 6, 65535,    0}, { 66, 0,   881,    1},
+    { 85, 1,  3301,    2}, {105, 1,  3762,    0}, {108, 1,  3763,    0},
+    { 83, 1,  3239,    0}, { 97, 1,  3764,    0}, {117, 1,  3765,    0},
+    {108, 1,  1695,    0}, {117, 1,  3766,    0}, { 73, 1,   772,    0},
+    { 67, 0,  3767,    0}, { 84, 1,  2051,    1}, { 66, 1,  3768,    0},
+    { 59, 6, 65535,    0}, { 66, 0,   881,    1}, { 82, 1,  2947,    2},
+    { 65, 0,  1762,    0}, { 86, 1,  3593,    1}, { 99, 1,  3769,    0},
+    {103, 1,  3770,    0}, {110, 1,  3707,    0}, { 86, 1,  3593,    0},
+    {114, 1,  3771,    0}, { 71, 1,  2943,    0}, {101, 1,  3773,    0},
+    {104, 1,  3774,    0}, {101, 1,  3775,    0}, { 97, 1,  3776,    0},
+    {115, 1,  3777,    0}, {110, 1,  3778,    0}, { 86, 1,  2449,    0},
+    {114, 1,  3779,    0}, {101, 1,  3786,    0}, {101, 1,  3787,    0},
+    { 83, 1,  3494,    0}, { 97, 1,  3788,    0}, { 68, 0,  3789,    0},
+    { 81, 1,  3790,    1}, {116, 1,  3791,    0}, {108, 1,  3792,    0},
+    {110, 1,  3793,    0}, { 69, 1,  1760,    0}, {119, 1,  3795,    0},
+    {101, 1,  3798,    0}, {101, 1,  3799,    0}, {108, 1,  3800,    0},
+    {110, 1,  3801,    0}, { 99, 1,  2354,    0}, {119, 1,  1585,    0},
+    { 59, 6, 65535,    0}, {116, 1,  2013,    1}, {111, 1,  3802,    0},
+    { 97, 0,  3803,    0}, {104, 0,  3804,    2}, {115, 1,  3392,    3},
+    {108, 0,  3540,    0}, {114, 1,  3805,    1}, {108, 0,  3749,    0},
+    {114, 1,  3750,    2}, { 97, 0,  3209,    0}, {104, 1,  3804,    1},
+    {103, 1,  2945,    0}, {104, 1,   723,    0}, {101, 1,  3806,    0},
+    {105, 1,  3807,    0}, {110, 1,  3555,    0}, {108, 1,  3808,    0},
+    {101, 1,  3809,    0}, { 99, 1,  2359,    0}, {108, 1,  3810,    0},
+    { 65, 0,  1762,    0}, { 82, 0,  2947,    1}, { 84, 1,  1584,    2},
+    { 76, 0,  2946,    0}, { 82, 1,  2947,    2}, {116, 1,  3814,    0},
+    {103, 1,  3816,    0}, { 83, 1,  2595,    0}, {108, 1,  1979,    0},
+    { 97, 1,  3817,    0}, {109, 1,   821,    0}, {111, 1,  2074,    0},
+    {114, 1,  3818,    0}, {116, 1,  2703,    0}, {108, 1,  3819,    0},
+    { 59, 6, 65535,    0}, { 66, 1,   881,    1}, {100, 1,  1690,    0},
+    {105, 1,  1750,    0}, {114, 1,  3820,    0}, {116, 1,  3821,    0},
+    { 76, 1,  2643,    0}, {103, 1,  2479,    0}, { 59, 6, 65535,    0},
+    { 69, 0,  2371,    1}, { 70, 0,  2942,    2}, { 71, 0,  2943,    3},
+    { 76, 0,  2643,    4}, { 83, 0,  2944,    5}, { 84, 1,   791,    6},
+    {115, 1,  3822,    0}, { 69, 1,  3825,    0}, {108, 1,  3826,    0},
+    {111, 1,  3827,    0}, {117, 1,  3828,    0}, {104, 1,  3829,    0},
+    { 97, 1,  2156,    0}, { 59, 6, 65535,    0}, { 97, 1,  1772,    1},
+    { 59, 6, 65535,    0}, { 66, 0,   881,    1}, { 76, 1,  3270,    2},
+    {114, 1,  2928,    0}, {112, 1,  3830,    0}, {101, 1,  3831,    0},
+    {103, 1,  3833,    0}, {110, 1,  3831,    0}, {114, 1,  3834,    0},
+    { 97, 1,  3835,    0}, {105, 1,  3836,    0}, {102, 1,  2800,    0},
+    {103, 1,  3837,    0}, {101, 1,  3741,    0}, {103, 1,  2927,    0},
+    { 65, 0,   825,    0}, { 68, 0,  3838,    1}, { 71, 0,  3839,    3},
+    { 84, 1,   791,    4}, { 65, 0,  1762,    0}, { 84, 1,  1584,    1},
+    {104, 1,  3840,    0}, {108, 1,  3841,    0}, { 97, 1,  3843,    0},
+    {101, 1,  3844,    0}, {121, 1,  2495,    0}, {101, 1,  3847,    0},
+    { 59, 6, 65535,    0}, { 69, 0,  2371,    1}, { 83, 1,  2944,    2},
+    {108, 1,   753,    0}, { 66, 1,   881,    0}, {117, 1,  3848,    0},
+    {111, 1,  2351,    0}, {101, 1,  3849,    0}, { 97, 1,  3850,    0},
+    {100, 0,  3539,    0}, {117, 1,   821,    1}, {108, 1,  3851,    0},
+    {114, 1,  3852,    0}, {114, 1,  3853,    0}, {103, 1,  2585,    0},
+    {104, 1,  2800,    0}, {111, 1,  3854,    0}, {114, 1,  1122,    0},
+    {116, 1,  3707,    0}, { 59, 6, 65535,    0}, { 76, 1,  2643,    1},
+    { 99, 1,  3856,    0}, { 59, 6, 65535,    0}, { 66, 0,   881,    1},
+    { 69, 1,  2371,    2}, {114, 1,  3709,    0}, { 98, 1,  3857,    0},
+    {115, 1,  1576,    0}, {114, 1,  3858,    0}, {101, 1,  3859,    0},
+    {111, 1,  3863,    0}, {112, 1,  3864,    0}, {116, 0,   772,    0},
+    {117, 1,  3865,    1}, {107, 1,  2475,    0}, {108, 1,  3866,    0},
+    { 97, 1,  3769,    0}, { 59, 6, 65535,    0}, {100, 0,  3539,    1},
+    {108, 0,  3540,    2}, {114, 1,  3805,    3}, {119, 1,  2684,    0},
+    {111, 1,  3659,    0}, { 98, 1,  3867,    0}, {101, 1,  3868,    0},
+    {108, 1,  3869,    0}, { 81, 1,  3790,    0}, {101, 1,  3870,    0},
+    { 65, 1,   825,    0},
+};
+
+// Edge that leaves the root with each ASCII byte, 255 for none
+static const uint8_t st_entity_root[128] = {
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255,   0,   1,   2,   3,   4,   5,   6,
+      7,   8,   9,  10,  11,  12,  13,  14,  15,  16,  17,  18,
+     19,  20,  21,  22,  23,  24,  25, 255, 255, 255, 255, 255,
+    255,  26,  27,  28,  29,  30,  31,  32,  33,  34,  35,  36,
+     37,  38,  39,  40,  41,  42,  43,  44,  45,  46,  47,  48,
+     49,  50,  51, 255, 255, 255, 255, 255,
+};
+
+// Codepoints of each name
+static const uint32_t st_entity_first[ST_ENTITY_COUNT] = {
+       198,    198,     38,     38,    193,    193,    258,    194,
+       194,   1040, 120068,    192,    192,    913,    256,  10835,
+       260, 120120,   8289,    197,    197, 119964,   8788,    195,
+       195,    196,    196,   8726,  10983,   8966,   1041,   8757,
+      8492,    914, 120069, 120121,    728,   8492,   8782,   1063,
+       169,    169,    262,   8914,   8517,   8493,    268,    199,
+       199,    264,   8752,    266,    184,    183,   8493,    935,
+      8857,   8854,   8853,   8855,   8754,   8221,   8217,   8759,
+     10868,   8801,   8751,   8750,   8450,   8720,   8755,  10799,
+    119966,   8915,   8781,   8517,  10513,   1026,   1029,   1039,
+      8225,   8609,  10980,    270,   1044,   8711,    916, 120071,
+       180,    729,    733,     96,    732,   8900,   8518, 120123,
+       168,   8412,   8784,   8751,    168,   8659,   8656,   8660,
+     10980,  10232,  10234,  10233,   8658,   8872,   8657,   8661,
+      8741,   8595,  10515,   8693,    785,  10576,  10590,   8637,
+     10582,  10591,   8641,  10583,   8868,   8615,   8659, 119967,
+       272,    330,    208,    208,    201,    201,    282,    202,
+       202,   1069,    278, 120072,    200,    200,   8712,    274,
+      9723,   9643,    280, 120124,    917,  10869,   8770,   8652,
+      8496,  10867,    919,    203,    203,   8707,   8519,   1060,
+    120073,   9724,   9642, 120125,   8704,   8497,   8497,   1027,
+        62,     62,    915,    988,    286,    290,    284,   1043,
+       288, 120074,   8921, 120126,   8805,   8923,   8807,  10914,
+      8823,  10878,   8819, 119970,   8811,   1066,    711,     94,
+       292,   8460,   8459,   8461,   9472,   8459,    294,   8782,
+      8783,   1045,    306,   1025,    205,    205,    206,    206,
+      1048,    304,   8465,    204,    204,   8465,    298,   8520,
+      8658,   8748,   8747,   8898,   8291,   8290,    302, 120128,
+       921,   8464,    296,   1030,    207,    207,    308,   1049,
+    120077, 120129, 119973,   1032,   1028,   1061,   1036,    922,
+       310,   1050, 120078, 120130, 119974,   1033,     60,     60,
+       313,    923,  10218,   8466,   8606,    317,    315,   1051,
+     10216,   8592,   8676,   8646,   8968,  10214,  10593,   8643,
+     10585,   8970,   8596,  10574,   8867,   8612,  10586,   8882,
+     10703,   8884,  10577,  10592,   8639,  10584,   8636,  10578,
+      8656,   8660,   8922,   8806,   8822,  10913,  10877,   8818,
+    120079,   8920,   8666,    319,  10229,  10231,  10230,  10232,
+     10234,  10233, 120131,   8601,   8600,   8466,   8624,    321,
+      8810,  10501,   1052,   8287,   8499, 120080,   8723, 120132,
+      8499,    924,   1034,    323,    327,    325,   1053,   8203,
+      8203,   8203,   8203,   8811,   8810,     10, 120081,   8288,
+       160,   8469,  10988,   8802,   8813,   8742,   8713,   8800,
+      8770,   8708,   8815,   8817,   8807,   8811,   8825,  10878,
+      8821,   8782,   8783,   8938,  10703,   8940,   8814,   8816,
+      8824,   8810,  10877,   8820,  10914,  10913,   8832,  10927,
+      8928,   8716,   8939,  10704,   8941,   8847,   8930,   8848,
+      8931,   8834,   8840,   8833,  10928,   8929,   8831,   8835,
+      8841,   8769,   8772,   8775,   8777,   8740, 119977,    209,
+       209,    925,    338,    211,    211,    212,    212,   1054,
+       336, 120082,    210,    210,    332,    937,    927, 120134,
+      8220,   8216,  10836, 119978,    216,    216,    213,    213,
+     10807,    214,    214,   8254,   9182,   9140,   9180,   8706,
+      1055, 120083,    934,    928,    177,   8460,   8473,  10939,
+      8826,  10927,   8828,   8830,   8243,   8719,   8759,   8733,
+    119979,    936,     34,     34, 120084,   8474, 119980,  10512,
+       174,    174,    340,  10219,   8608,  10518,    344,    342,
+      1056,   8476,   8715,   8651,  10607,   8476,    929,  10217,
+      8594,   8677,   8644,   8969,  10215,  10589,   8642,  10581,
+      8971,   8866,   8614,  10587,   8883,  10704,   8885,  10575,
+     10588,   8638,  10580,   8640,  10579,   8658,   8477,  10608,
+      8667,   8475,   8625,  10740,   1065,   1064,   1068,    346,
+     10940,    352,    350,    348,   1057, 120086,   8595,   8592,
+      8594,   8593,    931,   8728, 120138,   8730,   9633,   8851,
+      8847,   8849,   8848,   8850,   8852, 119982,   8902,   8912,
+      8912,   8838,   8827,  10928,   8829,   8831,   8715,   8721,
+      8913,   8835,   8839,   8913,    222,    222,   8482,   1035,
+      1062,      9,    932,    356,    354,   1058, 120087,   8756,
+       920,   8287,   8201,   8764,   8771,   8773,   8776, 120139,
+      8411, 119983,    358,    218,    218,   8607,  10569,   1038,
+       364,    219,    219,   1059,    368, 120088,    217,    217,
+       362,     95,   9183,   9141,   9181,   8899,   8846,    370,
+    120140,   8593,  10514,   8645,   8597,  10606,   8869,   8613,
+      8657,   8661,   8598,   8599,    978,    933,    366, 119984,
+       360,    220,    220,   8875,  10987,   1042,   8873,  10982,
+      8897,   8214,   8214,   8739,    124,  10072,   8768,   8202,
+    120089, 120141, 119985,   8874,    372,   8896, 120090, 120142,
+    119986, 120091,    926, 120143, 119987,   1071,   1031,   1070,
+       221,    221,    374,   1067, 120092, 120144, 119988,    376,
+      1046,    377,    381,   1047,    379,   8203,    918,   8488,
+      8484, 119989,    225,    225,    259,   8766,   8766,   8767,
+       226,    226,    180,    180,   1072,    230,    230,   8289,
+    120094,    224,    224,   8501,   8501,    945,    257,  10815,
+        38,     38,   8743,  10837,  10844,  10840,  10842,   8736,
+     10660,   8736,   8737,  10664,  10665,  10666,  10667,  10668,
+     10669,  10670,  10671,   8735,   8894,  10653,   8738,    197,
+      9084,    261, 120146,   8776,  10864,  10863,   8778,   8779,
+        39,   8776,   8778,    229,    229, 119990,     42,   8776,
+      8781,    227,    227,    228,    228,   8755,  10769,  10989,
+      8780,   1014,   8245,   8765,   8909,   8893,   8965,   8965,
+      9141,   9142,   8780,   1073,   8222,   8757,   8757,  10672,
+      1014,   8492,    946,   8502,   8812, 120095,   8898,   9711,
+      8899,  10752,  10753,  10754,  10758,   9733,   9661,   9651,
+     10756,   8897,   8896,  10509,  10731,   9642,   9652,   9662,
+      9666,   9656,   9251,   9618,   9617,   9619,   9608,     61,
+      8801,   8976, 120147,   8869,   8869,   8904,   9559,   9556,
+      9558,   9555,   9552,   9574,   9577,   9572,   9575,   9565,
+      9562,   9564,   9561,   9553,   9580,   9571,   9568,   9579,
+      9570,   9567,  10697,   9557,   9554,   9488,   9484,   9472,
+      9573,   9576,   9516,   9524,   8863,   8862,   8864,   9563,
+      9560,   9496,   9492,   9474,   9578,   9569,   9566,   9532,
+      9508,   9500,   8245,    728,    166,    166, 119991,   8271,
+      8765,   8909,     92,  10693,  10184,   8226,   8226,   8782,
+     10926,   8783,   8783,    263,   8745,  10820,  10825,  10827,
+     10823,  10816,   8745,   8257,    711,  10829,    269,    231,
+       231,    265,  10828,  10832,    267,    184,    184,  10674,
+       162,    162,    183, 120096,   1095,  10003,  10003,    967,
+      9675,  10691,    710,   8791,   8634,   8635,    174,   9416,
+      8859,   8858,   8861,   8791,  10768,  10991,  10690,   9827,
+      9827,     58,   8788,   8788,     44,     64,   8705,   8728,
+      8705,   8450,   8773,  10861,   8750, 120148,   8720,    169,
+       169,   8471,   8629,  10007, 119992,  10959,  10961,  10960,
+     10962,   8943,  10552,  10549,   8926,   8927,   8630,  10557,
+      8746,  10824,  10822,  10826,   8845,  10821,   8746,   8631,
+     10556,   8926,   8927,   8910,   8911,    164,    164,   8630,
+      8631,   8910,   8911,   8754,   8753,   9005,   8659,  10597,
+      8224,   8504,   8595,   8208,   8867,  10511,    733,    271,
+      1076,   8518,   8225,   8650,  10871,    176,    176,    948,
+     10673,  10623, 120097,   8643,   8642,   8900,   8900,   9830,
+      9830,    168,    989,   8946,    247,    247,    247,   8903,
+      8903,   1106,   8990,   8973,     36, 120149,    729,   8784,
+      8785,   8760,   8724,   8865,   8966,   8595,   8650,   8643,
+      8642,  10512,   8991,   8972, 119993,   1109,  10742,    273,
+      8945,   9663,   9662,   8693,  10607,  10662,   1119,  10239,
+     10871,   8785,    233,    233,  10862,    283,   8790,    234,
+       234,   8789,   1101,    279,   8519,   8786, 120098,  10906,
+       232,    232,  10902,  10904,  10905,   9191,   8467,  10901,
+     10903,    275,   8709,   8709,   8709,   8196,   8197,   8195,
+       331,   8194,    281, 120150,   8917,  10723,  10865,    949,
+       949,   1013,   8790,   8789,   8770,  10902,  10901,     61,
+      8799,   8801,  10872,  10725,   8787,  10609,   8495,   8784,
+      8770,    951,    240,    240,    235,    235,   8364,     33,
+      8707,   8496,   8519,   8786,   1092,   9792,  64259,  64256,
+     64260, 120099,  64257,    102,   9837,  64258,   9649,    402,
+    120151,   8704,   8916,  10969,  10765,    189,    189,   8531,
+       188,    188,   8533,   8537,   8539,   8532,   8534,    190,
+       190,   8535,   8540,   8536,   8538,   8541,   8542,   8260,
+      8994, 119995,   8807,  10892,    501,    947,    989,  10886,
+       287,    285,   1075,    289,   8805,   8923,   8805,   8807,
+     10878,  10878,  10921,  10880,  10882,  10884,   8923,  10900,
+    120100,   8811,   8921,   8503,   1107,   8823,  10898,  10917,
+     10916,   8809,  10890,  10890,  10888,  10888,   8809,   8935,
+    120152,     96,   8458,   8819,  10894,  10896,     62,     62,
+     10919,  10874,   8919,  10645,  10876,  10886,  10616,   8919,
+      8923,  10892,   8823,   8819,   8809,   8809,   8660,   8202,
+       189,   8459,   1098,   8596,  10568,   8621,   8463,    293,
+      9829,   9829,   8230,   8889, 120101,  10533,  10534,   8703,
+      8763,   8617,   8618, 120153,   8213, 119997,   8463,    295,
+      8259,   8208,    237,    237,   8291,    238,    238,   1080,
+      1077,    161,    161,   8660, 120102,    236,    236,   8520,
+     10764,   8749,  10716,   8489,    307,    299,   8465,   8464,
+      8465,    305,   8887,    437,   8712,   8453,   8734,  10717,
+       305,   8747,   8890,   8484,   8890,  10775,  10812,   1105,
+       303, 120154,    953,  10812,    191,    191, 119998,   8712,
+      8953,   8949,   8948,   8947,   8712,   8290,    297,   1110,
+       239,    239,    309,   1081, 120103,    567, 120155, 119999,
+      1112,   1108,    954,   1008,    311,   1082, 120104,    312,
+      1093,   1116, 120156, 120000,   8666,   8656,  10523,  10510,
+      8806,  10891,  10594,    314,  10676,   8466,    955,  10216,
+     10641,  10216,  10885,    171,    171,   8592,   8676,  10527,
+     10525,   8617,   8619,  10553,  10611,   8610,  10923,  10521,
+     10925,  10925,  10508,  10098,    123,     91,  10635,  10639,
+     10637,    318,    316,   8968,    123,   1083,  10550,   8220,
+      8222,  10599,  10571,   8626,   8804,   8592,   8610,   8637,
+      8636,   8647,   8596,   8646,   8651,   8621,   8907,   8922,
+      8804,   8806,  10877,  10877,  10920,  10879,  10881,  10883,
+      8922,  10899,  10885,   8918,   8922,  10891,   8822,   8818,
+     10620,   8970, 120105,   8822,  10897,   8637,   8636,  10602,
+      9604,   1113,   8810,   8647,   8990,  10603,   9722,    320,
+      9136,   9136,   8808,  10889,  10889,  10887,  10887,   8808,
+      8934,  10220,   8701,  10214,  10229,  10231,  10236,  10230,
+      8619,   8620,  10629, 120157,  10797,  10804,   8727,     95,
+      9674,   9674,  10731,     40,  10643,   8646,   8991,   8651,
+     10605,   8206,   8895,   8249, 120001,   8624,   8818,  10893,
+     10895,     91,   8216,   8218,    322,     60,     60,  10918,
+     10873,   8918,   8907,   8905,  10614,  10875,  10646,   9667,
+      8884,   9666,  10570,  10598,   8808,   8808,   8762,    175,
+       175,   9794,  10016,  10016,   8614,   8614,   8615,   8612,
+      8613,   9646,  10793,   1084,   8212,   8737, 120106,   8487,
+       181,    181,   8739,     42,  10992,    183,    183,   8722,
+      8863,   8760,  10794,  10971,   8230,   8723,   8871, 120158,
+      8723, 120002,   8766,    956,   8888,   8888,   8921,   8811,
+      8811,   8653,   8654,   8920,   8810,   8810,   8655,   8879,
+      8878,   8711,    324,   8736,   8777,  10864,   8779,    329,
+      8777,   9838,   9838,   8469,    160,    160,   8782,   8783,
+     10819,    328,    326,   8775,  10861,  10818,   1085,   8211,
+      8800,   8663,  10532,   8599,   8599,   8784,   8802,  10536,
+      8770,   8708,   8708, 120107,   8807,   8817,   8817,   8807,
+     10878,  10878,   8821,   8815,   8815,   8654,   8622,  10994,
+      8715,   8956,   8954,   8715,   1114,   8653,   8806,   8602,
+      8229,   8816,   8602,   8622,   8816,   8806,  10877,  10877,
+      8814,   8820,   8814,   8938,   8940,   8740, 120159,    172,
+       172,   8713,   8953,   8949,   8713,   8951,   8950,   8716,
+      8716,   8958,   8957,   8742,   8742,  11005,   8706,  10772,
+      8832,   8928,  10927,   8832,  10927,   8655,   8603,  10547,
+      8605,   8603,   8939,   8941,   8833,   8929,  10928, 120003,
+      8740,   8742,   8769,   8772,   8772,   8740,   8742,   8930,
+      8931,   8836,  10949,   8840,   8834,   8840,  10949,   8833,
+     10928,   8837,  10950,   8841,   8835,   8841,  10950,   8825,
+       241,    241,   8824,   8938,   8940,   8939,   8941,    957,
+        35,   8470,   8199,   8877,  10500,   8781,   8876,   8805,
+        62,  10718,  10498,   8804,     60,   8884,  10499,   8885,
+      8764,   8662,  10531,   8598,   8598,  10535,   9416,    243,
+       243,   8859,   8858,    244,    244,   1086,   8861,    337,
+     10808,   8857,  10684,    339,  10687, 120108,    731,    242,
+       242,  10689,  10677,    937,   8750,   8634,  10686,  10683,
+      8254,  10688,    333,    969,    959,  10678,   8854, 120160,
+     10679,  10681,   8853,   8744,   8635,  10845,   8500,   8500,
+       170,    170,    186,    186,   8886,  10838,  10839,  10843,
+      8500,    248,    248,   8856,    245,    245,   8855,  10806,
+       246,    246,   9021,   8741,    182,    182,   8741,  10995,
+     11005,   8706,   1087,     37,     46,   8240,   8869,   8241,
+    120109,    966,    981,   8499,   9742,    960,   8916,    982,
+      8463,   8462,   8463,     43,  10787,   8862,  10786,   8724,
+     10789,  10866,    177,    177,  10790,  10791,    177,  10773,
+    120161,    163,    163,   8826,  10931,  10935,   8828,  10927,
+      8826,  10935,   8828,  10927,  10937,  10933,   8936,   8830,
+      8242,   8473,  10933,  10937,   8936,   8719,   9006,   8978,
+      8979,   8733,   8733,   8830,   8880, 120005,    968,   8200,
+    120110,  10764, 120162,   8279, 120006,   8461,  10774,     63,
+      8799,     34,     34,   8667,   8658,  10524,  10511,  10596,
+      8765,    341,   8730,  10675,  10217,  10642,  10661,  10217,
+       187,    187,   8594,  10613,   8677,  10528,  10547,  10526,
+      8618,   8620,  10565,  10612,   8611,   8605,  10522,   8758,
+      8474,  10509,  10099,    125,     93,  10636,  10638,  10640,
+       345,    343,   8969,    125,   1088,  10551,  10601,   8221,
+      8221,   8627,   8476,   8475,   8476,   8477,   9645,    174,
+       174,  10621,   8971, 120111,   8641,   8640,  10604,    961,
+      1009,   8594,   8611,   8641,   8640,   8644,   8652,   8649,
+      8605,   8908,    730,   8787,   8644,   8652,   8207,   9137,
+      9137,  10990,  10221,   8702,  10215,  10630, 120163,  10798,
+     10805,     41,  10644,  10770,   8649,   8250, 120007,   8625,
+        93,   8217,   8217,   8908,   8906,   9657,   8885,   9656,
+     10702,  10600,   8478,    347,   8218,   8827,  10932,  10936,
+       353,   8829,  10928,    351,    349,  10934,  10938,   8937,
+     10771,   8831,   1089,   8901,   8865,  10854,   8664,  10533,
+      8600,   8600,    167,    167,     59,  10537,   8726,   8726,
+     10038, 120112,   8994,   9839,   1097,   1096,   8739,   8741,
+       173,    173,    963,    962,    962,   8764,  10858,   8771,
+      8771,  10910,  10912,  10909,  10911,   8774,  10788,  10610,
+      8592,   8726,  10803,  10724,   8739,   8995,  10922,  10924,
+     10924,   1100,     47,  10692,   9023, 120164,   9824,   9824,
+      8741,   8851,   8851,   8852,   8852,   8847,   8849,   8847,
+      8849,   8848,   8850,   8848,   8850,   9633,   9633,   9642,
+      9642,   8594, 120008,   8726,   8995,   8902,   9734,   9733,
+      1013,    981,    175,   8834,  10949,  10941,   8838,  10947,
+     10945,  10955,   8842,  10943,  10617,   8834,   8838,  10949,
+      8842,  10955,  10951,  10965,  10963,   8827,  10936,   8829,
+     10928,  10938,  10934,   8937,   8831,   8721,   9834,    185,
+       185,    178,    178,    179,    179,   8835,  10950,  10942,
+     10968,   8839,  10948,  10185,  10967,  10619,  10946,  10956,
+      8843,  10944,   8835,   8839,  10950,   8843,  10956,  10952,
+     10964,  10966,   8665,  10534,   8601,   8601,  10538,    223,
+       223,   8982,    964,   9140,    357,    355,   1090,   8411,
+      8981, 120113,   8756,   8756,    952,    977,    977,   8776,
+      8764,   8201,   8776,   8764,    254,    254,    732,    215,
+       215,   8864,  10801,  10800,   8749,  10536,   8868,   9014,
+     10993, 120165,  10970,  10537,   8244,   8482,   9653,   9663,
+      9667,   8884,   8796,   9657,   8885,   9708,   8796,  10810,
+     10809,  10701,  10811,   9186, 120009,   1094,   1115,    359,
+      8812,   8606,   8608,   8657,  10595,    250,    250,   8593,
+      1118,    365,    251,    251,   1091,   8645,    369,  10606,
+     10622, 120114,    249,    249,   8639,   8638,   9600,   8988,
+      8988,   8975,   9720,    363,    168,    168,    371, 120166,
+      8593,   8597,   8639,   8638,   8846,    965,    978,    965,
+      8648,   8989,   8989,   8974,    367,   9721, 120010,   8944,
+       361,   9653,   9652,   8648,    252,    252,  10663,   8661,
+     10984,  10985,   8872,  10652,   1013,   1008,   8709,    981,
+       982,   8733,   8597,   1009,    962,   8842,  10955,   8843,
+     10956,    977,   8882,   8883,   1074,   8866,   8744,   8891,
+      8794,   8942,    124,    124, 120115,   8882,   8834,   8835,
+    120167,   8733,   8883, 120011,  10955,   8842,  10956,   8843,
+     10650,    373,  10847,   8743,   8793,   8472, 120116, 120168,
+      8472,   8768,   8768, 120012,   8898,   9711,   8899,   9661,
+    120117,  10234,  10231,    958,  10232,  10229,  10236,   8955,
+     10752, 120169,  10753,  10754,  10233,  10230, 120013,  10758,
+     10756,   9651,   8897,   8896,    253,    253,   1103,    375,
+      1099,    165,    165, 120118,   1111, 120170, 120014,   1102,
+       255,    255,    378,    382,   1079,    380,   8488,    950,
+    120119,   1078,   8669, 120171, 120015,   8205,   8204,
+};
+
+static const uint16_t st_entity_second[ST_ENTITY_COUNT] = {
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,   824,     0,     0,     0,
+      824,   824,     0,   824,     0,   824,   824,     0,   824,     0,
+        0,     0,     0,   824,   824,     0,   824,   824,     0,   824,
+        0,     0,     0,   824,     0,   824,     0,   824,     0,  8402,
+        0,     0,   824,     0,   824,  8402,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,  8202,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,   819,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,  8421,  8421,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0, 65024,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0, 65024,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,   106,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+    65024,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0, 65024, 65024,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0, 65024,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+    65024,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0, 65024, 65024,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,   824,  8402,   824,     0,
+        0,   824,  8402,   824,     0,     0,     0,     0,     0,  8402,
+        0,   824,   824,     0,     0,     0,     0,     0,     0,     0,
+      824,   824,     0,     0,     0,     0,   824,     0,     0,     0,
+        0,     0,     0,     0,     0,   824,     0,     0,   824,     0,
+        0,     0,   824,     0,     0,   824,   824,   824,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+      824,     0,     0,     0,     0,     0,     0,   824,   824,   824,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+      824,   824,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,  8421,   824,     0,     0,     0,   824,     0,   824,     0,
+        0,   824,   824,     0,     0,     0,     0,     0,   824,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+      824,     0,  8402,     0,   824,     0,   824,     0,   824,     0,
+     8402,     0,   824,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,  8402,     0,  8402,
+     8402,     0,     0,  8402,  8402,  8402,     0,  8402,  8402,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+      817,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+    65024,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+    65024,     0, 65024,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0, 65024, 65024, 65024, 65024,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,  8402,  8402,
+        0,     0,     0,     0, 65024, 65024, 65024, 65024,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,
+};
+
+st_entity_result_t st_entity_step(uint32_t *node, uint32_t *index,
+        uint8_t byte, uint32_t *match)
+{
+    const st_entity_edge_t *edge;
+    uint32_t i = *node;
+
+    if (i == ST_ENTITY_ROOT) {
+        if (byte >= 128 || st_entity_root[byte] == 255)
+            return st_entity_none;
+        i = st_entity_root[byte];
+    } else if (i == ST_ENTITY_END) {
+        return st_entity_none;
+    }
+
+    // The edges of a node are sorted by byte
+    for (;; i++) {
+        edge = &st_entity_edges[i];
+        if (edge->byte == byte)
+            break;
+        if (edge->byte > byte || (edge->flags & ST_ENTITY_LAST))
+            return st_entity_none;
+    }
+
+    *index += edge->skip;
+    *node = (edge->flags & ST_ENTITY_LEAF) ? ST_ENTITY_END : edge->node;
+
+    if (!(edge->flags & ST_ENTITY_FINAL))
+        return st_entity_prefix;
+
+    // The name ends here, and the names that continue it come after it
+    *match = (*index)++;
+
+    return st_entity_match;
+}
+
+size_t st_entity_codepoints(uint32_t index, uint32_t codepoints[2])
+{
+    if (index >= ST_ENTITY_COUNT)
+        return 0;
+
+    codepoints[0] = st_entity_first[index];
+    codepoints[1] = st_entity_second[index];
+
+    return codepoints[1] != 0 ? 2 : 1;
+}
@@ -0,0 +1,36 @@
+// Generated by tools/gen_entities.py, do not edit
+#ifndef entity_h
+#define entity_h
+
+#include <stdlib.h>
+#include <stdint.h>
+
+// Number of named character references
+#define ST_ENTITY_COUNT 2231
+
+// Length of the longest name, without the ampersand
+#define ST_ENTITY_MAX_LENGTH 32
+
+// Node a walk starts at, and the node past the end of a name that no
+// other name continues
+#define ST_ENTITY_ROOT 0
+#define ST_ENTITY_END 65535
+
+// Result of a step
+typedef enum {
+    st_entity_none = 0,             // No name continues with the byte
+    st_entity_prefix,               // The bytes so far start a name
+    st_entity_match,                // The bytes so far are a name
+} st_entity_result_t;
+
+// Walk one byte of a name, the one after the ampersand first. Node and
+// index start at ST_ENTITY_ROOT and 0, and are left alone when no name
+// continues with the byte. On a match, match is set to the number of the
+// name.
+st_entity_result_t st_entity_step(uint32_t *node, uint32_t *index,
+        uint8_t byte, uint32_t *match);
+
+// Get the one or two codepoints of a name, returns how many there are
+size_t st_entity_codepoints(uint32_t index, uint32_t codepoints[2]);
+
+#endif
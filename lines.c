@@ -0,0 +1,133 @@
+#include "lines.h"
+
+#include <string.h>
+
+#include "scan.h"
+
+struct st_lines {
+    const uint8_t *doc;                     // The document, not owned
+    size_t len;                             // Length of the document
+
+    size_t offset;                          // Offset looked up last, and the
+    size_t line;                            // number of its line
+
+    size_t *starts;                         // Offsets of the starts of all
+    size_t num_starts;                      // lines but the first, once an
+    size_t allocated_starts;                // offset went back. Kept for
+                                            // the next document.
+    int indexed;                            // If starts is for the document
+
+    st_allocator_t allocator;               // Allocator of the counter
+};
+
+st_status st_lines_init(st_lines_t **lines, const st_allocator_t *allocator)
+{
+    allocator = st_allocator(allocator);
+
+    *lines = st_malloc(allocator, sizeof(**lines));
+    if (*lines == NULL)
+        return st_out_of_memory;
+
+    memset(*lines, 0, sizeof(**lines));
+    (*lines)->allocator = *allocator;
+    (*lines)->line = 1;
+
+    return st_ok;
+}
+
+void st_lines_free(st_lines_t *lines)
+{
+    if (lines == NULL)
+        return;
+
+    st_free(&lines->allocator, lines->starts);
+    st_free(&lines->allocator, lines);
+}
+
+void st_lines_set(st_lines_t *lines, const uint8_t *doc, size_t len)
+{
+    lines->doc = doc;
+    lines->len = len;
+    lines->offset = 0;
+    lines->line = 1;
+    lines->indexed = 0;
+}
+
+// Find the starts of all lines of the document
+static st_status st_lines_index(st_lines_t *lines)
+{
+    size_t n = st_scan_lines(lines->doc, lines->len, NULL);
+
+    if (n > lines->allocated_starts) {
+        size_t *starts = st_realloc(&lines->allocator, lines->starts,
+                n * sizeof(*starts));
+        if (starts == NULL)
+            return st_out_of_memory;
+
+        lines->starts = starts;
+        lines->allocated_starts = n;
+    }
+
+    lines->num_starts = st_scan_lines(lines->doc, lines->len, lines->starts);
+    lines->indexed = 1;
+
+    return st_ok;
+}
+
+st_status st_lines_position(st_lines_t *lines, size_t offset,
+        size_t *line, size_t *column)
+{
+    const uint8_t *doc = lines->doc;
+    size_t start;
+
+    if (doc == NULL || offset > lines->len)
+        return st_not_found;
+
+    // The LF of a CR LF belongs with the CR
+    if (offset > 0 && offset < lines->len
+            && doc[offset] == '\n' && doc[offset - 1] == '\r')
+        offset--;
+
+    start = offset;
+
+    if (lines->indexed || (offset < lines->offset
+                && st_lines_index(lines) == st_ok)) {
+        // Number of lines that start at or before the offset
+        size_t lo = 0, hi = lines->num_starts;
+
+        while (lo < hi) {
+            size_t mid = lo + (hi - lo) / 2;
+
+            if (lines->starts[mid] <= offset)
+                lo = mid + 1;
+            else
+                hi = mid;
+        }
+
+        *line = lo + 1;
+        start = lo > 0 ? lines->starts[lo - 1] : 0;
+    } else {
+        // Count on from the offset looked up last, or from the start when
+        // there is no memory for the index
+        if (offset < lines->offset) {
+            lines->offset = 0;
+            lines->line = 1;
+        }
+
+        lines->line += st_scan_lines(doc + lines->offset,
+                offset - lines->offset, NULL);
+        lines->offset = offset;
+
+        *line = lines->line;
+
+        while (start > 0 && doc[start - 1] != '\n' && doc[start - 1] != '\r')
+            start--;
+    }
+
+    // Every byte but the continuation bytes starts a character
+    *column = 1;
+    for (size_t i = start; i < offset; i++)
+        *column += (doc[i] & 0xC0) != 0x80;
+
+    return st_ok;
+}
@@ -0,0 +1,33 @@
+#ifndef lines_h
+#define lines_h
+
+#include "styre.h"
+#include "alloc.h"
+
+#include <stdlib.h>
+#include <stdint.h>
+
+typedef struct st_lines st_lines_t;
+
+// Create a line counter, allocated from allocator, or from libc when it is
+// NULL
+st_status st_lines_init(st_lines_t **lines, const st_allocator_t *allocator);
+
+// Free a line counter
+void st_lines_free(st_lines_t *lines);
+
+// Start on a document that is in memory as a whole, or on none when doc is
+// NULL. The document is not copied, and must stay valid while positions are
+// looked up in it.
+void st_lines_set(st_lines_t *lines, const uint8_t *doc, size_t len);
+
+// Get the line and column of a byte offset into the document, both counted
+// from 1, with the column in characters of UTF-8. Lines end at LF, CR LF or
+// CR, and the LF of a CR LF has the position of the CR. Lines are counted
+// on from the offset that was looked up last, and an offset before it builds
+// an index of all lines, which is searched from then on. Returns
+// st_not_found for an offset past the end of the document.
+st_status st_lines_position(st_lines_t *lines, size_t offset,
+        size_t *line, size_t *column);
+
+#endif
@@ -24,60 +24,59 @@ void tokenizer_error(st_tokenizer_t *tokenizer, const char *msg, void *ctx)
 }
 
 void print_tag_token(st_tokenizer_t *t, st_token_t *token, char *type) {
-    st_status rc;
-
-    uint8_t *name;
-    uint8_t *val;
-    size_t bytes;
-
-    if ((rc = st_token_tag_name(token, &name, &bytes)) != st_ok) {
-        fprintf(stderr, "Unable to encode token name\n");
-        if (rc != st_out_of_memory) {
-            free(name);
-        }
-        return;
-    }
+    const uint8_t *name;
+    const uint8_t *val;
+    size_t name_len;
+    size_t val_len;
 
-    fprintf(stderr, "Got %s token %s:\n", type, name);
+    st_token_tag_name_view(token, &name, &name_len);
 
-    free(name);
+    fprintf(stderr, "Got %s token %.*s:\n", type, (int)name_len, name);
 
     size_t attributes = st_token_attr_num(token);
     if (attributes > 0) {
         for (int i = 0; i < attributes; i++) {
-            if ((rc = st_token_attr_name(token, i, &name, &bytes)) != st_ok) {
-                if (rc != st_out_of_memory) {
-                    free(name);
-                }
-                fprintf(stderr, "Unable to get attribute name\n");
-                return;
-            }
-
-            if ((rc = st_token_attr_value(token, i, &val, &bytes)) != st_ok) {
-                if (rc != st_out_of_memory) {
-                    free(val);
-                }
-                fprintf(stderr, "Unable to get attribute value\n");
-                return;
-            }
-
-            fprintf(stderr, " %s=%s\n", name, val);
-
-            // Clean up memory
-            free(name);
-            free(val);
+            st_token_attr_name_view(token, i, &name, &name_len);
+            st_token_attr_value_view(token, i, &val, &val_len);
+
+            fprintf(stderr, " %.*s=%.*s\n", (int)name_len, name,
+                    (int)val_len, val);
         }
     } else {
         fprintf(stderr, " No attributes\n");
     }
 }
 
+void print_text_token(st_tokenizer_t *t, st_token_t *token) {
+    const uint8_t *text;
+    size_t len;
+
+    st_token_text(token, &text, &len);
+
+    fprintf(stderr, "Got text token: \"%.*s\"\n", (int)len, text);
+}
+
+void print_error_token(st_tokenizer_t *t, st_token_t *token) {
+    size_t line, column;
+
+    if (st_tokenizer_position(t, st_token_error_offset(token),
+                &line, &column) == st_ok) {
+        fprintf(stderr, "Got error at %zu:%zu: %s\n", line, column,
+                st_token_error_message(token));
+    } else {
+        fprintf(stderr, "Got error: %s\n", st_token_error_message(token));
+    }
+}
+
 void tokenizer_token(st_tokenizer_t *tokenizer, st_token_t *token, void *ctx)
 {
     switch(st_token_type(token)) {
         case st_token_type_character:
-            fprintf(stderr, "Got character token: U+%04X\n",
-                    st_token_codepoint(token));
+        case st_token_type_text:
+            print_text_token(tokenizer, token);
+            break;
+        case st_token_type_error:
+            print_error_token(tokenizer, token);
             break;
         case st_token_type_eof:
             fprintf(stderr, "Reached end of string!\n");
@@ -109,12 +108,14 @@ int main() {
         .error = &tokenizer_error,
     };
 
-    st_tokenizer_init(&tokenizer, &callbacks, NULL);
+    st_tokenizer_init(&tokenizer, &callbacks, NULL, NULL);
 
     st_tokenizer_set_string(tokenizer, xml, sizeof(xml));
     if ((rc = st_tokenizer_run(tokenizer)) != st_ok) {
         fprintf(stderr, "Invalid state: %d\n", rc);
     }
 
+    st_tokenizer_destroy(tokenizer);
+
     return 0;
 }
@@ -0,0 +1,240 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include "pool.h"
+
+#include <string.h>
+#include <pthread.h>
+#include <unistd.h>
+
+typedef struct st_pool_worker st_pool_worker_t;
+
+struct st_pool_worker {
+    st_pool_t *pool;                        // Pool the worker belongs to
+    st_tokenizer_t *t;                      // Tokenizer reused for every
+                                            // document
+    pthread_t thread;
+
+    pthread_mutex_t lock;                   // Protects the range
+    size_t next;                            // Next document to tokenize
+    size_t end;                             // End of the documents left
+};
+
+struct st_pool {
+    st_pool_worker_t *workers;
+    size_t num_workers;
+
+    pthread_mutex_t lock;                   // Protects the fields below
+    pthread_cond_t start;                   // Signals a new run
+    pthread_cond_t done;                    // Signals the end of a run
+    unsigned long generation;               // Number of runs started
+    size_t active;                          // Workers still in the run
+    int quit;                               // The workers should exit
+
+    st_pool_document_t *docs;               // Documents of the current run
+
+    st_allocator_t allocator;               // Allocator of the pool
+};
+
+// Take the next document from the worker's own range
+static int st_pool_take(st_pool_worker_t *w, size_t *index)
+{
+    int found = 0;
+
+    pthread_mutex_lock(&w->lock);
+    if (w->next < w->end) {
+        *index = w->next++;
+        found = 1;
+    }
+    pthread_mutex_unlock(&w->lock);
+
+    return found;
+}
+
+// Steal the back half of the range of another worker
+static int st_pool_steal(st_pool_worker_t *w)
+{
+    st_pool_t *pool = w->pool;
+    size_t self = w - pool->workers;
+
+    for (size_t i = 1; i < pool->num_workers; i++) {
+        st_pool_worker_t *victim =
+            &pool->workers[(self + i) % pool->num_workers];
+        size_t next = 0, end = 0;
+
+        pthread_mutex_lock(&victim->lock);
+        if (victim->next < victim->end) {
+            size_t n = (victim->end - victim->next + 1) / 2;
+
+            end = victim->end;
+            next = end - n;
+            victim->end = next;
+        }
+        pthread_mutex_unlock(&victim->lock);
+
+        if (next < end) {
+            pthread_mutex_lock(&w->lock);
+            w->next = next;
+            w->end = end;
+            pthread_mutex_unlock(&w->lock);
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+static void st_pool_tokenize(st_pool_worker_t *w, st_pool_document_t *doc)
+{
+    st_tokenizer_set_context(w->t, doc->ctx);
+
+    if ((doc->rc = st_tokenizer_set_string(w->t, doc->buf, doc->len))
+            == st_ok) {
+        doc->rc = st_tokenizer_run(w->t);
+    }
+}
+
+static void *st_pool_worker(void *arg)
+{
+    st_pool_worker_t *w = arg;
+    st_pool_t *pool = w->pool;
+    unsigned long generation = 0;
+
+    for (;;) {
+        pthread_mutex_lock(&pool->lock);
+        while (pool->generation == generation && !pool->quit)
+            pthread_cond_wait(&pool->start, &pool->lock);
+
+        if (pool->quit) {
+            pthread_mutex_unlock(&pool->lock);
+            return NULL;
+        }
+
+        generation = pool->generation;
+        st_pool_document_t *docs = pool->docs;
+        pthread_mutex_unlock(&pool->lock);
+
+        // Work through the own range, then help the others
+        do {
+            size_t index;
+
+            while (st_pool_take(w, &index))
+                st_pool_tokenize(w, &docs[index]);
+        } while (st_pool_steal(w));
+
+        pthread_mutex_lock(&pool->lock);
+        if (--pool->active == 0)
+            pthread_cond_signal(&pool->done);
+        pthread_mutex_unlock(&pool->lock);
+    }
+}
+
+st_status st_pool_init(st_pool_t **pool, size_t threads,
+        st_tokenizer_callbacks_t *callbacks, const st_allocator_t *allocator)
+{
+    st_pool_t *p;
+    size_t i;
+
+    if (threads == 0) {
+        long n = sysconf(_SC_NPROCESSORS_ONLN);
+        threads = n > 0 ? n : 1;
+    }
+
+    allocator = st_allocator(allocator);
+
+    *pool = p = st_malloc(allocator, sizeof(*p));
+    if (p == NULL)
+        return st_out_of_memory;
+
+    memset(p, 0, sizeof(*p));
+    p->allocator = *allocator;
+    pthread_mutex_init(&p->lock, NULL);
+    pthread_cond_init(&p->start, NULL);
+    pthread_cond_init(&p->done, NULL);
+
+    p->workers = st_malloc(allocator, threads * sizeof(*p->workers));
+    if (p->workers == NULL) {
+        st_pool_free(p);
+        return st_out_of_memory;
+    }
+
+    memset(p->workers, 0, threads * sizeof(*p->workers));
+
+    for (i = 0; i < threads; i++) {
+        st_pool_worker_t *w = &p->workers[i];
+
+        w->pool = p;
+        pthread_mutex_init(&w->lock, NULL);
+
+        if (st_tokenizer_init(&w->t, callbacks, NULL, allocator) != 0)
+            break;
+
+        if (pthread_create(&w->thread, NULL, &st_pool_worker, w) != 0) {
+            st_tokenizer_destroy(w->t);
+            break;
+        }
+
+        p->num_workers++;
+    }
+
+    if (p->num_workers < threads) {
+        pthread_mutex_destroy(&p->workers[p->num_workers].lock);
+        st_pool_free(p);
+        return st_err;
+    }
+
+    return st_ok;
+}
+
+void st_pool_free(st_pool_t *pool)
+{
+    if (pool == NULL)
+        return;
+
+    pthread_mutex_lock(&pool->lock);
+    pool->quit = 1;
+    pthread_cond_broadcast(&pool->start);
+    pthread_mutex_unlock(&pool->lock);
+
+    for (size_t i = 0; i < pool->num_workers; i++) {
+        st_pool_worker_t *w = &pool->workers[i];
+
+        pthread_join(w->thread, NULL);
+        st_tokenizer_destroy(w->t);
+        pthread_mutex_destroy(&w->lock);
+    }
+
+    pthread_mutex_destroy(&pool->lock);
+    pthread_cond_destroy(&pool->start);
+    pthread_cond_destroy(&pool->done);
+
+    st_free(&pool->allocator, pool->workers);
+    st_free(&pool->allocator, pool);
+}
+
+st_status st_pool_run(st_pool_t *pool, st_pool_document_t *docs,
+        size_t num_docs)
+{
+    size_t n = pool->num_workers;
+
+    // Share the documents out in even, contiguous ranges
+    for (size_t i = 0; i < n; i++) {
+        st_pool_worker_t *w = &pool->workers[i];
+
+        pthread_mutex_lock(&w->lock);
+        w->next = num_docs * i / n;
+        w->end = num_docs * (i + 1) / n;
+        pthread_mutex_unlock(&w->lock);
+    }
+
+    pthread_mutex_lock(&pool->lock);
+    pool->docs = docs;
+    pool->active = n;
+    pool->generation++;
+    pthread_cond_broadcast(&pool->start);
+
+    while (pool->active > 0)
+        pthread_cond_wait(&pool->done, &pool->lock);
+    pthread_mutex_unlock(&pool->lock);
+
+    return st_ok;
+}
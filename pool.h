@@ -0,0 +1,38 @@
+#ifndef pool_h
+#define pool_h
+
+#include "styre.h"
+#include "tokenizer.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+
+typedef struct st_pool st_pool_t;
+
+// A document to tokenize. The callbacks for the document are called with ctx
+// as their context, and rc is set to the result of st_tokenizer_run.
+typedef struct {
+    const uint8_t *buf;             // UTF-8 input
+    size_t len;                     // Length of the input
+    void *ctx;                      // Context for the callbacks
+    st_status rc;                   // Result of tokenizing the document
+} st_pool_document_t;
+
+// Create a pool of worker threads, one per CPU when threads is 0. Each worker
+// keeps its own tokenizer with the given callbacks, which are called from the
+// worker threads. The pool and the tokenizers are allocated from allocator,
+// or from libc when it is NULL. The allocator is called from all workers at
+// once.
+st_status st_pool_init(st_pool_t **pool, size_t threads,
+        st_tokenizer_callbacks_t *callbacks, const st_allocator_t *allocator);
+
+// Stop the workers and free the pool
+void st_pool_free(st_pool_t *pool);
+
+// Tokenize all documents and return when they are done. The documents are
+// shared out evenly, and a worker that runs out steals half of what is left
+// to another, so a few large documents do not hold up the rest.
+st_status st_pool_run(st_pool_t *pool, st_pool_document_t *docs,
+        size_t num_docs);
+
+#endif
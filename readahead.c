@@ -0,0 +1,428 @@
+#define _GNU_SOURCE
+
+#include "readahead.h"
+
+#include <string.h>
+#include <errno.h>
+#include <pthread.h>
+#include <unistd.h>
+#include <sys/types.h>
+#include <sys/uio.h>
+
+#if defined(__linux__) && !defined(ST_NO_IO_URING)
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <linux/io_uring.h>
+#if defined(__NR_io_uring_setup) && defined(__NR_io_uring_enter)
+#define ST_HAVE_IO_URING
+#endif
+#endif
+
+#ifdef ST_HAVE_IO_URING
+// The parts of an io_uring used to submit reads and reap their completions
+typedef struct {
+    int fd;                                 // Ring file descriptor
+
+    void *sq_ptr;                           // Submission ring mapping
+    size_t sq_size;
+    void *cq_ptr;                           // Completion ring mapping
+    size_t cq_size;
+    struct io_uring_sqe *sqes;              // Submission queue entries
+    size_t sqes_size;
+
+    unsigned *sq_tail;
+    unsigned *sq_mask;
+    unsigned *sq_array;
+    unsigned *cq_head;
+    unsigned *cq_tail;
+    unsigned *cq_mask;
+    struct io_uring_cqe *cqes;
+} st_readahead_ring_t;
+#endif
+
+struct st_readahead {
+    int fd;                                 // File being read
+    uint8_t *bufs[2];                       // Chunk buffers
+    size_t chunk_size;                      // Size of each buffer
+    st_allocator_t allocator;               // Allocator of the reader and
+                                            // its buffers
+    int next;                               // Buffer being read into
+    int pending;                            // If a read is in flight
+    int done;                               // If the end of the file was
+                                            // reached
+    int failed;                             // If a read failed
+    off_t file_offset;                      // Offset of the next read, or -1
+                                            // to read at the file position
+    size_t offset;                          // Bytes returned so far
+
+    struct iovec iov;                       // Target of the read in flight
+
+#ifdef ST_HAVE_IO_URING
+    int uring;                              // If reads go through the ring
+    st_readahead_ring_t ring;
+#endif
+
+    // Reader thread used when io_uring is not available
+    pthread_t thread;
+    pthread_mutex_t lock;
+    pthread_cond_t cond;
+    int thread_started;
+    int request;                            // A read is requested
+    int complete;                           // The requested read completed
+    int quit;                               // The thread should exit
+    ssize_t result;                         // Result of the completed read
+};
+
+//
+// io_uring backend
+//
+#ifdef ST_HAVE_IO_URING
+
+static int st_readahead_ring_setup(st_readahead_ring_t *r)
+{
+    struct io_uring_params p;
+
+    memset(&p, 0, sizeof(p));
+    memset(r, 0, sizeof(*r));
+
+    // Only one read is ever in flight
+    r->fd = syscall(__NR_io_uring_setup, 2, &p);
+    if (r->fd < 0)
+        return -1;
+
+    r->sq_size = p.sq_off.array + p.sq_entries * sizeof(unsigned);
+    r->cq_size = p.cq_off.cqes + p.cq_entries * sizeof(struct io_uring_cqe);
+
+    if (p.features & IORING_FEAT_SINGLE_MMAP) {
+        if (r->cq_size > r->sq_size)
+            r->sq_size = r->cq_size;
+        r->cq_size = 0;
+    }
+
+    r->sq_ptr = mmap(NULL, r->sq_size, PROT_READ | PROT_WRITE,
+            MAP_SHARED | MAP_POPULATE, r->fd, IORING_OFF_SQ_RING);
+    if (r->sq_ptr == MAP_FAILED)
+        goto fail_sq;
+
+    if (r->cq_size == 0) {
+        r->cq_ptr = r->sq_ptr;
+    } else {
+        r->cq_ptr = mmap(NULL, r->cq_size, PROT_READ | PROT_WRITE,
+                MAP_SHARED | MAP_POPULATE, r->fd, IORING_OFF_CQ_RING);
+        if (r->cq_ptr == MAP_FAILED)
+            goto fail_cq;
+    }
+
+    r->sqes_size = p.sq_entries * sizeof(struct io_uring_sqe);
+    r->sqes = mmap(NULL, r->sqes_size, PROT_READ | PROT_WRITE,
+            MAP_SHARED | MAP_POPULATE, r->fd, IORING_OFF_SQES);
+    if (r->sqes == MAP_FAILED)
+        goto fail_sqes;
+
+    r->sq_tail = (unsigned *)((uint8_t *)r->sq_ptr + p.sq_off.tail);
+    r->sq_mask = (unsigned *)((uint8_t *)r->sq_ptr + p.sq_off.ring_mask);
+    r->sq_array = (unsigned *)((uint8_t *)r->sq_ptr + p.sq_off.array);
+    r->cq_head = (unsigned *)((uint8_t *)r->cq_ptr + p.cq_off.head);
+    r->cq_tail = (unsigned *)((uint8_t *)r->cq_ptr + p.cq_off.tail);
+    r->cq_mask = (unsigned *)((uint8_t *)r->cq_ptr + p.cq_off.ring_mask);
+    r->cqes = (struct io_uring_cqe *)((uint8_t *)r->cq_ptr + p.cq_off.cqes);
+
+    return 0;
+
+fail_sqes:
+    if (r->cq_ptr != r->sq_ptr)
+        munmap(r->cq_ptr, r->cq_size);
+fail_cq:
+    munmap(r->sq_ptr, r->sq_size);
+fail_sq:
+    close(r->fd);
+    return -1;
+}
+
+static void st_readahead_ring_free(st_readahead_ring_t *r)
+{
+    munmap(r->sqes, r->sqes_size);
+    if (r->cq_ptr != r->sq_ptr)
+        munmap(r->cq_ptr, r->cq_size);
+    munmap(r->sq_ptr, r->sq_size);
+    close(r->fd);
+}
+
+static int st_readahead_ring_submit(st_readahead_t *ra)
+{
+    st_readahead_ring_t *r = &ra->ring;
+    unsigned tail = *r->sq_tail;
+    unsigned index = tail & *r->sq_mask;
+    struct io_uring_sqe *sqe = &r->sqes[index];
+
+    memset(sqe, 0, sizeof(*sqe));
+    sqe->opcode = IORING_OP_READV;
+    sqe->fd = ra->fd;
+    sqe->addr = (uint64_t)(uintptr_t)&ra->iov;
+    sqe->len = 1;
+    sqe->off = (uint64_t)ra->file_offset;
+
+    r->sq_array[index] = index;
+
+    // The kernel must see the entry before the new tail
+    __atomic_store_n(r->sq_tail, tail + 1, __ATOMIC_RELEASE);
+
+    int ret;
+    do {
+        ret = syscall(__NR_io_uring_enter, r->fd, 1, 0, 0, NULL, 0);
+    } while (ret < 0 && errno == EINTR);
+
+    return ret == 1 ? 0 : -1;
+}
+
+static ssize_t st_readahead_ring_wait(st_readahead_t *ra)
+{
+    st_readahead_ring_t *r = &ra->ring;
+
+    for (;;) {
+        unsigned head = *r->cq_head;
+
+        if (head != __atomic_load_n(r->cq_tail, __ATOMIC_ACQUIRE)) {
+            ssize_t res = r->cqes[head & *r->cq_mask].res;
+
+            __atomic_store_n(r->cq_head, head + 1, __ATOMIC_RELEASE);
+
+            if (res < 0) {
+                errno = -res;
+                return -1;
+            }
+            return res;
+        }
+
+        if (syscall(__NR_io_uring_enter, r->fd, 0, 1,
+                    IORING_ENTER_GETEVENTS, NULL, 0) < 0 && errno != EINTR)
+            return -1;
+    }
+}
+
+#endif
+
+//
+// Reader thread backend
+//
+static void *st_readahead_thread(void *arg)
+{
+    st_readahead_t *ra = arg;
+
+    pthread_mutex_lock(&ra->lock);
+
+    for (;;) {
+        while (!ra->request && !ra->quit)
+            pthread_cond_wait(&ra->cond, &ra->lock);
+
+        if (ra->quit)
+            break;
+
+        ra->request = 0;
+        struct iovec iov = ra->iov;
+        off_t file_offset = ra->file_offset;
+
+        pthread_mutex_unlock(&ra->lock);
+
+        ssize_t n;
+        do {
+            if (file_offset < 0)
+                n = read(ra->fd, iov.iov_base, iov.iov_len);
+            else
+                n = pread(ra->fd, iov.iov_base, iov.iov_len, file_offset);
+        } while (n < 0 && errno == EINTR);
+
+        pthread_mutex_lock(&ra->lock);
+
+        ra->result = n;
+        ra->complete = 1;
+        pthread_cond_broadcast(&ra->cond);
+    }
+
+    pthread_mutex_unlock(&ra->lock);
+
+    return NULL;
+}
+
+static int st_readahead_thread_submit(st_readahead_t *ra)
+{
+    pthread_mutex_lock(&ra->lock);
+    ra->request = 1;
+    ra->complete = 0;
+    pthread_cond_broadcast(&ra->cond);
+    pthread_mutex_unlock(&ra->lock);
+
+    return 0;
+}
+
+static ssize_t st_readahead_thread_wait(st_readahead_t *ra)
+{
+    pthread_mutex_lock(&ra->lock);
+    while (!ra->complete)
+        pthread_cond_wait(&ra->cond, &ra->lock);
+    ssize_t n = ra->result;
+    pthread_mutex_unlock(&ra->lock);
+
+    return n;
+}
+
+//
+// Reading
+//
+
+// Start reading the next chunk into the buffer that is not being tokenized
+static int st_readahead_submit(st_readahead_t *ra)
+{
+    int ret;
+
+    ra->iov.iov_base = ra->bufs[ra->next];
+    ra->iov.iov_len = ra->chunk_size;
+
+#ifdef ST_HAVE_IO_URING
+    if (ra->uring)
+        ret = st_readahead_ring_submit(ra);
+    else
+#endif
+        ret = st_readahead_thread_submit(ra);
+
+    ra->pending = (ret == 0);
+
+    return ret;
+}
+
+static ssize_t st_readahead_wait(st_readahead_t *ra)
+{
+    ssize_t n;
+
+    ra->pending = 0;
+
+#ifdef ST_HAVE_IO_URING
+    if (ra->uring)
+        n = st_readahead_ring_wait(ra);
+    else
+#endif
+        n = st_readahead_thread_wait(ra);
+
+    if (n > 0 && ra->file_offset >= 0)
+        ra->file_offset += n;
+
+    return n;
+}
+
+st_status st_readahead_init(st_readahead_t **ra, int fd, size_t chunk_size,
+        const st_allocator_t *allocator)
+{
+    if (chunk_size == 0)
+        chunk_size = ST_READAHEAD_CHUNK;
+
+    allocator = st_allocator(allocator);
+
+    *ra = st_malloc(allocator, sizeof(**ra));
+    if (*ra == NULL)
+        return st_out_of_memory;
+
+    memset(*ra, 0, sizeof(**ra));
+    (*ra)->fd = fd;
+    (*ra)->chunk_size = chunk_size;
+    (*ra)->allocator = *allocator;
+
+    pthread_mutex_init(&(*ra)->lock, NULL);
+    pthread_cond_init(&(*ra)->cond, NULL);
+
+    (*ra)->bufs[0] = st_malloc(allocator, chunk_size);
+    (*ra)->bufs[1] = st_malloc(allocator, chunk_size);
+    if ((*ra)->bufs[0] == NULL || (*ra)->bufs[1] == NULL) {
+        st_readahead_free(*ra);
+        return st_out_of_memory;
+    }
+
+    // Seekable files are read at explicit offsets from the current position,
+    // pipes and sockets at the file position
+    (*ra)->file_offset = lseek(fd, 0, SEEK_CUR);
+
+#ifdef ST_HAVE_IO_URING
+    (*ra)->uring = (st_readahead_ring_setup(&(*ra)->ring) == 0);
+    if (!(*ra)->uring)
+#endif
+    {
+        if (pthread_create(&(*ra)->thread, NULL,
+                    &st_readahead_thread, *ra) != 0) {
+            st_readahead_free(*ra);
+            return st_err;
+        }
+        (*ra)->thread_started = 1;
+    }
+
+    // Start reading the first chunk right away
+    if (st_readahead_submit(*ra) != 0)
+        (*ra)->failed = 1;
+
+    return st_ok;
+}
+
+void st_readahead_free(st_readahead_t *ra)
+{
+    if (ra == NULL)
+        return;
+
+    // The kernel or the thread may still write to a buffer
+    if (ra->pending)
+        st_readahead_wait(ra);
+
+#ifdef ST_HAVE_IO_URING
+    if (ra->uring)
+        st_readahead_ring_free(&ra->ring);
+#endif
+
+    if (ra->thread_started) {
+        pthread_mutex_lock(&ra->lock);
+        ra->quit = 1;
+        pthread_cond_broadcast(&ra->cond);
+        pthread_mutex_unlock(&ra->lock);
+
+        pthread_join(ra->thread, NULL);
+    }
+
+    pthread_mutex_destroy(&ra->lock);
+    pthread_cond_destroy(&ra->cond);
+
+    st_free(&ra->allocator, ra->bufs[0]);
+    st_free(&ra->allocator, ra->bufs[1]);
+    st_free(&ra->allocator, ra);
+}
+
+st_status st_readahead_input(const uint8_t **buffer, size_t *size,
+        size_t *offset, void *ctx)
+{
+    st_readahead_t *ra = ctx;
+
+    if (ra->failed)
+        return st_err;
+
+    if (ra->done)
+        return st_eof;
+
+    ssize_t n = st_readahead_wait(ra);
+
+    if (n < 0) {
+        ra->failed = 1;
+        return st_err;
+    } else if (n == 0) {
+        ra->done = 1;
+        return st_eof;
+    }
+
+    *buffer = ra->bufs[ra->next];
+    *size = n;
+    *offset = ra->offset;
+
+    ra->offset += n;
+
+    // The previous chunk is no longer read by the tokenizer, so the next read
+    // goes into it while this one is tokenized
+    ra->next ^= 1;
+    if (st_readahead_submit(ra) != 0)
+        ra->failed = 1;
+
+    return st_ok;
+}
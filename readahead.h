@@ -0,0 +1,31 @@
+#ifndef readahead_h
+#define readahead_h
+
+#include "styre.h"
+#include "alloc.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+
+typedef struct st_readahead st_readahead_t;
+
+// Default size of each of the two chunk buffers
+#define ST_READAHEAD_CHUNK 65536
+
+// Initialize a reader that keeps the next chunk of fd being read in the
+// background while the current one is tokenized. Reads go through io_uring
+// when the kernel allows it, and through a reader thread otherwise. A
+// chunk_size of 0 selects ST_READAHEAD_CHUNK. The fd is left open. The reader
+// and its buffers are allocated from allocator, or from libc when it is NULL.
+st_status st_readahead_init(st_readahead_t **ra, int fd, size_t chunk_size,
+        const st_allocator_t *allocator);
+
+// Free the reader. Waits for a read that is still in flight.
+void st_readahead_free(st_readahead_t *ra);
+
+// Input callback for st_tokenizer_set_input_handler, with the reader as the
+// context. Each chunk stays valid until the next call.
+st_status st_readahead_input(const uint8_t **buffer, size_t *size,
+        size_t *offset, void *ctx);
+
+#endif
@@ -0,0 +1,240 @@
+#include "scan.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#if defined(__GNUC__) || defined(__clang__)
+#define ST_SCAN_X86
+#include <immintrin.h>
+#endif
+#endif
+
+//
+// Scalar fallback
+//
+
+// Lookup table of the bytes that end a text run
+static const uint8_t st_scan_stop[256] = {
+    ['\0'] = 1, ['\r'] = 1, ['&'] = 1, ['<'] = 1,
+};
+
+static size_t st_scan_text_scalar(const uint8_t *buf, size_t len)
+{
+    size_t i = 0;
+
+    while (i < len && !st_scan_stop[buf[i]])
+        i++;
+
+    return i;
+}
+
+// Count the line breaks in the buffer from offset i, see st_scan_lines. The
+// offsets stored in starts are from the start of the buffer.
+static size_t st_scan_lines_scalar(const uint8_t *buf, size_t i, size_t len,
+        size_t *starts)
+{
+    size_t n = 0;
+
+    for (; i < len; i++) {
+        if (buf[i] == '\n'
+                || (buf[i] == '\r' && (i + 1 == len || buf[i + 1] != '\n'))) {
+            if (starts != NULL)
+                starts[n] = i + 1;
+            n++;
+        }
+    }
+
+    return n;
+}
+
+#ifdef ST_SCAN_X86
+
+//
+// SSE2, compares 16 bytes at a time against the stop characters
+//
+__attribute__((target("sse2")))
+static size_t st_scan_text_sse2(const uint8_t *buf, size_t len)
+{
+    const __m128i lt = _mm_set1_epi8('<');
+    const __m128i amp = _mm_set1_epi8('&');
+    const __m128i nul = _mm_setzero_si128();
+    const __m128i cr = _mm_set1_epi8('\r');
+
+    size_t i = 0;
+
+    for (; i + 16 <= len; i += 16) {
+        __m128i v = _mm_loadu_si128((const __m128i *)(buf + i));
+        __m128i m = _mm_or_si128(
+                _mm_or_si128(_mm_cmpeq_epi8(v, lt), _mm_cmpeq_epi8(v, amp)),
+                _mm_or_si128(_mm_cmpeq_epi8(v, nul), _mm_cmpeq_epi8(v, cr)));
+
+        int mask = _mm_movemask_epi8(m);
+        if (mask != 0)
+            return i + __builtin_ctz(mask);
+    }
+
+    return i + st_scan_text_scalar(buf + i, len - i);
+}
+
+//
+// AVX2, compares 32 bytes at a time against the stop characters
+//
+__attribute__((target("avx2")))
+static size_t st_scan_text_avx2(const uint8_t *buf, size_t len)
+{
+    const __m256i lt = _mm256_set1_epi8('<');
+    const __m256i amp = _mm256_set1_epi8('&');
+    const __m256i nul = _mm256_setzero_si256();
+    const __m256i cr = _mm256_set1_epi8('\r');
+
+    size_t i = 0;
+
+    for (; i + 32 <= len; i += 32) {
+        __m256i v = _mm256_loadu_si256((const __m256i *)(buf + i));
+        __m256i m = _mm256_or_si256(
+                _mm256_or_si256(_mm256_cmpeq_epi8(v, lt),
+                    _mm256_cmpeq_epi8(v, amp)),
+                _mm256_or_si256(_mm256_cmpeq_epi8(v, nul),
+                    _mm256_cmpeq_epi8(v, cr)));
+
+        unsigned int mask = (unsigned int)_mm256_movemask_epi8(m);
+        if (mask != 0)
+            return i + __builtin_ctz(mask);
+    }
+
+    // Let the SSE2 version handle the remaining bytes
+    return i + st_scan_text_sse2(buf + i, len - i);
+}
+
+// Line breaks, 16 bytes at a time. Each block is also loaded one byte on, to
+// tell a CR that is followed by LF from a lone one.
+__attribute__((target("sse2")))
+static size_t st_scan_lines_sse2(const uint8_t *buf, size_t i, size_t len,
+        size_t *starts)
+{
+    const __m128i lf = _mm_set1_epi8('\n');
+    const __m128i cr = _mm_set1_epi8('\r');
+
+    size_t n = 0;
+
+    for (; i + 17 <= len; i += 16) {
+        __m128i v = _mm_loadu_si128((const __m128i *)(buf + i));
+        __m128i next = _mm_loadu_si128((const __m128i *)(buf + i + 1));
+        __m128i lone_cr = _mm_andnot_si128(_mm_cmpeq_epi8(next, lf),
+                _mm_cmpeq_epi8(v, cr));
+
+        unsigned int mask = (unsigned int)_mm_movemask_epi8(
+                _mm_or_si128(_mm_cmpeq_epi8(v, lf), lone_cr));
+
+        if (starts == NULL) {
+            n += __builtin_popcount(mask);
+            continue;
+        }
+
+        for (; mask != 0; mask &= mask - 1)
+            starts[n++] = i + __builtin_ctz(mask) + 1;
+    }
+
+    return n + st_scan_lines_scalar(buf, i, len,
+            starts == NULL ? NULL : starts + n);
+}
+
+// Line breaks, 32 bytes at a time
+__attribute__((target("avx2")))
+static size_t st_scan_lines_avx2(const uint8_t *buf, size_t i, size_t len,
+        size_t *starts)
+{
+    const __m256i lf = _mm256_set1_epi8('\n');
+    const __m256i cr = _mm256_set1_epi8('\r');
+
+    size_t n = 0;
+
+    for (; i + 33 <= len; i += 32) {
+        __m256i v = _mm256_loadu_si256((const __m256i *)(buf + i));
+        __m256i next = _mm256_loadu_si256((const __m256i *)(buf + i + 1));
+        __m256i lone_cr = _mm256_andnot_si256(_mm256_cmpeq_epi8(next, lf),
+                _mm256_cmpeq_epi8(v, cr));
+
+        unsigned int mask = (unsigned int)_mm256_movemask_epi8(
+                _mm256_or_si256(_mm256_cmpeq_epi8(v, lf), lone_cr));
+
+        if (starts == NULL) {
+            n += __builtin_popcount(mask);
+            continue;
+        }
+
+        for (; mask != 0; mask &= mask - 1)
+            starts[n++] = i + __builtin_ctz(mask) + 1;
+    }
+
+    // Let the SSE2 version handle the remaining bytes
+    return n + st_scan_lines_sse2(buf, i, len,
+            starts == NULL ? NULL : starts + n);
+}
+
+#endif
+
+//
+// Runtime dispatch, the best implementation is picked on the first call
+//
+
+typedef size_t (*st_scan_text_fn)(const uint8_t *buf, size_t len);
+
+static size_t st_scan_text_resolve(const uint8_t *buf, size_t len);
+
+static st_scan_text_fn st_scan_text_impl = &st_scan_text_resolve;
+
+static size_t st_scan_text_resolve(const uint8_t *buf, size_t len)
+{
+    st_scan_text_fn impl = &st_scan_text_scalar;
+
+#ifdef ST_SCAN_X86
+    __builtin_cpu_init();
+
+    if (__builtin_cpu_supports("avx2"))
+        impl = &st_scan_text_avx2;
+    else if (__builtin_cpu_supports("sse2"))
+        impl = &st_scan_text_sse2;
+#endif
+
+    // Threads may resolve at the same time, and all store the same pointer
+    __atomic_store_n(&st_scan_text_impl, impl, __ATOMIC_RELAXED);
+
+    return impl(buf, len);
+}
+
+size_t st_scan_text(const uint8_t *buf, size_t len)
+{
+    return __atomic_load_n(&st_scan_text_impl, __ATOMIC_RELAXED)(buf, len);
+}
+
+typedef size_t (*st_scan_lines_fn)(const uint8_t *buf, size_t i, size_t len,
+        size_t *starts);
+
+static size_t st_scan_lines_resolve(const uint8_t *buf, size_t i, size_t len,
+        size_t *starts);
+
+static st_scan_lines_fn st_scan_lines_impl = &st_scan_lines_resolve;
+
+static size_t st_scan_lines_resolve(const uint8_t *buf, size_t i, size_t len,
+        size_t *starts)
+{
+    st_scan_lines_fn impl = &st_scan_lines_scalar;
+
+#ifdef ST_SCAN_X86
+    __builtin_cpu_init();
+
+    if (__builtin_cpu_supports("avx2"))
+        impl = &st_scan_lines_avx2;
+    else if (__builtin_cpu_supports("sse2"))
+        impl = &st_scan_lines_sse2;
+#endif
+
+    __atomic_store_n(&st_scan_lines_impl, impl, __ATOMIC_RELAXED);
+
+    return impl(buf, i, len, starts);
+}
+
+size_t st_scan_lines(const uint8_t *buf, size_t len, size_t *starts)
+{
+    return __atomic_load_n(&st_scan_lines_impl, __ATOMIC_RELAXED)(buf, 0, len,
+            starts);
+}
@@ -0,0 +1,17 @@
+#ifndef scan_h
+#define scan_h
+
+#include <stdlib.h>
+#include <stdint.h>
+
+// Return the offset of the first byte in the buffer that ends a run of text
+// in the data state ('<', '&', '\0' or '\r'), or len if there is none.
+size_t st_scan_text(const uint8_t *buf, size_t len);
+
+// Count the line breaks in the buffer. LF, CR LF and a CR that is not
+// followed by LF in the buffer each count as one. When starts is not NULL,
+// the offset just past each line break is stored in it, and it must have
+// room for all of them.
+size_t st_scan_lines(const uint8_t *buf, size_t len, size_t *starts);
+
+#endif
@@ -0,0 +1,399 @@
+#define _GNU_SOURCE
+
+#include "stats.h"
+
+#include <string.h>
+#include <errno.h>
+#include <signal.h>
+#include <pthread.h>
+#include <unistd.h>
+#include <fcntl.h>
+
+#if defined(ST_TOKENIZER_STATS) && defined(__linux__)
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+#if defined(__NR_perf_event_open) && defined(F_SETOWN_EX)
+#define ST_HAVE_PERF_EVENTS
+#endif
+#endif
+
+#define STATE_NAME(name) [st_tokenizer_ ## name ## _state] = #name
+
+static const char *st_stats_state_names[ST_TOKENIZER_NUM_STATES] = {
+    STATE_NAME(data),
+    STATE_NAME(character_reference_in_data),
+    STATE_NAME(rcdata),
+    STATE_NAME(character_reference_in_rcdata),
+    STATE_NAME(rawtext),
+    STATE_NAME(script_data),
+    STATE_NAME(plaintext),
+    STATE_NAME(tag_open),
+    STATE_NAME(end_tag_open),
+    STATE_NAME(tag_name),
+    STATE_NAME(rcdata_less_than_sign),
+    STATE_NAME(rcdata_end_tag_open),
+    STATE_NAME(rcdata_end_tag_name),
+    STATE_NAME(rawtext_less_than_sign),
+    STATE_NAME(rawtext_end_tag_open),
+    STATE_NAME(rawtext_end_tag_name),
+    STATE_NAME(script_data_less_than_sign),
+    STATE_NAME(script_data_end_tag_open),
+    STATE_NAME(script_data_end_tag_name),
+    STATE_NAME(script_data_escape_start),
+    STATE_NAME(script_data_escape_start_dash),
+    STATE_NAME(script_data_escaped),
+    STATE_NAME(script_data_escaped_dash),
+    STATE_NAME(script_data_escaped_dash_dash),
+    STATE_NAME(script_data_escaped_less_than_sign),
+    STATE_NAME(before_attribute_name),
+    STATE_NAME(attribute_name),
+    STATE_NAME(after_attribute_name),
+    STATE_NAME(before_attribute_value),
+    STATE_NAME(attribute_value_double_quoted),
+    STATE_NAME(attribute_value_single_quoted),
+    STATE_NAME(attribute_value_unquoted),
+    STATE_NAME(character_reference_in_attribute_value),
+    STATE_NAME(after_attribute_value_quoted),
+    STATE_NAME(self_closing_start_tag),
+    STATE_NAME(bogus_comment),
+    STATE_NAME(markup_declaration_open),
+    STATE_NAME(character_reference),
+    STATE_NAME(named_character_reference),
+    STATE_NAME(numeric_character_reference),
+    STATE_NAME(hexadecimal_character_reference_start),
+    STATE_NAME(decimal_character_reference_start),
+    STATE_NAME(hexadecimal_character_reference),
+    STATE_NAME(decimal_character_reference),
+};
+
+static const char *st_stats_token_names[ST_TOKEN_NUM_TYPES] = {
+    [st_token_type_uninitialized] = "uninitialized",
+    [st_token_type_error] = "error",
+    [st_token_type_character] = "character",
+    [st_token_type_eof] = "eof",
+    [st_token_type_start_tag] = "start_tag",
+    [st_token_type_end_tag] = "end_tag",
+    [st_token_type_text] = "text",
+};
+
+const char *st_tokenizer_state_name(st_tokenizer_state_t state)
+{
+    if ((size_t)state >= ST_TOKENIZER_NUM_STATES ||
+            st_stats_state_names[state] == NULL)
+        return "unknown";
+
+    return st_stats_state_names[state];
+}
+
+void st_stats_add(st_tokenizer_stats_t *stats,
+        const st_tokenizer_stats_t *other)
+{
+    size_t i;
+
+    for (i = 0; i < ST_TOKENIZER_NUM_STATES; i++) {
+        stats->codepoints[i] += other->codepoints[i];
+        stats->cycles[i] += other->cycles[i];
+        stats->branch_misses[i] += other->branch_misses[i];
+    }
+
+    for (i = 0; i < ST_TOKEN_NUM_TYPES; i++)
+        stats->tokens[i] += other->tokens[i];
+
+    stats->cycles_sampled |= other->cycles_sampled;
+    stats->cycles_are_ns |= other->cycles_are_ns;
+    stats->branch_misses_sampled |= other->branch_misses_sampled;
+}
+
+// Share of a total in percent
+static double st_stats_percent(uint64_t n, uint64_t total)
+{
+    return total > 0 ? 100.0 * n / total : 0.0;
+}
+
+void st_tokenizer_stats_dump(const st_tokenizer_stats_t *stats, FILE *out)
+{
+    uint64_t codepoints = 0, cycles = 0, branch_misses = 0;
+    size_t i;
+
+    for (i = 0; i < ST_TOKENIZER_NUM_STATES; i++) {
+        codepoints += stats->codepoints[i];
+        cycles += stats->cycles[i];
+        branch_misses += stats->branch_misses[i];
+    }
+
+    fprintf(out, "%-38s %12s %6s", "state", "codepoints", "%");
+    if (stats->cycles_sampled)
+        fprintf(out, " %14s %6s", stats->cycles_are_ns ? "ns" : "cycles",
+                "%");
+    if (stats->branch_misses_sampled)
+        fprintf(out, " %14s %6s", "branch misses", "%");
+    fprintf(out, "\n");
+
+    for (i = 0; i < ST_TOKENIZER_NUM_STATES; i++) {
+        if (stats->codepoints[i] == 0 && stats->cycles[i] == 0 &&
+                stats->branch_misses[i] == 0)
+            continue;
+
+        fprintf(out, "%-38s %12llu %6.2f", st_tokenizer_state_name(i),
+                (unsigned long long)stats->codepoints[i],
+                st_stats_percent(stats->codepoints[i], codepoints));
+        if (stats->cycles_sampled)
+            fprintf(out, " %14llu %6.2f",
+                    (unsigned long long)stats->cycles[i],
+                    st_stats_percent(stats->cycles[i], cycles));
+        if (stats->branch_misses_sampled)
+            fprintf(out, " %14llu %6.2f",
+                    (unsigned long long)stats->branch_misses[i],
+                    st_stats_percent(stats->branch_misses[i],
+                        branch_misses));
+        fprintf(out, "\n");
+    }
+
+    fprintf(out, "\n%-38s %12s\n", "token type", "tokens");
+    for (i = 0; i < ST_TOKEN_NUM_TYPES; i++) {
+        if (stats->tokens[i] == 0)
+            continue;
+
+        fprintf(out, "%-38s %12llu\n", st_stats_token_names[i],
+                (unsigned long long)stats->tokens[i]);
+    }
+}
+
+#ifdef ST_TOKENIZER_STATS
+
+// Events counted per sample. Without the CPU counters, time is sampled
+// through the task clock instead of cycles.
+#define ST_STATS_CYCLES_PERIOD 250000
+#define ST_STATS_TASK_CLOCK_PERIOD 100000
+#define ST_STATS_BRANCH_MISSES_PERIOD 2000
+
+typedef enum {
+    st_stats_cycles = 0,
+    st_stats_branch_misses,
+    st_stats_num_events,
+} st_stats_event_t;
+
+// Sampling state of a thread
+typedef struct {
+    int opened;                             // If the events were opened
+    int fds[st_stats_num_events];           // Event file descriptors, -1
+                                            // for events that are missing
+    uint64_t periods[st_stats_num_events];  // Events per sample
+    int cycles_are_ns;                      // If cycles are task clock
+    volatile int armed;                     // If the events are enabled
+
+    // Where samples go, NULL outside of a tokenizer
+    st_tokenizer_stats_t *volatile stats;
+    const volatile st_tokenizer_state_t *volatile state;
+} st_stats_thread_t;
+
+static __thread st_stats_thread_t st_stats_thread;
+
+#ifdef ST_HAVE_PERF_EVENTS
+
+// Signal the samples are delivered with. The first few real-time signals
+// are used by the C library.
+#define ST_STATS_SIGNAL (SIGRTMIN + 4)
+
+static pthread_once_t st_stats_once = PTHREAD_ONCE_INIT;
+static pthread_key_t st_stats_key;
+static int st_stats_ready;
+
+static void st_stats_signal(int sig, siginfo_t *info, void *ucontext)
+{
+    st_stats_thread_t *thread = &st_stats_thread;
+    st_tokenizer_stats_t *stats = thread->stats;
+    int saved_errno = errno;
+
+    for (int i = 0; i < st_stats_num_events; i++) {
+        if (!thread->opened || info->si_fd != thread->fds[i])
+            continue;
+
+        if (stats != NULL) {
+            size_t state = *thread->state;
+            uint64_t *counters = i == st_stats_cycles ?
+                stats->cycles : stats->branch_misses;
+
+            if (state < ST_TOKENIZER_NUM_STATES)
+                counters[state] += thread->periods[i];
+        }
+
+        // The event stops after each overflow until it is refreshed, which
+        // it is not once it was disabled
+        if (thread->armed)
+            ioctl(info->si_fd, PERF_EVENT_IOC_REFRESH, 1);
+    }
+
+    errno = saved_errno;
+}
+
+// Close the events of a thread that exits
+static void st_stats_thread_exit(void *arg)
+{
+    st_stats_thread_t *thread = arg;
+
+    for (int i = 0; i < st_stats_num_events; i++) {
+        if (thread->fds[i] >= 0)
+            close(thread->fds[i]);
+        thread->fds[i] = -1;
+    }
+}
+
+static void st_stats_init(void)
+{
+    struct sigaction action;
+
+    if (pthread_key_create(&st_stats_key, &st_stats_thread_exit) != 0)
+        return;
+
+    memset(&action, 0, sizeof(action));
+    action.sa_sigaction = &st_stats_signal;
+    action.sa_flags = SA_SIGINFO | SA_RESTART;
+    sigemptyset(&action.sa_mask);
+
+    if (sigaction(ST_STATS_SIGNAL, &action, NULL) == 0)
+        st_stats_ready = 1;
+}
+
+// Open a sampling event for the calling thread, disabled until it is armed
+static int st_stats_open(uint32_t type, uint64_t config, uint64_t period)
+{
+    struct perf_event_attr attr;
+    struct f_owner_ex owner;
+    int fd;
+
+    memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = type;
+    attr.config = config;
+    attr.sample_period = period;
+    attr.disabled = 1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+
+    fd = syscall(__NR_perf_event_open, &attr, 0, -1, -1,
+            PERF_FLAG_FD_CLOEXEC);
+    if (fd < 0)
+        return -1;
+
+    // Overflows are signalled to this thread only
+    owner.type = F_OWNER_TID;
+    owner.pid = syscall(__NR_gettid);
+
+    if (fcntl(fd, F_SETFL, O_ASYNC) != 0 ||
+            fcntl(fd, F_SETSIG, ST_STATS_SIGNAL) != 0 ||
+            fcntl(fd, F_SETOWN_EX, &owner) != 0) {
+        close(fd);
+        return -1;
+    }
+
+    return fd;
+}
+
+static void st_stats_open_thread(st_stats_thread_t *thread)
+{
+    int *fds = thread->fds;
+
+    thread->opened = 1;
+    fds[st_stats_cycles] = fds[st_stats_branch_misses] = -1;
+
+    pthread_once(&st_stats_once, &st_stats_init);
+    if (!st_stats_ready)
+        return;
+
+    thread->periods[st_stats_cycles] = ST_STATS_CYCLES_PERIOD;
+    thread->periods[st_stats_branch_misses] = ST_STATS_BRANCH_MISSES_PERIOD;
+
+    fds[st_stats_cycles] = st_stats_open(PERF_TYPE_HARDWARE,
+            PERF_COUNT_HW_CPU_CYCLES, ST_STATS_CYCLES_PERIOD);
+    if (fds[st_stats_cycles] < 0) {
+        fds[st_stats_cycles] = st_stats_open(PERF_TYPE_SOFTWARE,
+                PERF_COUNT_SW_TASK_CLOCK, ST_STATS_TASK_CLOCK_PERIOD);
+        thread->periods[st_stats_cycles] = ST_STATS_TASK_CLOCK_PERIOD;
+        thread->cycles_are_ns = 1;
+    }
+
+    fds[st_stats_branch_misses] = st_stats_open(PERF_TYPE_HARDWARE,
+            PERF_COUNT_HW_BRANCH_MISSES, ST_STATS_BRANCH_MISSES_PERIOD);
+
+    // The events are closed when the thread exits
+    pthread_setspecific(st_stats_key, thread);
+}
+
+// Enable the events of a thread, which stay enabled from token to token and
+// are only disabled by st_stats_pause. Samples in between, in the callbacks,
+// are dropped.
+static void st_stats_arm(st_stats_thread_t *thread)
+{
+    thread->armed = 1;
+
+    for (int i = 0; i < st_stats_num_events; i++) {
+        if (thread->fds[i] >= 0)
+            ioctl(thread->fds[i], PERF_EVENT_IOC_REFRESH, 1);
+    }
+}
+
+void st_stats_pause(void)
+{
+    st_stats_thread_t *thread = &st_stats_thread;
+
+    if (!thread->armed)
+        return;
+
+    // Disarmed first, so that a sample on the way does not refresh an event
+    thread->armed = 0;
+
+    for (int i = 0; i < st_stats_num_events; i++) {
+        if (thread->fds[i] >= 0)
+            ioctl(thread->fds[i], PERF_EVENT_IOC_DISABLE, 0);
+    }
+}
+
+#else
+
+static void st_stats_open_thread(st_stats_thread_t *thread)
+{
+    thread->opened = 1;
+    thread->fds[st_stats_cycles] = thread->fds[st_stats_branch_misses] = -1;
+}
+
+static void st_stats_arm(st_stats_thread_t *thread)
+{
+}
+
+void st_stats_pause(void)
+{
+}
+
+#endif
+
+void st_stats_enter(st_tokenizer_stats_t *stats,
+        const volatile st_tokenizer_state_t *state)
+{
+    st_stats_thread_t *thread = &st_stats_thread;
+
+    if (!thread->opened)
+        st_stats_open_thread(thread);
+
+    if (thread->fds[st_stats_cycles] >= 0) {
+        stats->cycles_sampled = 1;
+        stats->cycles_are_ns = thread->cycles_are_ns;
+    }
+    if (thread->fds[st_stats_branch_misses] >= 0)
+        stats->branch_misses_sampled = 1;
+
+    if (!thread->armed)
+        st_stats_arm(thread);
+
+    // The state is set first, so that a sample never sees stats without it
+    thread->state = state;
+    thread->stats = stats;
+}
+
+void st_stats_leave(void)
+{
+    st_stats_thread.stats = NULL;
+}
+
+#endif
@@ -0,0 +1,27 @@
+#ifndef stats_h
+#define stats_h
+
+#include "tokenizer.h"
+
+// Sampling of hardware events for the tokenizer statistics. The events are
+// opened for each thread the first time it enters a tokenizer, and every
+// sample taken between entering and leaving is added to the counters of the
+// state that the tokenizer is in at that moment. Entering enables the events,
+// and they stay enabled until st_stats_pause, so that leaving is cheap
+// between tokens.
+
+// Start adding samples on the calling thread to stats, by state
+void st_stats_enter(st_tokenizer_stats_t *stats,
+        const volatile st_tokenizer_state_t *state);
+
+// Stop adding samples on the calling thread
+void st_stats_leave(void);
+
+// Disable the events of the calling thread until it enters a tokenizer again
+void st_stats_pause(void);
+
+// Add the counters of one tokenizer to those of another
+void st_stats_add(st_tokenizer_stats_t *stats,
+        const st_tokenizer_stats_t *other);
+
+#endif
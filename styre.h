@@ -10,6 +10,7 @@ typedef enum {
     st_invalid_unicode,     // An invalid unicode codepoint was reached
     st_eof,                 // The end of the input was reached
     st_out_of_memory,       // Unable to allocate memory
+    st_not_found,           // The requested item does not exist
 } st_status;
 
 #endif
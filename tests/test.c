@@ -0,0 +1,278 @@
+#include "test.h"
+
+#include <stdarg.h>
+#include <string.h>
+
+#include "utf8.h"
+
+int st_test_failures = 0;
+
+void st_test_check_str(const char *file, int line,
+        const char *got, const char *expected)
+{
+    // Nothing was written
+    if (got == NULL)
+        got = "";
+
+    if (strcmp(got, expected) == 0)
+        return;
+
+    st_test_failures++;
+
+    if (strlen(got) < 2048 && strlen(expected) < 2048) {
+        fprintf(stderr, "%s:%d: got:\n%s\nexpected:\n%s\n",
+                file, line, got, expected);
+        return;
+    }
+
+    // Long output is shown from the first line that differs
+    size_t i = 0, lines = 1;
+
+    while (got[i] == expected[i])
+        i++;
+    while (i > 0 && got[i - 1] != '\n')
+        i--;
+    for (size_t j = 0; j < i; j++)
+        lines += got[j] == '\n';
+
+    fprintf(stderr, "%s:%d: differs from line %zu, got:\n%.300s\n"
+            "expected:\n%.300s\n", file, line, lines, got + i, expected + i);
+}
+
+// Append bytes to the output
+static void st_test_out_write(st_test_out_t *out, const void *ptr, size_t len)
+{
+    if (out->len + len + 1 > out->allocated) {
+        size_t allocated = out->allocated ? out->allocated : 256;
+
+        while (out->len + len + 1 > allocated)
+            allocated *= 2;
+
+        out->buf = realloc(out->buf, allocated);
+        if (out->buf == NULL) {
+            fprintf(stderr, "out of memory\n");
+            exit(2);
+        }
+        out->allocated = allocated;
+    }
+
+    memcpy(out->buf + out->len, ptr, len);
+    out->len += len;
+    out->buf[out->len] = '\0';
+}
+
+void st_test_out_printf(st_test_out_t *out, const char *format, ...)
+{
+    char line[256];
+    va_list ap;
+    int len;
+
+    va_start(ap, format);
+    len = vsnprintf(line, sizeof(line), format, ap);
+    va_end(ap);
+
+    st_test_out_write(out, line, (size_t)len < sizeof(line) ?
+            (size_t)len : sizeof(line) - 1);
+}
+
+// End a token line, with the span of the token
+static void st_test_out_end_line(st_test_out_t *out, size_t start, size_t end)
+{
+    if (out->spans)
+        st_test_out_printf(out, " %zu-%zu", start, end);
+    st_test_out_write(out, "\n", 1);
+}
+
+// Close the text line that is open
+static void st_test_out_end_text(st_test_out_t *out)
+{
+    if (out->in_text) {
+        st_test_out_write(out, "]", 1);
+        st_test_out_end_line(out, out->text_start, out->text_end);
+        out->in_text = 0;
+    }
+}
+
+// Add text to the open text line, or start one
+static void st_test_out_text(st_test_out_t *out,
+        const uint8_t *ptr, size_t len, size_t start, size_t end)
+{
+    if (!out->in_text) {
+        st_test_out_write(out, "T[", 2);
+        out->in_text = 1;
+        out->text_start = start;
+    }
+
+    st_test_out_write(out, ptr, len);
+    out->text_end = end;
+}
+
+void st_test_out_clear(st_test_out_t *out)
+{
+    out->len = 0;
+    out->in_text = 0;
+    if (out->buf != NULL)
+        out->buf[0] = '\0';
+}
+
+void st_test_out_free(st_test_out_t *out)
+{
+    free(out->buf);
+    memset(out, 0, sizeof(*out));
+}
+
+static void st_test_document_start(st_tokenizer_t *t, void *ctx)
+{
+}
+
+static void st_test_document_end(st_tokenizer_t *t, void *ctx)
+{
+    st_test_out_t *out = ctx;
+
+    st_test_out_end_text(out);
+    st_test_out_write(out, "END\n", 4);
+}
+
+static void st_test_token(st_tokenizer_t *t, st_token_t *token, void *ctx)
+{
+    st_test_out_t *out = ctx;
+    const uint8_t *ptr, *value;
+    size_t len, value_len, start, end;
+    uint8_t bytes[4];
+
+    st_token_span(token, &start, &end);
+
+    switch (st_token_type(token)) {
+        case st_token_type_text:
+            st_token_text(token, &ptr, &len);
+            st_test_out_text(out, ptr, len, start, end);
+            break;
+
+        case st_token_type_character:
+            len = utf8_encode_codepoint(st_token_codepoint(token), bytes);
+            st_test_out_text(out, bytes, len, start, end);
+            break;
+
+        case st_token_type_start_tag:
+        case st_token_type_end_tag:
+            st_test_out_end_text(out);
+            st_token_tag_name_view(token, &ptr, &len);
+            st_test_out_printf(out, "%c<%.*s>",
+                    st_token_type(token) == st_token_type_start_tag ?
+                    'S' : 'E', (int)len, ptr);
+
+            for (size_t i = 0; i < st_token_attr_num(token); i++) {
+                st_token_attr_name_view(token, i, &ptr, &len);
+                st_token_attr_value_view(token, i, &value, &value_len);
+                st_test_out_printf(out, " %.*s=\"", (int)len, ptr);
+                st_test_out_write(out, value, value_len);
+                st_test_out_write(out, "\"", 1);
+            }
+            st_test_out_end_line(out, start, end);
+            break;
+
+        case st_token_type_error:
+            st_test_out_end_text(out);
+            st_test_out_printf(out, "ERROR@%zu %s",
+                    st_token_error_offset(token),
+                    st_token_error_message(token));
+            st_test_out_end_line(out, start, end);
+            break;
+
+        default:
+            st_test_out_end_text(out);
+            st_test_out_printf(out, "TYPE %d", st_token_type(token));
+            st_test_out_end_line(out, start, end);
+            break;
+    }
+}
+
+st_tokenizer_callbacks_t st_test_callbacks = {
+    &st_test_document_start,
+    &st_test_document_end,
+    &st_test_token,
+    NULL,
+};
+
+void st_test_batch(st_tokenizer_t *t, st_token_batch_t *batch, void *ctx)
+{
+    st_test_out_t *out = ctx;
+
+    for (size_t i = 0; i < batch->count; i++) {
+        const uint8_t *ptr = batch->data + batch->offsets[i];
+        size_t len = batch->lengths[i];
+        size_t start = batch->span_starts[i], end = batch->span_ends[i];
+
+        if (batch->types[i] == st_token_type_text) {
+            st_test_out_text(out, ptr, len, start, end);
+            if (!out->merge_batches)
+                st_test_out_end_text(out);
+            continue;
+        }
+
+        st_test_out_end_text(out);
+
+        switch (batch->types[i]) {
+            case st_token_type_start_tag:
+            case st_token_type_end_tag:
+                st_test_out_printf(out, "%c<%.*s>",
+                        batch->types[i] == st_token_type_start_tag ?
+                        'S' : 'E', (int)len, ptr);
+
+                for (size_t j = 0; j < batch->attr_count[i]; j++) {
+                    size_t a = batch->attr_start[i] + j;
+
+                    st_test_out_printf(out, " %.*s=\"",
+                            (int)batch->attr_name_lengths[a],
+                            batch->data + batch->attr_name_offsets[a]);
+                    st_test_out_write(out,
+                            batch->data + batch->attr_value_offsets[a],
+                            batch->attr_value_lengths[a]);
+                    st_test_out_write(out, "\"", 1);
+                }
+                break;
+
+            case st_token_type_error:
+                st_test_out_printf(out, "ERROR@%zu ",
+                        batch->error_offsets[i]);
+                st_test_out_write(out, ptr, len);
+                break;
+
+            default:
+                st_test_out_printf(out, "TYPE %d", batch->types[i]);
+                break;
+        }
+        st_test_out_end_line(out, start, end);
+    }
+
+    if (!out->merge_batches)
+        st_test_out_write(out, "--\n", 3);
+}
+
+char *st_test_tokenize(const uint8_t *buf, size_t len, st_status *rc)
+{
+    st_test_out_t out = {0};
+    st_tokenizer_t *t;
+    st_status status;
+
+    if (st_tokenizer_init(&t, &st_test_callbacks, &out, NULL) != 0) {
+        fprintf(stderr, "out of memory\n");
+        exit(2);
+    }
+
+    status = st_tokenizer_set_string(t, buf, len);
+    if (status == st_ok)
+        status = st_tokenizer_run(t);
+
+    st_test_out_end_text(&out);
+    st_tokenizer_destroy(t);
+
+    if (rc != NULL)
+        *rc = status;
+
+    // Nothing was written for an empty document
+    if (out.buf == NULL)
+        st_test_out_write(&out, "", 0);
+
+    return out.buf;
+}
@@ -0,0 +1,82 @@
+#ifndef test_h
+#define test_h
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+
+#include "styre.h"
+#include "tokenizer.h"
+
+// Number of checks that failed, and the exit status of a test
+extern int st_test_failures;
+
+// Check a condition, and report it with its place in the test if it fails
+#define ST_CHECK(cond)                                                         \
+    do {                                                                       \
+        if (!(cond)) {                                                         \
+            fprintf(stderr, "%s:%d: check failed: %s\n",                       \
+                    __FILE__, __LINE__, #cond);                                \
+            st_test_failures++;                                                \
+        }                                                                      \
+    } while (0)
+
+// Check that a call returns the expected status
+#define ST_CHECK_STATUS(call, expected)                                        \
+    do {                                                                       \
+        st_status st_check_rc = (call);                                        \
+        if (st_check_rc != (expected)) {                                       \
+            fprintf(stderr, "%s:%d: %s returned %d, expected %d\n",            \
+                    __FILE__, __LINE__, #call, st_check_rc, (expected));       \
+            st_test_failures++;                                                \
+        }                                                                      \
+    } while (0)
+
+// Check that two strings are the same, and print both if they are not
+#define ST_CHECK_STR(got, expected)                                            \
+    st_test_check_str(__FILE__, __LINE__, (got), (expected))
+
+void st_test_check_str(const char *file, int line,
+        const char *got, const char *expected);
+
+// Tokens written out as text, one line per token, for comparing the output
+// of the different ways of running the tokenizer:
+//
+// S<name> a="v"   start tag and its attributes
+// E<name>         end tag
+// T[text]         text, with adjacent text and characters merged
+// ERROR@offset m  error token and its message
+// END             end of the document
+//
+// With spans set, every token line ends with the start and end of its source,
+// as in "S<p> 0-3". Batches are written out token by token without merging,
+// each batch ended by a line "--", so how text is split over batches is
+// compared too. With merge_batches set they are written out like tokens
+// instead.
+typedef struct {
+    char *buf;                              // NUL-terminated output
+    size_t len;
+    size_t allocated;
+    int spans;                              // If spans are written
+    int merge_batches;                      // If batches are written as
+                                            // tokens
+    int in_text;                            // If a text line is open, and
+    size_t text_start;                      // the span of its text
+    size_t text_end;
+} st_test_out_t;
+
+void st_test_out_printf(st_test_out_t *out, const char *format, ...);
+void st_test_out_clear(st_test_out_t *out);
+void st_test_out_free(st_test_out_t *out);
+
+// Callbacks that write to the st_test_out_t that is the context
+extern st_tokenizer_callbacks_t st_test_callbacks;
+
+// Batch callback that writes to the st_test_out_t that is the context
+void st_test_batch(st_tokenizer_t *t, st_token_batch_t *batch, void *ctx);
+
+// Tokenize a string with st_tokenizer_run and return the output, which the
+// caller must free. The status is stored in rc when it is not NULL.
+char *st_test_tokenize(const uint8_t *buf, size_t len, st_status *rc);
+
+#endif
@@ -0,0 +1,386 @@
+// Allocations through a counting allocator, which every part must use
+#define _POSIX_C_SOURCE 200809L
+
+#include "test.h"
+#include "pool.h"
+#include "utf8.h"
+
+#include <string.h>
+#include <pthread.h>
+#include <unistd.h>
+
+// Every block starts with a header that marks it as one of the counter, so
+// that a block of libc freed by the counter, or one of the counter freed or
+// resized by libc, is caught
+#define HEADER 16
+#define MAGIC 0x5354414c4c4f43ULL
+
+typedef struct {
+    pthread_mutex_t lock;                   // The allocator is called from
+                                            // several threads at once
+    size_t mallocs;                         // Blocks allocated, by malloc
+    size_t reallocs;                        // or by realloc
+    size_t frees;                           // Blocks freed
+    size_t live;                            // Blocks not freed yet
+    size_t foreign;                         // Blocks passed in that were not
+                                            // allocated by the counter
+} counter_t;
+
+static counter_t counter = {PTHREAD_MUTEX_INITIALIZER};
+
+static void *counter_block(void *ptr)
+{
+    if (ptr == NULL)
+        return NULL;
+
+    *(unsigned long long *)ptr = MAGIC;
+    return (uint8_t *)ptr + HEADER;
+}
+
+// The header of a block passed in, NULL when it is not one of the counter
+static void *counter_header(counter_t *c, void *ptr)
+{
+    uint8_t *header = (uint8_t *)ptr - HEADER;
+
+    if (*(unsigned long long *)header != MAGIC) {
+        c->foreign++;
+        return NULL;
+    }
+
+    return header;
+}
+
+static void *counter_malloc(size_t size, void *ctx)
+{
+    counter_t *c = ctx;
+
+    pthread_mutex_lock(&c->lock);
+    c->mallocs++;
+    c->live++;
+    pthread_mutex_unlock(&c->lock);
+
+    return counter_block(malloc(HEADER + size));
+}
+
+static void *counter_realloc(void *ptr, size_t size, void *ctx)
+{
+    counter_t *c = ctx;
+    void *header = NULL;
+
+    pthread_mutex_lock(&c->lock);
+    c->reallocs++;
+    if (ptr == NULL)
+        c->live++;
+    else
+        header = counter_header(c, ptr);
+    pthread_mutex_unlock(&c->lock);
+
+    // A foreign block is left alone
+    if (ptr != NULL && header == NULL)
+        return NULL;
+
+    return counter_block(realloc(header, HEADER + size));
+}
+
+static void counter_free(void *ptr, void *ctx)
+{
+    counter_t *c = ctx;
+    void *header;
+
+    pthread_mutex_lock(&c->lock);
+    c->frees++;
+    header = counter_header(c, ptr);
+    if (header != NULL) {
+        *(unsigned long long *)header = 0;
+        c->live--;
+    }
+    pthread_mutex_unlock(&c->lock);
+
+    free(header);
+}
+
+static const st_allocator_t allocator = {
+    &counter_malloc,
+    &counter_realloc,
+    &counter_free,
+    &counter,
+};
+
+// Allocations so far, by malloc and realloc
+static size_t allocations(void)
+{
+    size_t n;
+
+    pthread_mutex_lock(&counter.lock);
+    n = counter.mallocs + counter.reallocs;
+    pthread_mutex_unlock(&counter.lock);
+
+    return n;
+}
+
+// Nothing is left allocated, and only blocks of the counter were passed in
+static void check_all_freed(void)
+{
+    ST_CHECK(counter.live == 0);
+    ST_CHECK(counter.foreign == 0);
+}
+
+static const uint8_t document[] =
+    "<p class=\"a\" id='b' title=\"&amp; &#x41;&AElig;\">text &lt; more "
+    "\xc3\xa5 &notit; <custom-element data-x=\"y\" data-x=\"z\"></p>"
+    "<a href=\"x\">link</a> the end";
+
+// Copies of the document in one that st_tokenizer_run_parallel splits
+#define LARGE 4000
+
+// Copies of the names and values, which come from the allocator of the
+// tokenizer and are given back to it
+static void token_copies(st_tokenizer_t *t, st_token_t *token, void *ctx)
+{
+    const st_allocator_t *a = st_tokenizer_allocator(t);
+    uint8_t *buf;
+    size_t len;
+
+    if (st_token_type(token) == st_token_type_start_tag) {
+        ST_CHECK_STATUS(st_token_tag_name(token, &buf, &len), st_ok);
+        st_free(a, buf);
+
+        for (size_t i = 0; i < st_token_attr_num(token); i++) {
+            ST_CHECK_STATUS(st_token_attr_name(token, i, &buf, &len), st_ok);
+            st_free(a, buf);
+            ST_CHECK_STATUS(st_token_attr_value(token, i, &buf, &len), st_ok);
+            st_free(a, buf);
+        }
+    }
+
+    st_test_callbacks.token(t, token, ctx);
+}
+
+static void check_out(st_test_out_t *out, const char *expected)
+{
+    ST_CHECK_STR(out->buf, expected);
+    st_test_out_clear(out);
+}
+
+// Every kind of input, and everything a tokenizer allocates on the way
+static void test_tokenizer(void)
+{
+    st_tokenizer_callbacks_t callbacks = st_test_callbacks;
+    char *expected = st_test_tokenize(document, sizeof(document) - 1, NULL);
+    char path[] = "/tmp/styre_test_alloc_XXXXXX";
+    int fd = mkstemp(path), fds[2];
+    st_test_out_t out = {0};
+    st_token_batch_t *batch;
+    st_tokenizer_t *t;
+    uint32_t codepoints[] = {'a', 0xe5, 0x20ac, 0x1f600};
+    size_t line, column, len;
+    uint8_t *buf;
+    st_token_t *token;
+    uint8_t *large = malloc(LARGE * (sizeof(document) - 1));
+
+    callbacks.token = &token_copies;
+
+    if (fd < 0 || write(fd, document, sizeof(document) - 1) < 0
+            || pipe(fds) != 0
+            || write(fds[1], document, sizeof(document) - 1) < 0)
+        exit(2);
+    close(fds[1]);
+
+    if (st_tokenizer_init(&t, &callbacks, &out, &allocator) != 0)
+        exit(2);
+
+    ST_CHECK(allocations() > 0);
+
+    ST_CHECK_STATUS(st_tokenizer_set_string(t, document,
+                sizeof(document) - 1), st_ok);
+    ST_CHECK_STATUS(st_tokenizer_run(t), st_ok);
+    check_out(&out, expected);
+
+    ST_CHECK_STATUS(st_tokenizer_set_string(t, document,
+                sizeof(document) - 1), st_ok);
+    ST_CHECK_STATUS(st_tokenizer_position(t, 70, &line, &column), st_ok);
+
+    ST_CHECK_STATUS(st_tokenizer_set_file(t, path), st_ok);
+    ST_CHECK_STATUS(st_tokenizer_run(t), st_ok);
+    check_out(&out, expected);
+
+    ST_CHECK_STATUS(st_tokenizer_set_fd(t, fds[0]), st_ok);
+    ST_CHECK_STATUS(st_tokenizer_run(t), st_ok);
+    check_out(&out, expected);
+
+    ST_CHECK_STATUS(st_tokenizer_feed(t, document, 40), st_ok);
+    ST_CHECK_STATUS(st_tokenizer_feed(t, document + 40,
+                sizeof(document) - 41), st_ok);
+    ST_CHECK_STATUS(st_tokenizer_finish(t), st_ok);
+    check_out(&out, expected);
+
+    ST_CHECK_STATUS(st_tokenizer_set_string(t, document,
+                sizeof(document) - 1), st_ok);
+    while (st_tokenizer_next(t, &token) == st_ok)
+        ;
+
+    ST_CHECK_STATUS(st_tokenizer_encode_unicode(t, codepoints, 4, &buf,
+                &len), st_ok);
+    st_free(st_tokenizer_allocator(t), buf);
+
+    // Converted input
+    ST_CHECK_STATUS(st_tokenizer_set_encoding(t, st_encoding_utf16le), st_ok);
+    ST_CHECK_STATUS(st_tokenizer_set_string(t,
+                (const uint8_t *)"<\0p\0>\0x\0", 8), st_ok);
+    ST_CHECK_STATUS(st_tokenizer_run(t), st_ok);
+    check_out(&out, "S<p>\nT[x]\nEND\n");
+    ST_CHECK_STATUS(st_tokenizer_set_encoding(t, st_encoding_utf8), st_ok);
+
+    // Batches, and the ones of the pieces of a parallel run, which needs a
+    // document large enough to be split
+    for (size_t i = 0; i < LARGE; i++) {
+        memcpy(large + i * (sizeof(document) - 1), document,
+                sizeof(document) - 1);
+    }
+    free(expected);
+    expected = st_test_tokenize(large, LARGE * (sizeof(document) - 1), NULL);
+
+    ST_CHECK_STATUS(st_token_batch_init(&batch, 64, 256, 4096, &allocator),
+            st_ok);
+    ST_CHECK_STATUS(st_tokenizer_set_batch(t, batch, &st_test_batch), st_ok);
+    out.merge_batches = 1;
+    ST_CHECK_STATUS(st_tokenizer_set_string(t, large,
+                LARGE * (sizeof(document) - 1)), st_ok);
+    ST_CHECK_STATUS(st_tokenizer_run_parallel(t, 2), st_ok);
+    check_out(&out, expected);
+
+    st_tokenizer_destroy(t);
+    st_token_batch_free(batch);
+
+    close(fds[0]);
+    close(fd);
+    unlink(path);
+    st_test_out_free(&out);
+    free(expected);
+    free(large);
+
+    check_all_freed();
+}
+
+// Documents of all sizes, run one after another through the same tokenizer
+static const char *const documents[] = {
+    "short",
+    "<p class=\"a\" id='b' title=\"&amp; &#x41;&AElig;\">text &lt; more "
+        "\xc3\xa5 &notit;</p>",
+    "<div a=\"1\" b=\"2\" c=\"3\" d=\"4\" e=\"5\" f=\"6\" g=\"7\" h=\"8\" "
+        "i=\"9\" j=\"10\" k=\"11\" l=\"12\" m=\"13\" n=\"14\" o=\"15\" "
+        "p=\"16\" q=\"17\" r=\"18\">",
+    "",
+    "<a href=\"&lt;&lt;&lt;&lt;&lt;&lt;&lt;&lt;&lt;&lt;&lt;&lt;&lt;&lt;\">"
+        "&amp;&amp;&amp;&amp;&amp;&amp;&amp;&amp;&amp;&amp;</a>",
+    "<p>error \xff",
+};
+
+#define NUM_DOCUMENTS (sizeof(documents) / sizeof(*documents))
+
+// One round of every document, run, pushed in chunks and pulled
+static void reuse_round(st_tokenizer_t *t, st_test_out_t *out)
+{
+    st_token_t *token;
+
+    for (size_t i = 0; i < NUM_DOCUMENTS; i++) {
+        const uint8_t *doc = (const uint8_t *)documents[i];
+        size_t len = strlen(documents[i]);
+
+        if (st_tokenizer_set_string(t, doc, len) == st_ok)
+            st_tokenizer_run(t);
+
+        for (size_t offset = 0; offset < len; offset += 7) {
+            if (st_tokenizer_feed(t, doc + offset,
+                        offset + 7 < len ? 7 : len - offset) != st_ok)
+                break;
+        }
+        st_tokenizer_finish(t);
+
+        ST_CHECK_STATUS(st_tokenizer_set_string(t, doc, len), st_ok);
+        while (st_tokenizer_next(t, &token) == st_ok)
+            ;
+
+        ST_CHECK_STATUS(st_tokenizer_reset(t), st_ok);
+        st_test_out_clear(out);
+    }
+}
+
+// Once a tokenizer has seen the documents, running them again through it
+// allocates nothing
+static void test_reuse(void)
+{
+    st_test_out_t out = {0};
+    st_tokenizer_t *t;
+    size_t before;
+
+    if (st_tokenizer_init(&t, &st_test_callbacks, &out, &allocator) != 0)
+        exit(2);
+
+    reuse_round(t, &out);
+    before = allocations();
+
+    for (int round = 0; round < 100; round++)
+        reuse_round(t, &out);
+
+    ST_CHECK(allocations() == before);
+
+    st_tokenizer_destroy(t);
+    st_test_out_free(&out);
+
+    check_all_freed();
+}
+
+// A pool and the tokenizers of its workers
+static void test_pool(void)
+{
+    st_pool_document_t docs[8];
+    st_test_out_t out[8];
+    st_pool_t *pool;
+
+    memset(out, 0, sizeof(out));
+
+    for (size_t i = 0; i < 8; i++) {
+        docs[i].buf = document;
+        docs[i].len = sizeof(document) - 1;
+        docs[i].ctx = &out[i];
+    }
+
+    ST_CHECK_STATUS(st_pool_init(&pool, 3, &st_test_callbacks, &allocator),
+            st_ok);
+    ST_CHECK_STATUS(st_pool_run(pool, docs, 8), st_ok);
+    st_pool_free(pool);
+
+    for (size_t i = 0; i < 8; i++) {
+        ST_CHECK_STATUS(docs[i].rc, st_ok);
+        st_test_out_free(&out[i]);
+    }
+
+    check_all_freed();
+}
+
+// Strings encoded on their own
+static void test_encode(void)
+{
+    uint32_t codepoints[] = {'a', 0xe5, 0x20ac, 0x1f600};
+    size_t before = allocations(), len;
+    uint8_t *buf;
+
+    ST_CHECK_STATUS(utf8_encode_unicode(codepoints, 4, &buf, &len,
+                &allocator), st_ok);
+    ST_CHECK_STR((char *)buf, "a\xc3\xa5\xe2\x82\xac\xf0\x9f\x98\x80");
+    ST_CHECK(allocations() > before);
+    st_free(&allocator, buf);
+
+    check_all_freed();
+}
+
+int main(void)
+{
+    test_tokenizer();
+    test_reuse();
+    test_pool();
+    test_encode();
+
+    return st_test_failures != 0;
+}
@@ -0,0 +1,141 @@
+// Atoms of names, looked up directly and resolved for the tags of tokens
+#include "test.h"
+
+#include <string.h>
+
+#include "utf8.h"
+
+// Every atom is found by its name and its hash is the hash of its name
+static void test_lookup(void)
+{
+    size_t len;
+
+    for (st_atom_t atom = st_atom_unknown + 1; atom < st_atom_count; atom++) {
+        const char *name = st_atom_to_string(atom, &len);
+        uint32_t hash = ST_ATOM_HASH_INIT;
+
+        ST_CHECK(name != NULL && strlen(name) == len);
+        if (name == NULL)
+            continue;
+
+        for (size_t i = 0; i < len; i++)
+            hash = ST_ATOM_HASH_UPDATE(hash, name[i]);
+
+        ST_CHECK(st_atom_lookup((const uint8_t *)name, len) == atom);
+        ST_CHECK(st_atom_hash(atom) == hash);
+    }
+
+    ST_CHECK(st_atom_to_string(st_atom_unknown, &len) == NULL);
+}
+
+// Names that are not atoms, among them ones close to an atom. Names are
+// looked up lowercased, so an uppercase one has no atom.
+static void test_unknown(void)
+{
+    static const char *const names[] = {
+        "", "x", "custom-element", "di", "divv", "d\xc3\xadv", "DIV",
+        "Table", "h7", "tabl", "hrefs",
+    };
+
+    for (size_t i = 0; i < sizeof(names) / sizeof(*names); i++) {
+        ST_CHECK(st_atom_lookup((const uint8_t *)names[i], strlen(names[i]))
+                == st_atom_unknown);
+    }
+}
+
+// The name of the atom of each tag, or "?" for st_atom_unknown
+static void token_atom(st_tokenizer_t *t, st_token_t *token, void *ctx)
+{
+    st_test_out_t *out = ctx;
+    const char *name;
+    size_t len;
+
+    switch (st_token_type(token)) {
+        case st_token_type_start_tag:
+        case st_token_type_end_tag:
+            name = st_atom_to_string(st_token_tag_atom(token), &len);
+            st_test_out_printf(out, "%s%s ",
+                    st_token_type(token) == st_token_type_end_tag ? "/" : "",
+                    name != NULL ? name : "?");
+            break;
+
+        case st_token_type_error:
+            st_test_out_printf(out, "ERROR ");
+            break;
+
+        default:
+            break;
+    }
+}
+
+static st_status next_codepoint(const uint8_t *in, size_t len, uint32_t *out,
+        size_t *bytes)
+{
+    return utf8_next_codepoint(in, len, out, bytes);
+}
+
+// Tokenize a string, or push it in chunks of size bytes when size is not 0,
+// with either state machine
+static char *atoms(const char *doc, size_t size, int generic)
+{
+    st_tokenizer_callbacks_t callbacks = st_test_callbacks;
+    st_test_out_t out = {0};
+    size_t len = strlen(doc);
+    st_tokenizer_t *t;
+
+    callbacks.token = &token_atom;
+
+    if (st_tokenizer_init(&t, &callbacks, &out, NULL) != 0)
+        exit(2);
+
+    if (generic) {
+        ST_CHECK_STATUS(st_tokenizer_set_encoding_handler(t, &next_codepoint,
+                    &utf8_encode_unicode), st_ok);
+    }
+
+    if (size == 0) {
+        ST_CHECK_STATUS(st_tokenizer_set_string(t, (const uint8_t *)doc,
+                    len), st_ok);
+        ST_CHECK_STATUS(st_tokenizer_run(t), st_ok);
+    } else {
+        for (size_t offset = 0; offset < len; offset += size) {
+            ST_CHECK_STATUS(st_tokenizer_feed(t, (const uint8_t *)doc + offset,
+                        offset + size < len ? size : len - offset), st_ok);
+        }
+        ST_CHECK_STATUS(st_tokenizer_finish(t), st_ok);
+    }
+
+    st_tokenizer_destroy(t);
+    return out.buf;
+}
+
+static void check(const char *doc, const char *expected)
+{
+    for (int generic = 0; generic <= 1; generic++) {
+        for (size_t size = 0; size <= 5; size++) {
+            char *out = atoms(doc, size, generic);
+
+            ST_CHECK_STR(out, expected);
+            free(out);
+        }
+    }
+}
+
+// Tags of known and unknown elements, written in any case
+static void test_tags(void)
+{
+    check("<p>x</p><div class=\"a\"></div>", "p /p div /div END\n");
+    check("<DIV><Table></TABLE><bR><H1 >", "div table /table br h1 END\n");
+    check("<custom-element></custom-element><x><divv><di>",
+            "? /? ? ? ? END\n");
+    check("<d\xc3\xadv><SVG><svg\n>", "? svg svg END\n");
+}
+
+int main(void)
+{
+    test_lookup();
+    test_unknown();
+    test_tags();
+
+    return st_test_failures != 0;
+}
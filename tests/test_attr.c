@@ -0,0 +1,200 @@
+// Attributes found by atom and by name through the index of a tag
+#include "test.h"
+
+#include <string.h>
+
+#include "utf8.h"
+
+// Names the attributes of every tag are looked up by, and the output
+typedef struct {
+    st_test_out_t out;                      // First, for the callbacks
+    const char *const *queries;
+    size_t num_queries;
+} attrs_t;
+
+// Find an attribute by name, and by atom when the name has one, which must
+// find the same. Writes its number, or "-" when there is none.
+static void find(attrs_t *a, st_token_t *token, const char *name)
+{
+    size_t len = strlen(name), attr_num = 0, by_atom = 0;
+    st_atom_t atom = st_atom_lookup((const uint8_t *)name, len);
+    st_status rc;
+
+    rc = st_token_attr_find_name(token, (const uint8_t *)name, len,
+            &attr_num);
+    ST_CHECK(rc == st_ok || rc == st_not_found);
+
+    if (atom != st_atom_unknown) {
+        ST_CHECK_STATUS(st_token_attr_find(token, atom, &by_atom), rc);
+        ST_CHECK(rc != st_ok || by_atom == attr_num);
+    }
+
+    if (rc == st_ok)
+        st_test_out_printf(&a->out, " %s=%zu", name, attr_num);
+    else
+        st_test_out_printf(&a->out, " %s=-", name);
+}
+
+// Each tag as its name, the atoms of its attributes, "?" for the ones without
+// one, and what the queries find
+static void token_attrs(st_tokenizer_t *t, st_token_t *token, void *ctx)
+{
+    attrs_t *a = ctx;
+    const uint8_t *ptr;
+    const char *name;
+    size_t len, attr_num;
+
+    switch (st_token_type(token)) {
+        case st_token_type_start_tag:
+            st_token_tag_name_view(token, &ptr, &len);
+            st_test_out_printf(&a->out, "<%.*s>", (int)len, ptr);
+
+            for (size_t i = 0; i < st_token_attr_num(token); i++) {
+                name = st_atom_to_string(st_token_attr_atom(token, i), &len);
+                st_test_out_printf(&a->out, " %s", name != NULL ? name : "?");
+            }
+
+            st_test_out_printf(&a->out, " |");
+            for (size_t i = 0; i < a->num_queries; i++)
+                find(a, token, a->queries[i]);
+
+            // Names without an atom are only found by name
+            ST_CHECK_STATUS(st_token_attr_find(token, st_atom_unknown,
+                        &attr_num), st_not_found);
+
+            st_test_out_printf(&a->out, "\n");
+            break;
+
+        case st_token_type_error:
+            st_test_out_printf(&a->out, "ERROR@%zu %s\n",
+                    st_token_error_offset(token),
+                    st_token_error_message(token));
+            break;
+
+        default:
+            break;
+    }
+}
+
+static st_status next_codepoint(const uint8_t *in, size_t len, uint32_t *out,
+        size_t *bytes)
+{
+    return utf8_next_codepoint(in, len, out, bytes);
+}
+
+// Tokenize a string, or push it in chunks of size bytes when size is not 0,
+// with either state machine
+static char *attrs(const char *doc, const char *const *queries,
+        size_t num_queries, size_t size, int generic)
+{
+    st_tokenizer_callbacks_t callbacks = st_test_callbacks;
+    attrs_t a = {{0}, queries, num_queries};
+    size_t len = strlen(doc);
+    st_tokenizer_t *t;
+
+    callbacks.token = &token_attrs;
+
+    if (st_tokenizer_init(&t, &callbacks, &a, NULL) != 0)
+        exit(2);
+
+    if (generic) {
+        ST_CHECK_STATUS(st_tokenizer_set_encoding_handler(t, &next_codepoint,
+                    &utf8_encode_unicode), st_ok);
+    }
+
+    if (size == 0) {
+        ST_CHECK_STATUS(st_tokenizer_set_string(t, (const uint8_t *)doc,
+                    len), st_ok);
+        ST_CHECK_STATUS(st_tokenizer_run(t), st_ok);
+    } else {
+        for (size_t offset = 0; offset < len; offset += size) {
+            ST_CHECK_STATUS(st_tokenizer_feed(t, (const uint8_t *)doc + offset,
+                        offset + size < len ? size : len - offset), st_ok);
+        }
+        ST_CHECK_STATUS(st_tokenizer_finish(t), st_ok);
+    }
+
+    st_tokenizer_destroy(t);
+    return a.out.buf;
+}
+
+#define CHECK(doc, queries, expected)                                          \
+    check((doc), (queries), sizeof(queries) / sizeof(*(queries)), (expected))
+
+static void check(const char *doc, const char *const *queries,
+        size_t num_queries, const char *expected)
+{
+    for (int generic = 0; generic <= 1; generic++) {
+        for (size_t size = 0; size <= 5; size++) {
+            char *out = attrs(doc, queries, num_queries, size, generic);
+
+            ST_CHECK_STR(out, expected);
+            free(out);
+        }
+    }
+}
+
+// Known and unknown names, written in any case. Names are found lowercased,
+// and a tag without attributes has none to find.
+static void test_names(void)
+{
+    static const char *const queries[] = {
+        "href", "title", "data-x", "id", "HREF", "",
+    };
+
+    CHECK("<a HREF=\"x\" Title='y' data-X=\"z\"><b><i id=\"\">", queries,
+            "<a> href title ? | href=0 title=1 data-x=2 id=- HREF=- =-\n"
+            "<b> | href=- title=- data-x=- id=- HREF=- =-\n"
+            "<i> id | href=- title=- data-x=- id=0 HREF=- =-\n"
+            "END\n");
+}
+
+// The first of several attributes with the same name is found, whatever the
+// case they are written in
+static void test_duplicates(void)
+{
+    static const char *const queries[] = {
+        "id", "class", "data-x", "lang",
+    };
+
+    CHECK("<p id=\"1\" class=\"a\" ID=\"2\" data-x=\"1\" id=\"3\" "
+            "DATA-X=\"2\" data-x=\"3\">", queries,
+            "<p> id class id ? id ? ? | id=0 class=1 data-x=3 lang=-\n"
+            "END\n");
+}
+
+// More attributes than the first index has room for, so it is rebuilt larger
+// while they are added. Every name is still found, with duplicates of the
+// first ones added after the index grew.
+static void test_many(void)
+{
+    static const char *const queries[] = {
+        "id", "class", "title", "href", "x0", "x7", "x16", "x23", "x24",
+    };
+    char doc[1024], expected[1024];
+    size_t len, expected_len;
+
+    len = sprintf(doc, "<div id=\"a\" class=\"b\"");
+    expected_len = sprintf(expected, "<div> id class");
+
+    for (int i = 0; i < 24; i++) {
+        len += sprintf(doc + len, " x%d=\"%d\"", i, i);
+        expected_len += sprintf(expected + expected_len, " ?");
+    }
+
+    sprintf(doc + len, " title=\"c\" ID=\"d\" x0=\"e\">");
+    sprintf(expected + expected_len, " title id ? |"
+            " id=0 class=1 title=26 href=- x0=2 x7=9 x16=18 x23=25 x24=-\n"
+            "END\n");
+
+    CHECK(doc, queries, expected);
+}
+
+int main(void)
+{
+    test_names();
+    test_duplicates();
+    test_many();
+
+    return st_test_failures != 0;
+}
@@ -0,0 +1,188 @@
+// Batches hold the same tokens, spans and errors as the token callback gets
+#include "test.h"
+
+#include <string.h>
+
+#include "utf8.h"
+
+#define DOCUMENT(s) { (const uint8_t *)(s), sizeof(s) - 1 }
+
+static const struct {
+    const uint8_t *buf;
+    size_t len;
+} documents[] = {
+    DOCUMENT("<div class=\"test\" id=hei><h1>\xc3\xa5</h1>@</div>"),
+    DOCUMENT("a long run of text &amp; &notin; references &#x263a; that is "
+            "split over batches\r\nwith CR LF\rand CR<p>"),
+    DOCUMENT("<a href='x?a=1&amp;b=2'>link</a><b>bold</b><i>it</i>"),
+    DOCUMENT("<p>before\0after"),
+};
+
+// A custom decoder, with which the tokenizer emits text as character tokens
+static st_status next_codepoint(const uint8_t *in, size_t len,
+        uint32_t *out, size_t *bytes)
+{
+    return utf8_next_codepoint(in, len, out, bytes);
+}
+
+// Tokenize with a batch of the given capacities, or with the token callback
+// when capacity is 0. With characters, the custom decoder is used.
+static char *tokenize(const uint8_t *doc, size_t len, size_t capacity,
+        size_t attr_capacity, size_t data_capacity, int merge, int characters)
+{
+    st_test_out_t out = {0};
+    st_token_batch_t *batch = NULL;
+    st_tokenizer_t *t;
+
+    out.spans = 1;
+    out.merge_batches = merge;
+
+    if (st_tokenizer_init(&t, &st_test_callbacks, &out, NULL) != 0)
+        exit(2);
+
+    if (characters)
+        st_tokenizer_set_encoding_handler(t, &next_codepoint,
+                &utf8_encode_unicode);
+
+    if (capacity > 0) {
+        ST_CHECK_STATUS(st_token_batch_init(&batch, capacity, attr_capacity,
+                    data_capacity, NULL), st_ok);
+        ST_CHECK_STATUS(st_tokenizer_set_batch(t, batch, &st_test_batch),
+                st_ok);
+    }
+
+    ST_CHECK_STATUS(st_tokenizer_set_string(t, doc, len), st_ok);
+    ST_CHECK_STATUS(st_tokenizer_run(t), st_ok);
+
+    st_tokenizer_destroy(t);
+    st_token_batch_free(batch);
+
+    return out.buf;
+}
+
+// Any capacities give the tokens of the token callback, with text that is
+// split over batches spanning its source piece by piece
+static void test_capacities(void)
+{
+    static const size_t capacities[][3] = {
+        { 256, 64, 4096 },
+        { 1, 4, 64 },
+        { 2, 2, 64 },
+        { 3, 8, 80 },
+    };
+
+    for (size_t n = 0; n < 2 * sizeof(documents) / sizeof(*documents); n++) {
+        size_t d = n / 2;
+        int characters = n % 2;
+        char *expected = tokenize(documents[d].buf, documents[d].len,
+                0, 0, 0, 1, characters);
+
+        for (size_t c = 0; c < sizeof(capacities) / sizeof(*capacities);
+                c++) {
+            char *out = tokenize(documents[d].buf, documents[d].len,
+                    capacities[c][0], capacities[c][1], capacities[c][2], 1,
+                    characters);
+
+            ST_CHECK_STR(out, expected);
+            free(out);
+        }
+
+        free(expected);
+    }
+}
+
+// An error keeps its message and offset, text split over batches has
+// consecutive spans, and characters are merged into text
+static void test_layout(void)
+{
+    char *out;
+
+    out = tokenize(documents[3].buf, documents[3].len, 16, 16, 256, 0, 0);
+    ST_CHECK_STR(out,
+            "S<p> 0-3\n"
+            "T[before] 3-9\n"
+            "ERROR@9 Reached \\0-character. 9-10\n"
+            "--\n");
+    free(out);
+
+    out = tokenize((const uint8_t *)"0123456789&lt;abc<p>", 20, 4, 4, 4, 0,
+            0);
+    ST_CHECK_STR(out,
+            "T[0123] 0-4\n"
+            "--\n"
+            "T[4567] 4-8\n"
+            "--\n"
+            "T[89<a] 8-15\n"
+            "--\n"
+            "T[bc] 15-17\n"
+            "S<p> 17-20\n"
+            "--\n"
+            "END\n");
+    free(out);
+
+    // Characters from a custom decoder are merged into text like the runs of
+    // the built-in one
+    out = tokenize((const uint8_t *)"hello <b>w\xc3\xb6rld</b>", 19,
+            16, 16, 256, 0, 1);
+    ST_CHECK_STR(out,
+            "T[hello ] 0-6\n"
+            "S<b> 6-9\n"
+            "T[w\xc3\xb6rld] 9-15\n"
+            "E<b> 15-19\n"
+            "--\n"
+            "END\n");
+    free(out);
+}
+
+// A token that does not fit in an empty batch stops the document with
+// st_invalid_config, after the tokens before it are delivered
+static void test_too_small(void)
+{
+    static const struct {
+        struct {
+            const uint8_t *buf;
+            size_t len;
+        } doc;
+        size_t attr_capacity;
+        size_t data_capacity;
+        const char *expected;
+    } cases[] = {
+        { DOCUMENT("ab<p a='x' b='y'>"), 1, 64, "T[ab] 0-2\n--\n" },
+        { DOCUMENT("ab<paragraph>"), 4, 8, "T[ab] 0-2\n--\n" },
+        { DOCUMENT("ab<p>\0"), 4, 8, "T[ab] 0-2\nS<p> 2-5\n--\n" },
+        { DOCUMENT("ab"), 4, 0, "" },
+    };
+
+    for (size_t c = 0; c < sizeof(cases) / sizeof(*cases); c++) {
+        st_test_out_t out = {0};
+        st_token_batch_t *batch;
+        st_tokenizer_t *t;
+
+        out.spans = 1;
+
+        if (st_tokenizer_init(&t, &st_test_callbacks, &out, NULL) != 0
+                || st_token_batch_init(&batch, 16, cases[c].attr_capacity,
+                    cases[c].data_capacity, NULL) != st_ok)
+            exit(2);
+
+        ST_CHECK_STATUS(st_tokenizer_set_batch(t, batch, &st_test_batch),
+                st_ok);
+        ST_CHECK_STATUS(st_tokenizer_set_string(t, cases[c].doc.buf,
+                    cases[c].doc.len), st_ok);
+        ST_CHECK_STATUS(st_tokenizer_run(t), st_invalid_config);
+        ST_CHECK_STR(out.buf, cases[c].expected);
+
+        st_tokenizer_destroy(t);
+        st_token_batch_free(batch);
+        st_test_out_free(&out);
+    }
+}
+
+int main(void)
+{
+    test_capacities();
+    test_layout();
+    test_too_small();
+
+    return st_test_failures != 0;
+}
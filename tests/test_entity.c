@@ -0,0 +1,141 @@
+// Named and numeric character references, and ones that are not
+#include "test.h"
+
+#include <string.h>
+
+#include "entity.h"
+
+static void check(const char *input, const char *expected)
+{
+    char *out = st_test_tokenize((const uint8_t *)input, strlen(input), NULL);
+
+    ST_CHECK_STR(out, expected);
+    free(out);
+}
+
+static void test_named(void)
+{
+    // With and without the semicolon, the longest name that matches, and
+    // names of two codepoints
+    check("&amp; &amp &AElig; &AElig &notin; &notit; &noti",
+            "T[& & \xc3\x86 \xc3\x86 \xe2\x88\x89 \xc2\xacit; \xc2\xaci]\n"
+            "END\n");
+    check("&acE; &nLt;",
+            "T[\xe2\x88\xbe\xcc\xb3 \xe2\x89\xaa\xe2\x83\x92]\nEND\n");
+
+    // In attribute values a name without semicolon that is followed by an
+    // alphanumeric or '=' is left as it is
+    check("<a title='&amp &notit &notit; &amp= &ampx &lt;'>",
+            "S<a> title=\"& &notit &notit; &amp= &ampx <\"\nEND\n");
+}
+
+static void test_numeric(void)
+{
+    check("&#60; &#x3C; &#X3c &#9731;",
+            "T[< < < \xe2\x98\x83]\nEND\n");
+
+    // Windows-1252 for the C1 controls, U+FFFD for NUL, surrogates and
+    // codepoints out of range
+    check("&#128; &#x9F; &#0; &#xD800; &#x110000; &#99999999999;",
+            "T[\xe2\x82\xac \xc5\xb8 \xef\xbf\xbd \xef\xbf\xbd \xef\xbf\xbd "
+            "\xef\xbf\xbd]\nEND\n");
+}
+
+static void test_malformed(void)
+{
+    // Nothing is decoded, the text stays as it was written
+    check("&bogus; & &# &#; &#x; &#xZ &;",
+            "T[&bogus; & &# &#; &#x; &#xZ &;]\nEND\n");
+
+    // At the end of the input
+    check("a &amp", "T[a &]\nEND\n");
+    check("a &#x41", "T[a A]\nEND\n");
+    check("a &", "T[a &]\nEND\n");
+}
+
+// Walk a name through the table, and get its codepoints
+static size_t lookup(const char *name, uint32_t codepoints[2])
+{
+    uint32_t node = ST_ENTITY_ROOT, index = 0, match = 0;
+    st_entity_result_t result = st_entity_none;
+
+    for (const char *c = name; *c != '\0'; c++) {
+        if ((result = st_entity_step(&node, &index, *c, &match))
+                == st_entity_none)
+            return 0;
+    }
+
+    return result == st_entity_match ?
+        st_entity_codepoints(match, codepoints) : 0;
+}
+
+static void test_table(void)
+{
+    uint32_t codepoints[2];
+
+    ST_CHECK(lookup("amp;", codepoints) == 1 && codepoints[0] == '&');
+    ST_CHECK(lookup("amp", codepoints) == 1 && codepoints[0] == '&');
+    ST_CHECK(lookup("notin;", codepoints) == 1 && codepoints[0] == 0x2209);
+    ST_CHECK(lookup("acE;", codepoints) == 2 && codepoints[0] == 0x223E
+            && codepoints[1] == 0x0333);
+    ST_CHECK(lookup("noti", codepoints) == 0);
+    ST_CHECK(lookup("bogus;", codepoints) == 0);
+}
+
+// Every text token on its own line with its span, unlike st_test_callbacks
+// which merges them
+static void text_span(st_tokenizer_t *t, st_token_t *token, void *ctx)
+{
+    const uint8_t *ptr;
+    size_t len, start, end;
+
+    if (st_token_type(token) != st_token_type_text)
+        return;
+
+    st_token_text(token, &ptr, &len);
+    st_token_span(token, &start, &end);
+    st_test_out_printf(ctx, "[%.*s] %zu-%zu\n", (int)len, ptr, start, end);
+}
+
+// The text of a reference spans the reference as it was written, and text
+// that is read past it spans that too
+static void test_spans(void)
+{
+    const char *input = "x&amp;y&#60;z&notit;&bogus;";
+    st_tokenizer_callbacks_t callbacks = st_test_callbacks;
+    st_test_out_t out = {0};
+    st_tokenizer_t *t;
+
+    callbacks.token = &text_span;
+    if (st_tokenizer_init(&t, &callbacks, &out, NULL) != 0)
+        exit(2);
+
+    ST_CHECK_STATUS(st_tokenizer_set_string(t, (const uint8_t *)input,
+                strlen(input)), st_ok);
+    ST_CHECK_STATUS(st_tokenizer_run(t), st_ok);
+    ST_CHECK_STR(out.buf,
+            "[x] 0-1\n"
+            "[&] 1-6\n"
+            "[y] 6-7\n"
+            "[<] 7-12\n"
+            "[z] 12-13\n"
+            "[\xc2\xaci] 13-18\n"
+            "[t;] 18-20\n"
+            "[&bo] 20-23\n"
+            "[gus;] 23-27\n"
+            "END\n");
+
+    st_tokenizer_destroy(t);
+    st_test_out_free(&out);
+}
+
+int main(void)
+{
+    test_named();
+    test_numeric();
+    test_malformed();
+    test_table();
+    test_spans();
+
+    return st_test_failures != 0;
+}
@@ -0,0 +1,129 @@
+// Input pushed in chunks gives the same tokens as the whole input at once
+#include "test.h"
+
+#include <string.h>
+
+#define DOCUMENT(s) { (const uint8_t *)(s), sizeof(s) - 1 }
+
+static const struct {
+    const uint8_t *buf;
+    size_t len;
+} documents[] = {
+    DOCUMENT("<div class=\"test\" id=hei><header></header><h1>\xc3\xa5</h1>"
+            "@</div>"),
+    DOCUMENT("text &amp; &lt;b&gt; &#x263a; &#9731; &notin; &notit; &bogus; "
+            "& end"),
+    DOCUMENT("<a href='x?a=1&amp;b=2' title=\"&quot;\xe2\x82\xac&quot;\">"
+            "link</a>"),
+    DOCUMENT("<p>\xf0\x9f\x98\x80\r\nline\rtwo\n</p><P CLASS=Up>"),
+    DOCUMENT("<textarea>a</b>&amp;</textarea><br/>"),
+    DOCUMENT("before\0after"),
+    DOCUMENT("<p>unfinished <b"),
+};
+
+// Tokenize the document pushed in chunks of the given sizes, repeating the
+// last one. Every chunk is a copy that is overwritten once it was fed, as
+// nothing may point into it afterwards.
+static char *feed(const uint8_t *doc, size_t len,
+        const size_t *sizes, size_t num_sizes, st_status *rc)
+{
+    st_test_out_t out = {0};
+    st_tokenizer_t *t;
+    size_t offset = 0, i = 0;
+
+    if (st_tokenizer_init(&t, &st_test_callbacks, &out, NULL) != 0)
+        exit(2);
+
+    *rc = st_ok;
+    while (offset < len && *rc == st_ok) {
+        size_t size = sizes[i < num_sizes - 1 ? i++ : i];
+        uint8_t *chunk;
+
+        if (size > len - offset)
+            size = len - offset;
+
+        chunk = malloc(size);
+        memcpy(chunk, doc + offset, size);
+        *rc = st_tokenizer_feed(t, chunk, size);
+        memset(chunk, 0xAA, size);
+        free(chunk);
+
+        offset += size;
+    }
+
+    if (*rc == st_ok)
+        *rc = st_tokenizer_finish(t);
+
+    st_tokenizer_destroy(t);
+
+    if (out.buf == NULL)
+        return calloc(1, 1);
+    return out.buf;
+}
+
+static void test_splits(void)
+{
+    for (size_t d = 0; d < sizeof(documents) / sizeof(*documents); d++) {
+        const uint8_t *doc = documents[d].buf;
+        size_t len = documents[d].len;
+        st_status expected_rc, rc;
+        char *expected, *out;
+
+        expected = st_test_tokenize(doc, len, &expected_rc);
+
+        // Chunks of one size
+        for (size_t size = 1; size <= len; size++) {
+            out = feed(doc, len, &size, 1, &rc);
+            ST_CHECK_STATUS(rc, expected_rc);
+            ST_CHECK_STR(out, expected);
+            free(out);
+        }
+
+        // Two chunks, split at every byte
+        for (size_t split = 0; split <= len; split++) {
+            size_t sizes[] = { split, len };
+
+            out = feed(doc, len, sizes, 2, &rc);
+            ST_CHECK_STATUS(rc, expected_rc);
+            ST_CHECK_STR(out, expected);
+            free(out);
+        }
+
+        free(expected);
+    }
+}
+
+// Finishing without a chunk, or with only empty ones, is an empty document
+static void test_empty(void)
+{
+    st_test_out_t out = {0};
+    st_tokenizer_t *t;
+
+    if (st_tokenizer_init(&t, &st_test_callbacks, &out, NULL) != 0)
+        exit(2);
+
+    ST_CHECK_STATUS(st_tokenizer_finish(t), st_ok);
+    ST_CHECK_STR(out.buf, "END\n");
+
+    st_test_out_clear(&out);
+    ST_CHECK_STATUS(st_tokenizer_feed(t, (const uint8_t *)"", 0), st_ok);
+    ST_CHECK_STATUS(st_tokenizer_finish(t), st_ok);
+    ST_CHECK_STR(out.buf, "END\n");
+
+    // The next document after it is tokenized as usual
+    st_test_out_clear(&out);
+    ST_CHECK_STATUS(st_tokenizer_feed(t, (const uint8_t *)"<p>", 3), st_ok);
+    ST_CHECK_STATUS(st_tokenizer_finish(t), st_ok);
+    ST_CHECK_STR(out.buf, "S<p>\nEND\n");
+
+    st_tokenizer_destroy(t);
+    st_test_out_free(&out);
+}
+
+int main(void)
+{
+    test_splits();
+    test_empty();
+
+    return st_test_failures != 0;
+}
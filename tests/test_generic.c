@@ -0,0 +1,127 @@
+// The generic state machine, which a custom decoder runs, against the UTF-8
+// one on the same documents
+#include "test.h"
+
+#include <string.h>
+
+#include "utf8.h"
+
+// A decoder the tokenizer does not know as UTF-8, so it decodes every
+// codepoint through it and emits characters instead of text runs
+static st_status next_codepoint(const uint8_t *in, size_t len, uint32_t *out,
+        size_t *bytes)
+{
+    return utf8_next_codepoint(in, len, out, bytes);
+}
+
+// Tokenize a string with spans, or push it in chunks of size bytes when size
+// is not 0. The status is stored in rc.
+static char *tokenize(const char *doc, size_t size, int generic,
+        st_status *rc)
+{
+    st_test_out_t out = {0};
+    size_t len = strlen(doc);
+    st_tokenizer_t *t;
+
+    out.spans = 1;
+
+    if (st_tokenizer_init(&t, &st_test_callbacks, &out, NULL) != 0)
+        exit(2);
+
+    if (generic) {
+        ST_CHECK_STATUS(st_tokenizer_set_encoding_handler(t, &next_codepoint,
+                    &utf8_encode_unicode), st_ok);
+    }
+
+    if (size == 0) {
+        if ((*rc = st_tokenizer_set_string(t, (const uint8_t *)doc, len))
+                == st_ok)
+            *rc = st_tokenizer_run(t);
+    } else {
+        *rc = st_ok;
+        for (size_t offset = 0; offset < len && *rc == st_ok;
+                offset += size) {
+            *rc = st_tokenizer_feed(t, (const uint8_t *)doc + offset,
+                    offset + size < len ? size : len - offset);
+        }
+        if (*rc == st_ok)
+            *rc = st_tokenizer_finish(t);
+    }
+
+    st_tokenizer_destroy(t);
+
+    // Nothing was written for an empty document
+    if (out.buf == NULL)
+        st_test_out_printf(&out, "");
+
+    return out.buf;
+}
+
+// The same tokens, spans and status with either state machine, whole and in
+// chunks
+static void check(const char *doc)
+{
+    for (size_t size = 0; size <= 5; size++) {
+        st_status rc, expected_rc;
+        char *expected = tokenize(doc, size, 0, &expected_rc);
+        char *out = tokenize(doc, size, 1, &rc);
+
+        ST_CHECK_STR(out, expected);
+        ST_CHECK_STATUS(rc, expected_rc);
+
+        free(expected);
+        free(out);
+    }
+}
+
+// Text, with and without codepoints of more than one byte
+static void test_text(void)
+{
+    check("");
+    check("plain text");
+    check("caf\xc3\xa9 \xe2\x82\xac 5 \xf0\x9f\x98\x80!");
+    check("a\r\nb\rc\n");
+    check("one < two > three");
+}
+
+// Tags and their attributes, in all the ways they are written
+static void test_tags(void)
+{
+    check("<p>x</p>");
+    check("<DIV\n>\xc3\xa5<h1 ></h1\t>");
+    check("<a href=\"x\" title='y' id=z>link</a>");
+    check("<input ID='' \n\tdisabled>");
+    check("<br/><img src=\"\xc3\xa5.png\" />");
+    check("<p a=\"1\" a=\"2\" B='3'>");
+    check("</>x</ p>");
+}
+
+// Character references in text and in attributes
+static void test_references(void)
+{
+    check("&lt;&gt;&amp;&quot;");
+    check("&AElig &AElig; &notit; &notin;");
+    check("&#60;&#x3c;&#X3C;&#0;&#x110000;&#xD800;&#128;");
+    check("&bogus; & &#; &#x;");
+    check("<a title=\"&amp;&lt;x&bogus;\" href='&#x41;'>");
+}
+
+// Errors, where the two end the same way
+static void test_errors(void)
+{
+    check("<!-- comment -->");
+    check("<!DOCTYPE html>");
+    check("a\xff" "b");
+    check("<p title=\"\xc0\x80\">");
+    check("text \xe2\x82");
+}
+
+int main(void)
+{
+    test_text();
+    test_tags();
+    test_references();
+    test_errors();
+
+    return st_test_failures != 0;
+}
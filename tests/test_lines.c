@@ -0,0 +1,177 @@
+// Lines and columns of offsets, with every kind of line end
+#include "test.h"
+
+#include <string.h>
+
+#include "lines.h"
+
+#define DOCUMENT(s) { (const uint8_t *)(s), sizeof(s) - 1 }
+
+static const struct {
+    const uint8_t *buf;
+    size_t len;
+} documents[] = {
+    DOCUMENT("one\ntwo\nthree"),
+    DOCUMENT("one\rtwo\rthree\r"),
+    DOCUMENT("one\r\ntwo\r\n\r\nthree\r\n"),
+    DOCUMENT("\n\r\r\n\n\r\r\r\n\n"),
+    DOCUMENT("\r\nmixed\n\rline ends\r\r\n\xc3\xa5\xe2\x82\xac\xf0\x9f\x98\x80"
+            "x\r\n\xc3\xa5"),
+    DOCUMENT("a line that is longer than a vector of bytes, \xc3\xa5 \xe2\x82"
+            "\xac \xf0\x9f\x98\x80 and more, before it ends\r\nand the next "
+            "one, that ends in CR at the end of a vector\rand one more line "
+            "after it, which ends in LF at the end of a block of them\n"
+            "last"),
+    DOCUMENT(""),
+};
+
+// Count lines and characters up to the offset, one byte at a time
+static void position_slow(const uint8_t *doc, size_t len, size_t offset,
+        size_t *line, size_t *column)
+{
+    // The LF of a CR LF has the position of the CR
+    if (offset > 0 && offset < len && doc[offset] == '\n'
+            && doc[offset - 1] == '\r')
+        offset--;
+
+    *line = 1;
+    *column = 1;
+
+    for (size_t i = 0; i < offset; i++) {
+        if (doc[i] == '\n' && i > 0 && doc[i - 1] == '\r')
+            continue;
+
+        if (doc[i] == '\n' || doc[i] == '\r') {
+            (*line)++;
+            *column = 1;
+        } else if ((doc[i] & 0xC0) != 0x80) {
+            (*column)++;
+        }
+    }
+}
+
+static void check(st_lines_t *lines, const uint8_t *doc, size_t len,
+        size_t offset)
+{
+    size_t line = 0, column = 0, expected_line, expected_column;
+
+    // Only offsets at the start of a character have a column
+    if (offset < len && (doc[offset] & 0xC0) == 0x80)
+        return;
+
+    position_slow(doc, len, offset, &expected_line, &expected_column);
+    ST_CHECK_STATUS(st_lines_position(lines, offset, &line, &column), st_ok);
+
+    if (line != expected_line || column != expected_column) {
+        fprintf(stderr, "offset %zu of \"%.*s\": %zu:%zu, expected %zu:%zu\n",
+                offset, (int)len, doc, line, column, expected_line,
+                expected_column);
+        st_test_failures++;
+    }
+}
+
+// Offsets looked up forwards are counted on from the last one, and ones that
+// go back are searched in an index of the lines
+static void test_lines(void)
+{
+    st_lines_t *lines;
+    size_t line, column;
+
+    if (st_lines_init(&lines, NULL) != st_ok)
+        exit(2);
+
+    for (size_t d = 0; d < sizeof(documents) / sizeof(*documents); d++) {
+        const uint8_t *doc = documents[d].buf;
+        size_t len = documents[d].len;
+
+        // Forwards, once from the start and once skipping to each offset
+        for (size_t offset = 0; offset <= len; offset++) {
+            st_lines_set(lines, doc, len);
+            check(lines, doc, len, offset);
+        }
+
+        st_lines_set(lines, doc, len);
+        for (size_t offset = 0; offset <= len; offset++)
+            check(lines, doc, len, offset);
+
+        // Backwards, and in a jumbled order
+        for (size_t offset = len + 1; offset-- > 0;)
+            check(lines, doc, len, offset);
+
+        for (size_t i = 0; i <= len; i++)
+            check(lines, doc, len, i * 7 % (len + 1));
+
+        // Past the end
+        ST_CHECK_STATUS(st_lines_position(lines, len + 1, &line, &column),
+                st_not_found);
+    }
+
+    // Without a document
+    st_lines_set(lines, NULL, 0);
+    ST_CHECK_STATUS(st_lines_position(lines, 0, &line, &column),
+            st_not_found);
+
+    st_lines_free(lines);
+}
+
+static void document_end(st_tokenizer_t *t, void *ctx)
+{
+}
+
+static void error_position(st_tokenizer_t *t, st_token_t *token, void *ctx)
+{
+    size_t *position = ctx;
+
+    if (st_token_type(token) == st_token_type_error) {
+        ST_CHECK_STATUS(st_tokenizer_position(t,
+                    st_token_error_offset(token), &position[0],
+                    &position[1]), st_ok);
+    }
+}
+
+// The tokenizer looks up the offsets of its errors in string input, but not
+// in input it does not have as a whole
+static void test_tokenizer(void)
+{
+    static const uint8_t doc[] = "<p>\r\n\xc3\xa5\r\xe2\x82\xac\n  x\0y";
+    st_tokenizer_callbacks_t callbacks = st_test_callbacks;
+    size_t position[2] = {0}, line, column;
+    st_tokenizer_t *t;
+
+    callbacks.token = &error_position;
+    callbacks.document_end = &document_end;
+    if (st_tokenizer_init(&t, &callbacks, position, NULL) != 0)
+        exit(2);
+
+    ST_CHECK_STATUS(st_tokenizer_set_string(t, doc, sizeof(doc) - 1), st_ok);
+    ST_CHECK_STATUS(st_tokenizer_run(t), st_ok);
+    ST_CHECK(position[0] == 4 && position[1] == 4);
+
+    ST_CHECK_STATUS(st_tokenizer_position(t, sizeof(doc), &line, &column),
+            st_not_found);
+
+    // Converted input
+    ST_CHECK_STATUS(st_tokenizer_set_encoding(t, st_encoding_utf16le), st_ok);
+    ST_CHECK_STATUS(st_tokenizer_set_string(t, (const uint8_t *)"<\0p\0>\0",
+                6), st_ok);
+    ST_CHECK_STATUS(st_tokenizer_run(t), st_ok);
+    ST_CHECK_STATUS(st_tokenizer_position(t, 0, &line, &column),
+            st_not_found);
+
+    // Pushed input
+    ST_CHECK_STATUS(st_tokenizer_set_encoding(t, st_encoding_utf8), st_ok);
+    ST_CHECK_STATUS(st_tokenizer_feed(t, doc, 3), st_ok);
+    ST_CHECK_STATUS(st_tokenizer_position(t, 0, &line, &column),
+            st_not_found);
+    ST_CHECK_STATUS(st_tokenizer_finish(t), st_ok);
+
+    st_tokenizer_destroy(t);
+}
+
+int main(void)
+{
+    test_lines();
+    test_tokenizer();
+
+    return st_test_failures != 0;
+}
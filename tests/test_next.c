@@ -0,0 +1,146 @@
+// Pulling tokens with st_tokenizer_next from every kind of input
+#define _POSIX_C_SOURCE 200809L
+
+#include "test.h"
+
+#include <string.h>
+#include <unistd.h>
+
+static const uint8_t document[] =
+    "<p class=a>text &amp; more</p>\xc3\xa5 &lt";
+
+static const uint8_t error_document[] = "<p>before\0after";
+
+// Pull all tokens, and check that the end is reported from then on
+static char *pull(st_tokenizer_t *t, st_status *rc)
+{
+    st_test_out_t out = {0};
+    st_token_t *token;
+    int error = 0;
+
+    while ((*rc = st_tokenizer_next(t, &token)) == st_ok) {
+        error = st_token_type(token) == st_token_type_error;
+        st_test_callbacks.token(t, token, &out);
+    }
+
+    // Like st_tokenizer_run, which ends the document unless an error token
+    // did
+    if (*rc == st_eof && !error)
+        st_test_callbacks.document_end(t, &out);
+
+    for (int i = 0; i < 3; i++)
+        ST_CHECK_STATUS(st_tokenizer_next(t, &token), st_eof);
+
+    return out.buf;
+}
+
+static void check_string(const uint8_t *doc, size_t len)
+{
+    st_tokenizer_t *t;
+    st_status rc;
+    char *expected = st_test_tokenize(doc, len, NULL), *out;
+
+    if (st_tokenizer_init(&t, &st_test_callbacks, NULL, NULL) != 0)
+        exit(2);
+
+    ST_CHECK_STATUS(st_tokenizer_set_string(t, doc, len), st_ok);
+    out = pull(t, &rc);
+    ST_CHECK_STATUS(rc, st_eof);
+    ST_CHECK_STR(out, expected);
+    free(out);
+
+    st_tokenizer_destroy(t);
+    free(expected);
+}
+
+static void check_file(const uint8_t *doc, size_t len)
+{
+    char path[] = "/tmp/styre_test_next_XXXXXX";
+    int fd = mkstemp(path), fds[2];
+    st_tokenizer_t *t;
+    st_status rc;
+    char *expected = st_test_tokenize(doc, len, NULL), *out;
+
+    if (fd < 0 || write(fd, doc, len) != (ssize_t)len)
+        exit(2);
+    close(fd);
+
+    if (st_tokenizer_init(&t, &st_test_callbacks, NULL, NULL) != 0)
+        exit(2);
+
+    // A regular file is mapped
+    ST_CHECK_STATUS(st_tokenizer_set_file(t, path), st_ok);
+    out = pull(t, &rc);
+    ST_CHECK_STATUS(rc, st_eof);
+    ST_CHECK_STR(out, expected);
+    free(out);
+
+    // A pipe is read in chunks
+    if (pipe(fds) != 0 || write(fds[1], doc, len) != (ssize_t)len)
+        exit(2);
+    close(fds[1]);
+
+    ST_CHECK_STATUS(st_tokenizer_set_fd(t, fds[0]), st_ok);
+    out = pull(t, &rc);
+    ST_CHECK_STATUS(rc, st_eof);
+    ST_CHECK_STR(out, expected);
+    free(out);
+    close(fds[0]);
+
+    st_tokenizer_destroy(t);
+    unlink(path);
+    free(expected);
+}
+
+// Without callbacks, or with some of them, which is all pulling tokens needs
+static void check_no_callbacks(const uint8_t *doc, size_t len)
+{
+    st_tokenizer_callbacks_t callbacks = {NULL, NULL, NULL, NULL};
+    st_test_out_t out = {0};
+    st_tokenizer_t *t;
+    st_status rc, expected_rc;
+    char *expected = st_test_tokenize(doc, len, &expected_rc), *pulled;
+
+    if (st_tokenizer_init(&t, NULL, NULL, NULL) != 0)
+        exit(2);
+
+    ST_CHECK_STATUS(st_tokenizer_set_string(t, doc, len), st_ok);
+    pulled = pull(t, &rc);
+    ST_CHECK_STATUS(rc, st_eof);
+    ST_CHECK_STR(pulled, expected);
+    free(pulled);
+
+    ST_CHECK_STATUS(st_tokenizer_set_string(t, doc, len), st_ok);
+    ST_CHECK_STATUS(st_tokenizer_run(t), expected_rc);
+
+    ST_CHECK_STATUS(st_tokenizer_feed(t, doc, len), st_ok);
+    ST_CHECK_STATUS(st_tokenizer_finish(t), expected_rc);
+
+    st_tokenizer_destroy(t);
+
+    // Only tokens, without the end of the document
+    callbacks.token = st_test_callbacks.token;
+    if (st_tokenizer_init(&t, &callbacks, &out, NULL) != 0)
+        exit(2);
+
+    ST_CHECK_STATUS(st_tokenizer_set_string(t, doc, len), st_ok);
+    ST_CHECK_STATUS(st_tokenizer_run(t), expected_rc);
+    ST_CHECK(strncmp(out.buf, expected, out.len) == 0);
+    ST_CHECK(strstr(out.buf, "END") == NULL);
+
+    st_tokenizer_destroy(t);
+    st_test_out_free(&out);
+    free(expected);
+}
+
+int main(void)
+{
+    check_string(document, sizeof(document) - 1);
+    check_string(error_document, sizeof(error_document) - 1);
+    check_file(document, sizeof(document) - 1);
+    check_file(error_document, sizeof(error_document) - 1);
+    check_no_callbacks(document, sizeof(document) - 1);
+    check_no_callbacks(error_document, sizeof(error_document) - 1);
+
+    return st_test_failures != 0;
+}
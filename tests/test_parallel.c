@@ -0,0 +1,182 @@
+// st_tokenizer_run_parallel against st_tokenizer_run on the same document
+#include "test.h"
+
+#include <string.h>
+
+// Capacities of the batches, the ones of the example parser
+#define CAPACITY 256
+#define ATTR_CAPACITY 1024
+#define DATA_CAPACITY 65536
+
+// Output of a run, and what is checked of its batches on the way
+typedef struct {
+    st_test_out_t out;                      // First, for the callbacks
+    int text_open;                          // If the last batch ended in
+                                            // text without being full
+    int text_split;                         // If text went on from there
+} run_t;
+
+static void batch(st_tokenizer_t *t, st_token_batch_t *batch, void *ctx)
+{
+    run_t *run = ctx;
+
+    if (run->text_open && batch->types[0] == st_token_type_text)
+        run->text_split = 1;
+
+    run->text_open = batch->types[batch->count - 1] == st_token_type_text
+        && batch->data_used < batch->data_capacity;
+
+    st_test_batch(t, batch, &run->out);
+}
+
+// Tokenize with batches, on threads threads or sequentially when it is 0.
+// With merge, text is merged over batches in the output.
+static char *tokenize(const uint8_t *doc, size_t len, size_t threads,
+        int merge)
+{
+    run_t run = {{0}};
+    st_token_batch_t *b;
+    st_tokenizer_t *t;
+
+    run.out.spans = 1;
+    run.out.merge_batches = merge;
+
+    if (st_tokenizer_init(&t, &st_test_callbacks, &run, NULL) != 0
+            || st_token_batch_init(&b, CAPACITY, ATTR_CAPACITY,
+                DATA_CAPACITY, NULL) != st_ok)
+        exit(2);
+
+    ST_CHECK_STATUS(st_tokenizer_set_batch(t, b, &batch), st_ok);
+    ST_CHECK_STATUS(st_tokenizer_set_string(t, doc, len), st_ok);
+    ST_CHECK_STATUS(threads > 0 ? st_tokenizer_run_parallel(t, threads) :
+            st_tokenizer_run(t), st_ok);
+
+    // Text is only split over batches where one is full
+    ST_CHECK(!run.text_split);
+
+    st_tokenizer_destroy(t);
+    st_token_batch_free(b);
+
+    return run.out.buf;
+}
+
+// A document of two halves of text with something in between, which is where
+// it is split in two
+static uint8_t *halves(const char *middle, size_t *len)
+{
+    size_t half = 400000, n = strlen(middle);
+    uint8_t *doc = malloc(2 * half + n);
+
+    memset(doc, 'a', half);
+    memcpy(doc + half, middle, n);
+    memset(doc + half + n, 'c', half);
+
+    *len = 2 * half + n;
+    return doc;
+}
+
+// A first half that ends in a character reference or in a tag, where the
+// second half does not start in the data state. The tokenizer of the first
+// half carries on through the second half, in the same batch.
+static void test_carried(void)
+{
+    static const char *const middles[] = {
+        "x&lt;<b>", "x&amp;<b>", "x&AElig<b>", "x&#x3c<b>", "x&<b>",
+        "<a title=\"xxxxxxxxxxxx<b>\">",
+    };
+
+    for (size_t m = 0; m < sizeof(middles) / sizeof(*middles); m++) {
+        size_t len;
+        uint8_t *doc = halves(middles[m], &len);
+        char *expected = tokenize(doc, len, 0, 0);
+        char *out = tokenize(doc, len, 2, 0);
+
+        ST_CHECK_STR(out, expected);
+
+        free(expected);
+        free(out);
+        free(doc);
+    }
+}
+
+// A split where the second half starts in the data state, as speculated.
+// The batch of the first half ends early, but no text is split.
+static void test_clean_splits(void)
+{
+    static const char *const middles[] = {
+        "x&#60;<b>", "x&bogus;<b>", "xyzzy</b>", "x<3",
+    };
+
+    for (size_t m = 0; m < sizeof(middles) / sizeof(*middles); m++) {
+        size_t len;
+        uint8_t *doc = halves(middles[m], &len);
+        char *expected = tokenize(doc, len, 0, 1);
+        char *out = tokenize(doc, len, 2, 1);
+
+        ST_CHECK_STR(out, expected);
+
+        free(expected);
+        free(out);
+        free(doc);
+    }
+}
+
+// A document of pieces in a fixed random order, with '<' in attribute values
+// and comment-like text so that some of the speculated splits are wrong
+static uint8_t *document(size_t size, const char *end, size_t *len)
+{
+    static const char *const pieces[] = {
+        "<div class=\"a\" id='b'>", "</div>", "<p>", "</p>\r\n",
+        "text &amp; more text ", "&notin;&#x263a;&#9731; ",
+        "\xc3\xa5\xe2\x82\xac",
+        "<a href='?x=1&amp;y=<2>' title=\"<b>\">", "</a>", "\n",
+        "<img alt=\"a < b\">", "line\rline ", "<TEXTAREA>&lt;</TEXTAREA>",
+    };
+    size_t n = 0, num = sizeof(pieces) / sizeof(*pieces);
+    uint8_t *doc = malloc(size + 64 + strlen(end));
+    uint32_t r = 1;
+
+    while (n < size) {
+        r = r * 1103515245 + 12345;
+        const char *piece = pieces[(r >> 16) % num];
+        memcpy(doc + n, piece, strlen(piece));
+        n += strlen(piece);
+    }
+
+    memcpy(doc + n, end, strlen(end));
+    *len = n + strlen(end);
+
+    return doc;
+}
+
+// Any number of threads gives the tokens and spans of a sequential run
+static void test_documents(void)
+{
+    static const char *const ends[] = { "", "<p>end", "&amp", "x\0y<p>" };
+    static const size_t threads[] = { 2, 3, 4 };
+
+    for (size_t e = 0; e < sizeof(ends) / sizeof(*ends); e++) {
+        size_t len;
+        uint8_t *doc = document(1024 * 1024, ends[e], &len);
+        char *expected = tokenize(doc, len, 0, 1);
+
+        for (size_t i = 0; i < sizeof(threads) / sizeof(*threads); i++) {
+            char *out = tokenize(doc, len, threads[i], 1);
+
+            ST_CHECK_STR(out, expected);
+            free(out);
+        }
+
+        free(expected);
+        free(doc);
+    }
+}
+
+int main(void)
+{
+    test_carried();
+    test_clean_splits();
+    test_documents();
+
+    return st_test_failures != 0;
+}
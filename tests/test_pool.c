@@ -0,0 +1,209 @@
+// st_pool_run against st_tokenizer_run on each of the documents
+#include "test.h"
+#include "pool.h"
+
+#include <string.h>
+#include <pthread.h>
+
+#define THREADS 4
+
+// Output of a document, and the calls that made it
+typedef struct {
+    st_test_out_t out;                      // First, for the callbacks
+    int starts;                             // Calls of document_start
+    int ends;                               // Calls of document_end
+    pthread_t thread;                       // Worker that tokenized it
+} doc_t;
+
+static void document_start(st_tokenizer_t *t, void *ctx)
+{
+    doc_t *doc = ctx;
+
+    doc->starts++;
+    doc->thread = pthread_self();
+    st_test_callbacks.document_start(t, ctx);
+}
+
+static void document_end(st_tokenizer_t *t, void *ctx)
+{
+    doc_t *doc = ctx;
+
+    doc->ends++;
+    st_test_callbacks.document_end(t, ctx);
+}
+
+static void token(st_tokenizer_t *t, st_token_t *token, void *ctx)
+{
+    st_test_callbacks.token(t, token, ctx);
+}
+
+static st_tokenizer_callbacks_t callbacks = {
+    &document_start,
+    &document_end,
+    &token,
+    NULL,
+};
+
+// Tokenize a document with st_tokenizer_run, with the callbacks of the pool
+static st_status tokenize(const uint8_t *buf, size_t len, doc_t *doc)
+{
+    st_tokenizer_t *t;
+    st_status rc;
+
+    memset(doc, 0, sizeof(*doc));
+
+    if (st_tokenizer_init(&t, &callbacks, doc, NULL) != 0)
+        exit(2);
+
+    if ((rc = st_tokenizer_set_string(t, buf, len)) == st_ok)
+        rc = st_tokenizer_run(t);
+
+    st_tokenizer_destroy(t);
+
+    // Nothing was written for an empty document
+    if (doc->out.buf == NULL)
+        st_test_out_printf(&doc->out, "");
+
+    return rc;
+}
+
+// Run the documents through the pool, and check each of them against
+// st_tokenizer_run: the output, the status, and the calls of document_start
+// and document_end. An empty document is not started, and one that ends in an
+// error is not ended.
+static void check_run(st_pool_t *pool, const uint8_t *const *bufs,
+        const size_t *lens, size_t num_docs, doc_t *out)
+{
+    st_pool_document_t *docs = calloc(num_docs + 1, sizeof(*docs));
+
+    memset(out, 0, num_docs * sizeof(*out));
+
+    for (size_t i = 0; i < num_docs; i++) {
+        docs[i].buf = bufs[i];
+        docs[i].len = lens[i];
+        docs[i].ctx = &out[i];
+        docs[i].rc = st_err;
+    }
+
+    ST_CHECK_STATUS(st_pool_run(pool, docs, num_docs), st_ok);
+
+    for (size_t i = 0; i < num_docs; i++) {
+        doc_t expected;
+        st_status rc = tokenize(bufs[i], lens[i], &expected);
+
+        ST_CHECK_STR(out[i].out.buf, expected.out.buf);
+        ST_CHECK_STATUS(docs[i].rc, rc);
+        ST_CHECK(out[i].starts == expected.starts);
+        ST_CHECK(out[i].ends == expected.ends);
+        ST_CHECK(expected.starts == (lens[i] > 0));
+
+        st_test_out_free(&expected.out);
+        st_test_out_free(&out[i].out);
+    }
+
+    free(docs);
+}
+
+// Small documents, each with its own output and status
+static const char *const small[] = {
+    "<p class=\"a\">one</p>",
+    "two &amp; three",
+    "",
+    "<b>bad \xff byte</b>",
+    "<ul><li>x<li>y</ul>",
+    "<!-- comment -->text",
+};
+
+#define NUM_SMALL (sizeof(small) / sizeof(*small))
+
+static void small_docs(size_t num_docs, const uint8_t **bufs, size_t *lens)
+{
+    for (size_t i = 0; i < num_docs; i++) {
+        bufs[i] = (const uint8_t *)small[i % NUM_SMALL];
+        lens[i] = strlen(small[i % NUM_SMALL]);
+    }
+}
+
+// No documents, and fewer documents than workers, leave some of them
+// without a range
+static void test_few(st_pool_t *pool)
+{
+    const uint8_t *bufs[THREADS];
+    size_t lens[THREADS];
+    doc_t out[THREADS];
+
+    small_docs(THREADS, bufs, lens);
+
+    ST_CHECK_STATUS(st_pool_run(pool, NULL, 0), st_ok);
+
+    for (size_t n = 1; n < THREADS; n++)
+        check_run(pool, bufs, lens, n, out);
+}
+
+// Large documents at the front, all in the range of the first worker, and
+// small ones behind them. The others run out early and steal from the
+// first, so the large documents are tokenized by more than one worker.
+static void test_uneven(st_pool_t *pool)
+{
+    size_t num_large = 8, num_docs = THREADS * num_large;
+    size_t large_len = 1000000;
+    const uint8_t **bufs = malloc(num_docs * sizeof(*bufs));
+    size_t *lens = malloc(num_docs * sizeof(*lens));
+    doc_t *out = malloc(num_docs * sizeof(*out));
+    uint8_t *large = malloc(large_len);
+    static const char part[] = "<p id=\"x\">some text &amp; more</p>\n";
+    int stolen = 0;
+
+    for (size_t i = 0; i < large_len; i++)
+        large[i] = part[i % (sizeof(part) - 1)];
+
+    small_docs(num_docs, bufs, lens);
+    for (size_t i = 0; i < num_large; i++) {
+        bufs[i] = large;
+        lens[i] = large_len;
+    }
+
+    check_run(pool, bufs, lens, num_docs, out);
+
+    for (size_t i = 1; i < num_large; i++)
+        if (!pthread_equal(out[i].thread, out[0].thread))
+            stolen = 1;
+    ST_CHECK(stolen);
+
+    free(large);
+    free(out);
+    free(lens);
+    free(bufs);
+}
+
+// The workers and their tokenizers are reused from run to run
+static void test_repeated(st_pool_t *pool)
+{
+    size_t num_docs = 3 * THREADS + 1;
+    const uint8_t *bufs[3 * THREADS + 1];
+    size_t lens[3 * THREADS + 1];
+    doc_t out[3 * THREADS + 1];
+
+    small_docs(num_docs, bufs, lens);
+
+    for (size_t run = 0; run < 10; run++) {
+        check_run(pool, bufs + run % NUM_SMALL, lens + run % NUM_SMALL,
+                num_docs - run % NUM_SMALL, out);
+    }
+}
+
+int main(void)
+{
+    st_pool_t *pool;
+
+    if (st_pool_init(&pool, THREADS, &callbacks, NULL) != st_ok)
+        return 2;
+
+    test_few(pool);
+    test_uneven(pool);
+    test_repeated(pool);
+
+    st_pool_free(pool);
+
+    return st_test_failures != 0;
+}
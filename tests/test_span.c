@@ -0,0 +1,143 @@
+// Spans of tags, their names and attributes, and of text
+#include "test.h"
+
+#include <string.h>
+
+// Input the spans are in, and where they are written out
+typedef struct {
+    st_test_out_t out;                      // First, for the callbacks
+    const uint8_t *doc;
+} spans_t;
+
+// Write the source of a span, and the span
+static void source(spans_t *s, const char *label, size_t start, size_t end)
+{
+    st_test_out_printf(&s->out, " %s[%.*s]%zu-%zu", label, (int)(end - start),
+            s->doc + start, start, end);
+}
+
+static void token_spans(st_tokenizer_t *t, st_token_t *token, void *ctx)
+{
+    spans_t *s = ctx;
+    size_t start, end;
+
+    st_token_span(token, &start, &end);
+
+    switch (st_token_type(token)) {
+        case st_token_type_start_tag:
+        case st_token_type_end_tag:
+            source(s, "tag", start, end);
+
+            ST_CHECK_STATUS(st_token_tag_name_span(token, &start, &end),
+                    st_ok);
+            source(s, "name", start, end);
+
+            for (size_t i = 0; i < st_token_attr_num(token); i++) {
+                ST_CHECK_STATUS(st_token_attr_name_span(token, i, &start,
+                            &end), st_ok);
+                source(s, "attr", start, end);
+
+                ST_CHECK_STATUS(st_token_attr_value_span(token, i, &start,
+                            &end), st_ok);
+                source(s, "value", start, end);
+            }
+            break;
+
+        case st_token_type_error:
+            source(s, "error", start, end);
+            break;
+
+        default:
+            source(s, "text", start, end);
+            break;
+    }
+
+    st_test_out_printf(&s->out, "\n");
+}
+
+// Tokenize a string, or push it in chunks of size bytes when size is not 0
+static char *spans(const char *doc, size_t size)
+{
+    st_tokenizer_callbacks_t callbacks = st_test_callbacks;
+    spans_t s = {{0}};
+    size_t len = strlen(doc);
+    st_tokenizer_t *t;
+
+    s.doc = (const uint8_t *)doc;
+    callbacks.token = &token_spans;
+
+    if (st_tokenizer_init(&t, &callbacks, &s, NULL) != 0)
+        exit(2);
+
+    if (size == 0) {
+        ST_CHECK_STATUS(st_tokenizer_set_string(t, s.doc, len), st_ok);
+        ST_CHECK_STATUS(st_tokenizer_run(t), st_ok);
+    } else {
+        for (size_t offset = 0; offset < len; offset += size) {
+            ST_CHECK_STATUS(st_tokenizer_feed(t, s.doc + offset,
+                        offset + size < len ? size : len - offset), st_ok);
+        }
+        ST_CHECK_STATUS(st_tokenizer_finish(t), st_ok);
+    }
+
+    st_tokenizer_destroy(t);
+    return s.out.buf;
+}
+
+static void check(const char *doc, const char *expected)
+{
+    char *out = spans(doc, 0);
+
+    ST_CHECK_STR(out, expected);
+    free(out);
+
+    // The same spans when the tokens are cut by chunks
+    for (size_t size = 1; size <= 5; size++) {
+        out = spans(doc, size);
+        ST_CHECK_STR(out, expected);
+        free(out);
+    }
+}
+
+// A tag spans from its '<' to after its '>', and its name as it was written
+static void test_tags(void)
+{
+    check("<p>x</p>",
+            " tag[<p>]0-3 name[p]1-2\n"
+            " text[x]3-4\n"
+            " tag[</p>]4-8 name[p]6-7\n"
+            "END\n");
+
+    check("<DIV\n>\xc3\xa5<h1 ></h1\t>",
+            " tag[<DIV\n>]0-6 name[DIV]1-4\n"
+            " text[\xc3\xa5]6-8\n"
+            " tag[<h1 >]8-13 name[h1]9-11\n"
+            " tag[</h1\t>]13-19 name[h1]15-17\n"
+            "END\n");
+}
+
+// Names and values of attributes, without the quotes, and with references as
+// they were written. A valueless attribute has an empty value at the end of
+// its name.
+static void test_attributes(void)
+{
+    check("<a href=\"x\" title='&amp;y'>",
+            " tag[<a href=\"x\" title='&amp;y'>]0-27 name[a]1-2"
+            " attr[href]3-7 value[x]9-10"
+            " attr[title]12-17 value[&amp;y]19-25\n"
+            "END\n");
+
+    check("<input ID='' \n\tdisabled>",
+            " tag[<input ID='' \n\tdisabled>]0-24 name[input]1-6"
+            " attr[ID]7-9 value[]11-11"
+            " attr[disabled]15-23 value[]23-23\n"
+            "END\n");
+}
+
+int main(void)
+{
+    test_tags();
+    test_attributes();
+
+    return st_test_failures != 0;
+}
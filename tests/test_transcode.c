@@ -0,0 +1,230 @@
+// Converting every encoding to UTF-8, whole and in pieces, and tokenizing it
+#include "test.h"
+
+#include <string.h>
+
+#include "transcode.h"
+#include "utf8.h"
+
+// Growing output of a conversion
+typedef struct {
+    uint8_t *buf;
+    size_t len;
+} bytes_t;
+
+static void append(bytes_t *b, const uint8_t *ptr, size_t len)
+{
+    b->buf = realloc(b->buf, b->len + len + 1);
+    if (b->buf == NULL)
+        exit(2);
+
+    memcpy(b->buf + b->len, ptr, len);
+    b->len += len;
+}
+
+// Convert input given in chunks of chunk bytes, into out_len bytes of output
+// at a time
+static bytes_t transcode(st_encoding_t encoding, const uint8_t *in, size_t len,
+        size_t chunk, size_t out_len)
+{
+    bytes_t b = {0};
+    uint8_t out[4096];
+    size_t offset = 0, end, consumed, written;
+    st_transcoder_t *tc;
+
+    if (st_transcoder_init(&tc, encoding, NULL) != st_ok)
+        exit(2);
+
+    while (offset < len) {
+        end = offset + chunk < len ? offset + chunk : len;
+
+        // The chunk is used up, at most out_len bytes at a time
+        while (offset < end) {
+            st_transcode(tc, in + offset, end - offset, &consumed,
+                    out, out_len, &written);
+            ST_CHECK(consumed > 0 || written > 0);
+            append(&b, out, written);
+            offset += consumed;
+        }
+    }
+
+    st_transcode_finish(tc, out, &written);
+    append(&b, out, written);
+
+    st_transcoder_free(tc);
+    return b;
+}
+
+// Check a conversion with chunks and output of any size
+static void check(st_encoding_t encoding, const uint8_t *in, size_t len,
+        const uint8_t *expected, size_t expected_len)
+{
+    static const size_t out_lens[] = { ST_TRANSCODE_MIN_OUT, 5, 7, 4096 };
+
+    for (size_t chunk = 1; chunk <= len; chunk++) {
+        for (size_t o = 0; o < sizeof(out_lens) / sizeof(*out_lens); o++) {
+            bytes_t b = transcode(encoding, in, len, chunk, out_lens[o]);
+
+            if (b.len != expected_len
+                    || memcmp(b.buf, expected, expected_len) != 0) {
+                fprintf(stderr, "%s: chunks of %zu, output of %zu: "
+                        "not converted\n", st_encoding_name(encoding), chunk,
+                        out_lens[o]);
+                st_test_failures++;
+            }
+            free(b.buf);
+        }
+    }
+}
+
+// Every byte of every single-byte encoding becomes the codepoint of its table,
+// the ASCII ones as they are
+static void test_single_byte(void)
+{
+    uint8_t in[256], expected[128 + 128 * 3];
+
+    for (size_t i = 0; i < 256; i++)
+        in[i] = (uint8_t)i;
+
+    for (int e = ST_ENCODING_FIRST_SINGLE_BYTE; e < ST_ENCODING_COUNT; e++) {
+        const uint16_t *high = st_encoding_high_half((st_encoding_t)e);
+        size_t len = 128;
+
+        ST_CHECK(high != NULL);
+        if (high == NULL)
+            continue;
+
+        memcpy(expected, in, 128);
+        for (size_t i = 0; i < 128; i++)
+            len += utf8_encode_codepoint(high[i], expected + len);
+
+        check((st_encoding_t)e, in, 256, expected, len);
+    }
+
+    ST_CHECK(st_encoding_high_half(st_encoding_utf8) == NULL);
+    ST_CHECK(st_encoding_high_half(st_encoding_utf16le) == NULL);
+}
+
+// Units of UTF-16 in either byte order
+static size_t utf16(const uint16_t *units, size_t num, int be, uint8_t *out)
+{
+    for (size_t i = 0; i < num; i++) {
+        out[2 * i + !be] = (uint8_t)(units[i] >> 8);
+        out[2 * i + be] = (uint8_t)(units[i] & 0xFF);
+    }
+
+    return 2 * num;
+}
+
+// Surrogate pairs, lone surrogates and a unit that is cut by the end of the
+// input, in enough text for the vector loops
+static void test_utf16(void)
+{
+    static const uint16_t units[] = {
+        '<', 'p', '>', 'a', 'b', 'c', 'd', 'e', 'f', 'g', 'h', 0xE5, 0x20AC,
+        0xD83D, 0xDE00, 'i', 0xD800, 'j', 0xDC00, 'k', 'l', 'm', 'n', 'o',
+        'p', 'q', 'r', 's', 't', 'u', 'v', 'w', 0xD83D, 0xDE00, 0xD83D,
+    };
+    static const uint8_t utf8[] =
+        "<p>abcdefgh\xc3\xa5\xe2\x82\xac\xf0\x9f\x98\x80i\xef\xbf\xbdj"
+        "\xef\xbf\xbdklmnopqrstuvw\xf0\x9f\x98\x80\xef\xbf\xbd";
+    size_t num = sizeof(units) / sizeof(*units);
+    uint8_t in[2 * sizeof(units) / sizeof(*units) + 1];
+
+    for (int be = 0; be <= 1; be++) {
+        st_encoding_t encoding = be ? st_encoding_utf16be :
+            st_encoding_utf16le;
+        size_t len = utf16(units, num, be, in);
+
+        check(encoding, in, len, utf8, sizeof(utf8) - 1);
+
+        // An odd byte at the end is a unit that was cut
+        in[len] = 'x';
+        check(encoding, in, len + 1, utf8, sizeof(utf8) - 1);
+    }
+}
+
+// UTF-8 is copied as it is, even when it is not valid
+static void test_utf8(void)
+{
+    static const uint8_t in[] = "a\xc3\xa5\xe2\x82\xac\xff\xf0\x9f\x98\x80";
+
+    check(st_encoding_utf8, in, sizeof(in) - 1, in, sizeof(in) - 1);
+}
+
+// Tokenize input in an encoding, set as a string or pushed in chunks of size
+// bytes when size is not 0
+static char *tokenize(st_encoding_t encoding, const uint8_t *in, size_t len,
+        size_t size)
+{
+    st_test_out_t out = {0};
+    st_tokenizer_t *t;
+
+    out.spans = 1;
+
+    if (st_tokenizer_init(&t, &st_test_callbacks, &out, NULL) != 0)
+        exit(2);
+
+    ST_CHECK_STATUS(st_tokenizer_set_encoding(t, encoding), st_ok);
+
+    if (size == 0) {
+        ST_CHECK_STATUS(st_tokenizer_set_string(t, in, len), st_ok);
+        ST_CHECK_STATUS(st_tokenizer_run(t), st_ok);
+    } else {
+        for (size_t offset = 0; offset < len; offset += size) {
+            ST_CHECK_STATUS(st_tokenizer_feed(t, in + offset,
+                        offset + size < len ? size : len - offset), st_ok);
+        }
+        ST_CHECK_STATUS(st_tokenizer_finish(t), st_ok);
+    }
+
+    st_tokenizer_destroy(t);
+    return out.buf;
+}
+
+// A document in another encoding gives the tokens and UTF-8 offsets of the
+// document in UTF-8
+static void test_tokenizer(void)
+{
+    static const uint8_t utf8[] =
+        "<p class=\"caf\xc3\xa9\">\xe2\x82\xac 5 &amp; \xc3\xa5</p>\r\nend";
+    static const uint8_t windows_1252[] =
+        "<p class=\"caf\xe9\">\x80 5 &amp; \xe5</p>\r\nend";
+    uint16_t units[sizeof(utf8)];
+    uint8_t utf16le[2 * sizeof(utf8)];
+    size_t num = 0, len;
+    char *expected, *out;
+
+    for (size_t i = 0; i < sizeof(utf8) - 1; num++) {
+        uint32_t codepoint;
+
+        i += utf8_decode_valid(utf8 + i, &codepoint);
+        units[num] = (uint16_t)codepoint;
+    }
+    len = utf16(units, num, 0, utf16le);
+
+    expected = tokenize(st_encoding_utf8, utf8, sizeof(utf8) - 1, 0);
+
+    for (size_t size = 0; size <= 7; size++) {
+        out = tokenize(st_encoding_windows_1252, windows_1252,
+                sizeof(windows_1252) - 1, size);
+        ST_CHECK_STR(out, expected);
+        free(out);
+
+        out = tokenize(st_encoding_utf16le, utf16le, len, size);
+        ST_CHECK_STR(out, expected);
+        free(out);
+    }
+
+    free(expected);
+}
+
+int main(void)
+{
+    test_single_byte();
+    test_utf16();
+    test_utf8();
+    test_tokenizer();
+
+    return st_test_failures != 0;
+}
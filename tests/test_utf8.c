@@ -0,0 +1,137 @@
+// UTF-8 validation, in blocks and by the tokenizer
+#include "test.h"
+
+#include <string.h>
+
+#include "utf8.h"
+
+// Validate one codepoint at a time, the way the blocks must agree with
+static st_status validate_slow(const uint8_t *in, size_t len, size_t *valid)
+{
+    size_t i = 0, bytes;
+    uint32_t codepoint;
+    st_status rc;
+
+    while (i < len) {
+        if ((rc = utf8_next_codepoint(in + i, len - i, &codepoint,
+                        &bytes)) != st_ok) {
+            *valid = i;
+            return rc;
+        }
+        i += bytes;
+    }
+
+    *valid = len;
+    return st_ok;
+}
+
+static void check_validate(const uint8_t *in, size_t len,
+        st_status expected, size_t expected_valid)
+{
+    size_t valid = (size_t)-1;
+
+    ST_CHECK_STATUS(utf8_validate(in, len, &valid), expected);
+    ST_CHECK(valid == expected_valid);
+}
+
+static void test_sequences(void)
+{
+    const uint8_t ascii[] = "plain <b>ascii</b>";
+    const uint8_t multi[] = "\xc3\xa5 \xe2\x82\xac \xf0\x9f\x98\x80";
+
+    check_validate(ascii, sizeof(ascii) - 1, st_ok, sizeof(ascii) - 1);
+    check_validate(multi, sizeof(multi) - 1, st_ok, sizeof(multi) - 1);
+    check_validate(ascii, 0, st_ok, 0);
+
+    // Overlong forms, surrogates, codepoints above U+10FFFF, and bytes that
+    // never occur
+    check_validate((const uint8_t *)"a\xc0\x80", 3, st_utf8_invalid, 1);
+    check_validate((const uint8_t *)"a\xe0\x80\x80", 4, st_utf8_invalid, 1);
+    check_validate((const uint8_t *)"a\xed\xa0\x80", 4, st_utf8_invalid, 1);
+    check_validate((const uint8_t *)"a\xf4\x90\x80\x80", 5,
+            st_utf8_invalid, 1);
+    check_validate((const uint8_t *)"ab\xf5", 3, st_utf8_invalid, 2);
+    check_validate((const uint8_t *)"ab\x80", 3, st_utf8_invalid, 2);
+    check_validate((const uint8_t *)"ab\xff", 3, st_utf8_invalid, 2);
+
+    // A sequence that the input ends in the middle of
+    check_validate((const uint8_t *)"ab\xe2\x82", 4, st_eof, 2);
+    check_validate((const uint8_t *)"ab\xf0", 3, st_eof, 2);
+
+    // A cut sequence that is already wrong is invalid
+    check_validate((const uint8_t *)"ab\xe2\x41", 4, st_utf8_invalid, 2);
+}
+
+// Compare blocks with the slow validation on every length and position of
+// a bad byte, so that each lands at every place in a vector and in the tail
+static void test_blocks(void)
+{
+    static const char *const pieces[] = {
+        "a", "<p>", "\xc3\xa5", "\xe2\x82\xac", "\xf0\x9f\x98\x80",
+        "\xed\x9f\xbf", "\xef\xbf\xbd", "\xf4\x8f\xbf\xbf",
+    };
+    static const uint8_t bad[] = { 0x80, 0xc0, 0xe0, 0xed, 0xf4, 0xff };
+    uint8_t buf[160];
+    size_t len = 0, n = 0;
+
+    while (len < sizeof(buf) - 4) {
+        const char *piece = pieces[n++ % (sizeof(pieces) / sizeof(*pieces))];
+        memcpy(buf + len, piece, strlen(piece));
+        len += strlen(piece);
+    }
+
+    for (size_t end = 0; end <= len; end++) {
+        size_t expected_valid, valid;
+        st_status expected = validate_slow(buf, end, &expected_valid);
+
+        ST_CHECK_STATUS(utf8_validate(buf, end, &valid), expected);
+        ST_CHECK(valid == expected_valid);
+    }
+
+    for (size_t pos = 0; pos < len; pos++) {
+        for (size_t b = 0; b < sizeof(bad); b++) {
+            uint8_t copy[sizeof(buf)];
+            size_t expected_valid, valid;
+
+            memcpy(copy, buf, len);
+            copy[pos] = bad[b];
+
+            st_status expected = validate_slow(copy, len, &expected_valid);
+
+            ST_CHECK_STATUS(utf8_validate(copy, len, &valid), expected);
+            ST_CHECK(valid == expected_valid);
+        }
+    }
+}
+
+// The tokenizer stops at the first invalid byte, after the text before it
+static void test_tokenizer(void)
+{
+    const uint8_t valid[] = "<p>\xc3\xa5\xe2\x82\xac</p>";
+    st_status rc;
+    char *out;
+
+    out = st_test_tokenize(valid, sizeof(valid) - 1, &rc);
+    ST_CHECK_STATUS(rc, st_ok);
+    ST_CHECK_STR(out, "S<p>\nT[\xc3\xa5\xe2\x82\xac]\nE<p>\nEND\n");
+    free(out);
+
+    out = st_test_tokenize((const uint8_t *)"ab\xff" "cd<p>", 8, &rc);
+    ST_CHECK_STATUS(rc, st_utf8_invalid);
+    ST_CHECK_STR(out, "T[ab]\n");
+    free(out);
+
+    out = st_test_tokenize((const uint8_t *)"ab\xe2\x82", 4, &rc);
+    ST_CHECK_STATUS(rc, st_utf8_invalid);
+    ST_CHECK_STR(out, "T[ab]\n");
+    free(out);
+}
+
+int main(void)
+{
+    test_sequences();
+    test_blocks();
+    test_tokenizer();
+
+    return st_test_failures != 0;
+}
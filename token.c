@@ -3,10 +3,11 @@
 #include <string.h>
 #include <assert.h>
 
-#include "buffer.h"
+#include "arena.h"
 #include "utf8.h"
 
-#define STRLEN 10
+// Size of the blocks in the arena token storage is allocated from
+#define ST_TOKEN_ARENA_BLOCK 4096
 
 //
 // Token types
@@ -16,31 +17,69 @@
 typedef struct {
     uint32_t codepoint;
     const char *message;
-    uint32_t line;
-    uint32_t column;
+    size_t offset;                  // Byte offset of the character
 } st_token_error_t;
 
 // Charachter token type
 typedef struct {
     uint32_t codepoint;
+    uint8_t bytes[4];               // The codepoint encoded as UTF-8
+    size_t len;                     // Number of encoded bytes, 0 until used
 } st_token_character_t;
 
+// Byte offsets of a piece of the input, from its first byte to just past its
+// last
+typedef struct {
+    size_t start;
+    size_t end;
+} st_token_span_t;
+
+// Offsets of a piece of a tag from the start of its name, which keeps
+// attributes small
+typedef struct {
+    uint32_t start;
+    uint32_t end;
+} st_token_tag_span_t;
+
+// Text token type, a run of characters borrowed from the input
+typedef struct {
+    const uint8_t *ptr;
+    size_t len;
+} st_token_text_t;
+
+// A growable UTF-8 string allocated from the token arena
+typedef struct {
+    uint8_t *ptr;
+    size_t len;                     // Length of the string in bytes
+    size_t allocated;               // Number of bytes allocated
+} st_token_string_t;
+
 // Tag token attribute
 typedef struct {
-    st_buffer_t *name;
-    size_t name_len;
-    st_buffer_t *value;
-    size_t value_len;
+    st_token_string_t name;         // The attribute name as UTF-8
+    st_token_string_t value;        // The attribute value as UTF-8
+    uint32_t hash;                  // Hash of the name, see atom.h
+    st_atom_t atom;                 // Atom of the name, once it is complete
+    st_token_tag_span_t name_span;  // Source of the name and the value
+    st_token_tag_span_t value_span;
 } st_token_attribute_t;
 
 // Tag token
 typedef struct {
-    st_buffer_t *name;              // The tag name
-    size_t len;                     // Current length of the tag name
-    size_t allocated_bytes;         // Number of bytes allocated to the name
+    st_token_string_t name;         // The tag name as UTF-8
+    uint32_t hash;                  // Hash of the name, see atom.h
+    st_atom_t atom;                 // Atom of the name, once it is complete
+    st_token_span_t name_span;      // Source of the name
 
-    st_buffer_t *attrs;
+    st_token_attribute_t *attrs;    // Attributes, allocated from the arena
     size_t num_attrs;
+    size_t allocated_attrs;
+
+    uint32_t *index;                // Hash table of attribute numbers + 1 by
+                                    // name hash, for attributes with a
+                                    // complete name
+    size_t index_size;              // Number of slots, a power of two
+    size_t index_used;              // Number of attributes in the index
 } st_token_tag_t;
 
 //
@@ -50,30 +89,71 @@ typedef struct {
 // Structure for tokens
 struct st_token {
     st_token_type_t type;
+    st_arena_t *arena;              // All storage for the token comes from
+                                    // here and is released on reset
+    st_token_span_t span;           // Source of the whole token
     union {
         st_token_error_t error;
         st_token_character_t character;
+        st_token_text_t text;
         st_token_tag_t tag;
     };
 };
 
-st_status st_token_init(st_token_t **token)
+st_status st_token_init(st_token_t **token, const st_allocator_t *allocator)
 {
+    allocator = st_allocator(allocator);
+
     // Allocate memory
-    *token = malloc(sizeof(**token));
-    if (token == NULL)
+    *token = st_malloc(allocator, sizeof(**token));
+    if (*token == NULL)
         return st_out_of_memory;
 
     // Set entire struct to zero
     memset(*token, 0, sizeof(**token));
 
+    st_status rc = st_arena_init(&(*token)->arena, ST_TOKEN_ARENA_BLOCK,
+            allocator);
+    if (rc != st_ok) {
+        st_free(allocator, *token);
+        *token = NULL;
+        return rc;
+    }
+
     return st_ok;
 }
 
+void st_token_free(st_token_t *token)
+{
+    if (token == NULL)
+        return;
+
+    // The token itself comes from the allocator of its arena
+    st_allocator_t allocator = *st_arena_allocator(token->arena);
+
+    st_arena_free(token->arena);
+    st_free(&allocator, token);
+}
+
 st_status st_token_reset(st_token_t *token)
 {
-    // TODO: Clean up buffers, this is currently a memory leak
-    memset(token, 0, sizeof(*token));
+    // Release all storage of the token at once, the arena keeps its blocks
+    // for the next token
+    st_arena_reset(token->arena);
+
+    // Every type sets up all of its fields when the token is set to it, so
+    // only the type and the span are cleared
+    token->type = st_token_type_uninitialized;
+    token->span.start = 0;
+    token->span.end = 0;
+
+    return st_ok;
+}
+
+st_status st_token_set_span(st_token_t *token, size_t start, size_t end)
+{
+    token->span.start = start;
+    token->span.end = end;
 
     return st_ok;
 }
@@ -82,15 +162,14 @@ st_status st_token_reset(st_token_t *token)
 // Error token
 //
 st_status st_token_set_error(st_token_t *token, uint32_t codepoint,
-        const char *message, uint32_t line, uint32_t column)
+        const char *message, size_t offset)
 {
     assert(token->type == st_token_type_uninitialized);
 
     token->type = st_token_type_error;
     token->error.codepoint = codepoint;
     token->error.message = message;
-    token->error.line = line;
-    token->error.column = column;
+    token->error.offset = offset;
 
     return st_ok;
 }
@@ -101,6 +180,18 @@ st_status st_token_set_character(st_token_t *token, uint32_t codepoint)
 
     token->type = st_token_type_character;
     token->character.codepoint = codepoint;
+    token->character.len = 0;
+
+    return st_ok;
+}
+
+st_status st_token_set_text(st_token_t *token, const uint8_t *ptr, size_t len)
+{
+    assert(token->type == st_token_type_uninitialized);
+
+    token->type = st_token_type_text;
+    token->text.ptr = ptr;
+    token->text.len = len;
 
     return st_ok;
 }
@@ -109,25 +200,53 @@ st_status st_token_set_character(st_token_t *token, uint32_t codepoint)
 // Tag token
 //
 
-st_status st_token_set_tag(st_token_t *token, uint32_t codepoint)
+// Append UTF-8 bytes to a name or value. The string is grown in the arena,
+// which happens in place as long as it is the most recent allocation.
+static st_status st_token_append_bytes(st_token_t *token,
+        st_token_string_t *str, const uint8_t *bytes, size_t n)
 {
-    st_status rc;
+    if (str->len + n > str->allocated) {
+        size_t allocated = str->allocated == 0 ? 16 : str->allocated * 2;
 
-    // Initialize the tag name buffer
-    rc = st_buffer_init(&token->tag.name, 10 * sizeof(codepoint));
-    if (rc != st_ok)
-        return rc;
+        if (allocated < str->len + n)
+            allocated = str->len + n;
 
-    // Initialize the aattribute buffer
-    rc = st_buffer_init(&token->tag.attrs, 3 * sizeof(st_token_attribute_t));
-    if (rc != st_ok)
-        return rc;
+        st_status rc = st_arena_grow(token->arena, (void **)&str->ptr,
+                str->allocated, allocated);
+        if (rc != st_ok)
+            return rc;
+
+        str->allocated = allocated;
+    }
 
-    // Set initial tag name length
-    token->tag.len = 1;
+    memcpy(str->ptr + str->len, bytes, n);
+    str->len += n;
 
-    // Add the first character to the buffer
-    return st_buffer_append(&token->tag.name, &codepoint, sizeof(codepoint));
+    return st_ok;
+}
+
+// Append a codepoint to a name or value, encoded as UTF-8
+static st_status st_token_append_utf8(st_token_t *token,
+        st_token_string_t *str, uint32_t codepoint)
+{
+    uint8_t bytes[4];
+    size_t n = utf8_encode_codepoint(codepoint, bytes);
+
+    if (n == 0)
+        return st_invalid_unicode;
+
+    return st_token_append_bytes(token, str, bytes, n);
+}
+
+st_status st_token_set_tag(st_token_t *token, uint32_t codepoint)
+{
+    // The name and the attributes are allocated from the arena as they are
+    // appended to
+    memset(&token->tag, 0, sizeof(token->tag));
+
+    // Add the first character to the name
+    token->tag.hash = ST_ATOM_HASH_INIT;
+    return st_token_tag_append_name(token, codepoint);
 }
 
 st_status st_token_set_start_tag(st_token_t *token, uint32_t codepoint)
@@ -150,8 +269,39 @@ st_status st_token_set_end_tag(st_token_t *token, uint32_t codepoint)
 
 st_status st_token_tag_append_name(st_token_t *token, uint32_t codepoint)
 {
-    token->tag.len += 1;
-    return st_buffer_append(&token->tag.name, &codepoint, sizeof(codepoint));
+    uint8_t bytes[4];
+    size_t n = utf8_encode_codepoint(codepoint, bytes);
+
+    if (n == 0)
+        return st_invalid_unicode;
+
+    return st_token_tag_append_name_bytes(token, bytes, n);
+}
+
+st_status st_token_tag_append_name_bytes(st_token_t *token,
+        const uint8_t *bytes, size_t n)
+{
+    st_token_string_t *name = &token->tag.name;
+    size_t len = name->len;
+
+    st_status rc = st_token_append_bytes(token, name, bytes, n);
+    if (rc != st_ok)
+        return rc;
+
+    // Hash the name as it is built, so that looking up the atom is a single
+    // probe once it is complete
+    for (; len < name->len; len++)
+        token->tag.hash = ST_ATOM_HASH_UPDATE(token->tag.hash, name->ptr[len]);
+
+    return st_ok;
+}
+
+st_status st_token_tag_finish_name(st_token_t *token)
+{
+    token->tag.atom = st_atom_lookup_hash(token->tag.hash,
+            token->tag.name.ptr, token->tag.name.len);
+
+    return st_ok;
 }
 
 //
@@ -160,52 +310,215 @@ st_status st_token_tag_append_name(st_token_t *token, uint32_t codepoint)
 
 st_status st_token_attr_add(st_token_t *token)
 {
-    st_status rc;
+    st_token_tag_t *tag = &token->tag;
 
-    // Set up a new attribute
-    st_token_attribute_t attr;
+    // Grow the attribute array
+    if (tag->num_attrs == tag->allocated_attrs) {
+        size_t allocated = tag->allocated_attrs == 0 ?
+            4 : tag->allocated_attrs * 2;
 
-    // Initialize the tag name buffer
-    rc = st_buffer_init(&attr.name, 10 * sizeof(uint32_t));
-    if (rc != st_ok)
-        return rc;
+        st_status rc = st_arena_grow(token->arena, (void **)&tag->attrs,
+                tag->allocated_attrs * sizeof(st_token_attribute_t),
+                allocated * sizeof(st_token_attribute_t));
+        if (rc != st_ok)
+            return rc;
 
-    attr.name_len = 0;
+        tag->allocated_attrs = allocated;
+    }
+
+    // The name and value are allocated on their first append
+    memset(&tag->attrs[tag->num_attrs], 0, sizeof(st_token_attribute_t));
+    tag->attrs[tag->num_attrs].hash = ST_ATOM_HASH_INIT;
+    tag->num_attrs += 1;
+
+    return st_ok;
+}
+
+st_status st_token_attr_append_name(st_token_t *token, uint32_t codepoint)
+{
+    uint8_t bytes[4];
+    size_t n = utf8_encode_codepoint(codepoint, bytes);
 
-    // Initialize the aattribute buffer
-    rc = st_buffer_init(&attr.value, 10 * sizeof(uint32_t));
+    if (n == 0)
+        return st_invalid_unicode;
+
+    return st_token_attr_append_name_bytes(token, bytes, n);
+}
+
+st_status st_token_attr_append_name_bytes(st_token_t *token,
+        const uint8_t *bytes, size_t n)
+{
+    st_token_attribute_t *attr = &token->tag.attrs[token->tag.num_attrs - 1];
+    size_t len = attr->name.len;
+
+    st_status rc = st_token_append_bytes(token, &attr->name, bytes, n);
     if (rc != st_ok)
         return rc;
 
-    attr.value_len = 0;
+    for (; len < attr->name.len; len++)
+        attr->hash = ST_ATOM_HASH_UPDATE(attr->hash, attr->name.ptr[len]);
+
+    return st_ok;
+}
+
+// Insert an attribute into the index of the tag
+static void st_token_index_insert(st_token_tag_t *tag, size_t attr_num)
+{
+    size_t mask = tag->index_size - 1;
+    size_t slot = tag->attrs[attr_num].hash & mask;
+
+    while (tag->index[slot] != 0)
+        slot = (slot + 1) & mask;
+
+    tag->index[slot] = attr_num + 1;
+    tag->index_used += 1;
+}
+
+// Find the first attribute with a hash in the index that matches
+static st_status st_token_index_find(st_token_tag_t *tag, uint32_t hash,
+        st_atom_t atom, const uint8_t *name, size_t len, size_t *attr_num)
+{
+    if (tag->index_size == 0)
+        return st_not_found;
+
+    size_t mask = tag->index_size - 1;
+
+    // Probe until an empty slot, the index is never full
+    for (size_t slot = hash & mask; tag->index[slot] != 0;
+            slot = (slot + 1) & mask) {
+        st_token_attribute_t *attr = &tag->attrs[tag->index[slot] - 1];
+
+        if (attr->hash != hash)
+            continue;
 
-    // Write the token to the buffer
-    st_buffer_append(&token->tag.attrs, &attr, sizeof(attr));
-    token->tag.num_attrs += 1;
+        // Known names compare by atom, others by name
+        if (atom != st_atom_unknown ? attr->atom == atom :
+                (attr->name.len == len &&
+                 memcmp(attr->name.ptr, name, len) == 0)) {
+            *attr_num = tag->index[slot] - 1;
+            return st_ok;
+        }
+    }
+
+    return st_not_found;
+}
+
+st_status st_token_tag_set_name_span(st_token_t *token,
+        size_t start, size_t end)
+{
+    assert(token->type == st_token_type_start_tag ||
+            token->type == st_token_type_end_tag);
+
+    token->tag.name_span.start = start;
+    token->tag.name_span.end = end;
 
     return st_ok;
 }
 
-st_status st_token_attr_append_name(st_token_t *token, uint32_t codepoint)
+// Make a span relative to the start of the tag name
+static st_status st_token_tag_span(st_token_t *token, size_t start, size_t end,
+        st_token_tag_span_t *span)
+{
+    size_t base = token->tag.name_span.start;
+
+    assert(start >= base && end >= start);
+
+    if (end - base > UINT32_MAX)
+        return st_err;
+
+    span->start = start - base;
+    span->end = end - base;
+
+    return st_ok;
+}
+
+st_status st_token_attr_set_name_span(st_token_t *token,
+        size_t start, size_t end)
+{
+    assert(token->tag.num_attrs > 0);
+
+    st_token_attribute_t *attr = &token->tag.attrs[token->tag.num_attrs - 1];
+
+    // Until there is a value, it is empty at the end of the name
+    if (st_token_tag_span(token, start, end, &attr->name_span) != st_ok)
+        return st_err;
+
+    attr->value_span.start = attr->name_span.end;
+    attr->value_span.end = attr->name_span.end;
+
+    return st_ok;
+}
+
+st_status st_token_attr_set_value_span(st_token_t *token,
+        size_t start, size_t end)
+{
+    assert(token->tag.num_attrs > 0);
+
+    st_token_attribute_t *attr = &token->tag.attrs[token->tag.num_attrs - 1];
+
+    return st_token_tag_span(token, start, end, &attr->value_span);
+}
+
+st_status st_token_attr_finish_name(st_token_t *token)
 {
-    int attr_offset = (token->tag.num_attrs - 1) * sizeof(st_token_attribute_t);
-    st_token_attribute_t *attr =
-        st_buffer_offset_pointer(token->tag.attrs, attr_offset);
+    st_token_tag_t *tag = &token->tag;
+    size_t attr_num = tag->num_attrs - 1;
+    st_token_attribute_t *attr = &tag->attrs[attr_num];
+    size_t found;
+
+    attr->atom = st_atom_lookup_hash(attr->hash, attr->name.ptr,
+            attr->name.len);
+
+    // Only the first of several attributes with the same name is indexed
+    if (st_token_index_find(tag, attr->hash, attr->atom, attr->name.ptr,
+                attr->name.len, &found) == st_ok) {
+        return st_ok;
+    }
+
+    // Keep the index at most half full, and rebuild it in a larger table
+    // when it is not
+    if (2 * (tag->index_used + 1) > tag->index_size) {
+        size_t size = tag->index_size == 0 ? 16 : tag->index_size * 2;
+        void *index;
+
+        st_status rc = st_arena_alloc(token->arena,
+                size * sizeof(*tag->index), &index);
+        if (rc != st_ok)
+            return rc;
 
-    attr->name_len += 1;
+        memset(index, 0, size * sizeof(*tag->index));
 
-    return st_buffer_append(&attr->name, &codepoint, sizeof(codepoint));
+        uint32_t *old = tag->index;
+        size_t old_size = tag->index_size;
+
+        tag->index = index;
+        tag->index_size = size;
+        tag->index_used = 0;
+
+        for (size_t i = 0; i < old_size; i++) {
+            if (old[i] != 0)
+                st_token_index_insert(tag, old[i] - 1);
+        }
+    }
+
+    st_token_index_insert(tag, attr_num);
+
+    return st_ok;
 }
 
 st_status st_token_attr_append_value(st_token_t *token, uint32_t codepoint)
 {
-    int attr_offset = (token->tag.num_attrs - 1) * sizeof(st_token_attribute_t);
-    st_token_attribute_t *attr =
-        st_buffer_offset_pointer(token->tag.attrs, attr_offset);
+    st_token_attribute_t *attr = &token->tag.attrs[token->tag.num_attrs - 1];
+
+    return st_token_append_utf8(token, &attr->value, codepoint);
+}
 
-    attr->value_len += 1;
+st_status st_token_attr_append_value_bytes(st_token_t *token,
+        const uint8_t *bytes, size_t n)
+{
+    st_token_attribute_t *attr = &token->tag.attrs[token->tag.num_attrs - 1];
 
-    return st_buffer_append(&attr->value, &codepoint, sizeof(codepoint));
+    return st_token_append_bytes(token, &attr->value, bytes, n);
 }
 
 //
@@ -224,16 +537,146 @@ uint32_t st_token_codepoint(st_token_t *token)
     return token->character.codepoint;
 }
 
+const char *st_token_error_message(st_token_t *token)
+{
+    assert(token->type == st_token_type_error);
+
+    return token->error.message;
+}
+
+uint32_t st_token_error_codepoint(st_token_t *token)
+{
+    assert(token->type == st_token_type_error);
+
+    return token->error.codepoint;
+}
+
+size_t st_token_error_offset(st_token_t *token)
+{
+    assert(token->type == st_token_type_error);
+
+    return token->error.offset;
+}
+
+st_status st_token_text(st_token_t *token, const uint8_t **ptr, size_t *len)
+{
+    assert(token->type == st_token_type_text ||
+            token->type == st_token_type_character);
+
+    // Character tokens are encoded into the token on first use
+    if (token->type == st_token_type_character) {
+        if (token->character.len == 0) {
+            token->character.len = utf8_encode_codepoint(
+                    token->character.codepoint, token->character.bytes);
+            if (token->character.len == 0)
+                return st_invalid_unicode;
+        }
+
+        *ptr = token->character.bytes;
+        *len = token->character.len;
+
+        return st_ok;
+    }
+
+    *ptr = token->text.ptr;
+    *len = token->text.len;
+
+    return st_ok;
+}
+
+// Copy a name or value into a new NUL-terminated buffer
+static st_status st_token_copy(st_token_t *token, st_token_string_t *str,
+        uint8_t **buffer, size_t *bytes)
+{
+    *buffer = st_malloc(st_arena_allocator(token->arena), str->len + 1);
+    if (*buffer == NULL)
+        return st_out_of_memory;
+
+    if (str->len > 0)
+        memcpy(*buffer, str->ptr, str->len);
+    (*buffer)[str->len] = 0;
+    *bytes = str->len;
+
+    return st_ok;
+}
+
+// Get the attribute at an index
+static st_token_attribute_t *st_token_attr_get(st_token_t *token,
+        size_t attr_num)
+{
+    assert(token->type == st_token_type_start_tag ||
+            token->type == st_token_type_end_tag);
+    assert(attr_num < token->tag.num_attrs);
+
+    return &token->tag.attrs[attr_num];
+}
+
+void st_token_span(st_token_t *token, size_t *start, size_t *end)
+{
+    *start = token->span.start;
+    *end = token->span.end;
+}
+
+st_status st_token_tag_name_span(st_token_t *token,
+        size_t *start, size_t *end)
+{
+    assert(token->type == st_token_type_start_tag ||
+            token->type == st_token_type_end_tag);
+
+    *start = token->tag.name_span.start;
+    *end = token->tag.name_span.end;
+
+    return st_ok;
+}
+
+st_status st_token_attr_name_span(st_token_t *token,
+        size_t attr_num, size_t *start, size_t *end)
+{
+    st_token_attribute_t *attr = st_token_attr_get(token, attr_num);
+
+    *start = token->tag.name_span.start + attr->name_span.start;
+    *end = token->tag.name_span.start + attr->name_span.end;
+
+    return st_ok;
+}
+
+st_status st_token_attr_value_span(st_token_t *token,
+        size_t attr_num, size_t *start, size_t *end)
+{
+    st_token_attribute_t *attr = st_token_attr_get(token, attr_num);
+
+    *start = token->tag.name_span.start + attr->value_span.start;
+    *end = token->tag.name_span.start + attr->value_span.end;
+
+    return st_ok;
+}
+
+st_status st_token_tag_name_view(st_token_t *token,
+        const uint8_t **ptr, size_t *len)
+{
+    assert(token->type == st_token_type_start_tag ||
+            token->type == st_token_type_end_tag);
+
+    *ptr = token->tag.name.ptr;
+    *len = token->tag.name.len;
+
+    return st_ok;
+}
+
 st_status st_token_tag_name(st_token_t *token, uint8_t **buffer, size_t *bytes)
 {
     assert(token->type == st_token_type_start_tag ||
             token->type == st_token_type_end_tag);
 
-    // Get the pointer to the name
-    uint32_t *name = st_buffer_offset_pointer(token->tag.name, 0);
+    return st_token_copy(token, &token->tag.name, buffer, bytes);
+}
 
-    // Encode the tag to UTF-8
-    return utf8_encode_unicode(name, token->tag.len, buffer, bytes);
+st_atom_t st_token_tag_atom(st_token_t *token)
+{
+    assert(token->type == st_token_type_start_tag ||
+            token->type == st_token_type_end_tag);
+
+    return token->tag.atom;
 }
 
 size_t st_token_attr_num(st_token_t *token)
@@ -244,36 +687,72 @@ size_t st_token_attr_num(st_token_t *token)
     return token->tag.num_attrs;
 }
 
-st_status st_token_attr_name(st_token_t *token,
-        size_t attr_num, uint8_t **buffer, size_t *bytes)
+st_atom_t st_token_attr_atom(st_token_t *token, size_t attr_num)
+{
+    return st_token_attr_get(token, attr_num)->atom;
+}
+
+st_status st_token_attr_find(st_token_t *token, st_atom_t atom,
+        size_t *attr_num)
 {
     assert(token->type == st_token_type_start_tag ||
             token->type == st_token_type_end_tag);
 
-    // Get the attribute
-    st_token_attribute_t *attr = st_buffer_offset_pointer(
-            token->tag.attrs, attr_num * sizeof(st_token_attribute_t));
-
-    // Get the pointer to the name
-    uint32_t *name = st_buffer_offset_pointer(attr->name, 0);
+    if (atom == st_atom_unknown)
+        return st_not_found;
 
-    // Encode the tag to UTF-8
-    return utf8_encode_unicode(name, attr->name_len, buffer, bytes);
+    return st_token_index_find(&token->tag, st_atom_hash(atom), atom,
+            NULL, 0, attr_num);
 }
 
-st_status st_token_attr_value(st_token_t *token,
-        size_t attr_num, uint8_t **buffer, size_t *bytes)
+st_status st_token_attr_find_name(st_token_t *token,
+        const uint8_t *name, size_t len, size_t *attr_num)
 {
     assert(token->type == st_token_type_start_tag ||
             token->type == st_token_type_end_tag);
 
-    // Get the attribute
-    st_token_attribute_t *attr = st_buffer_offset_pointer(
-            token->tag.attrs, attr_num * sizeof(st_token_attribute_t));
+    uint32_t hash = ST_ATOM_HASH_INIT;
+    for (size_t i = 0; i < len; i++)
+        hash = ST_ATOM_HASH_UPDATE(hash, name[i]);
+
+    return st_token_index_find(&token->tag, hash, st_atom_unknown,
+            name, len, attr_num);
+}
 
-    // Get the pointer to the value
-    uint32_t *value = st_buffer_offset_pointer(attr->value, 0);
+st_status st_token_attr_name_view(st_token_t *token,
+        size_t attr_num, const uint8_t **ptr, size_t *len)
+{
+    st_token_attribute_t *attr = st_token_attr_get(token, attr_num);
+
+    *ptr = attr->name.ptr;
+    *len = attr->name.len;
+
+    return st_ok;
+}
+
+st_status st_token_attr_value_view(st_token_t *token,
+        size_t attr_num, const uint8_t **ptr, size_t *len)
+{
+    st_token_attribute_t *attr = st_token_attr_get(token, attr_num);
+
+    *ptr = attr->value.ptr;
+    *len = attr->value.len;
+
+    return st_ok;
+}
+
+st_status st_token_attr_name(st_token_t *token,
+        size_t attr_num, uint8_t **buffer, size_t *bytes)
+{
+    st_token_attribute_t *attr = st_token_attr_get(token, attr_num);
+
+    return st_token_copy(token, &attr->name, buffer, bytes);
+}
+
+st_status st_token_attr_value(st_token_t *token,
+        size_t attr_num, uint8_t **buffer, size_t *bytes)
+{
+    st_token_attribute_t *attr = st_token_attr_get(token, attr_num);
 
-    // Encode the tag to UTF-8
-    return utf8_encode_unicode(value, attr->value_len, buffer, bytes);
+    return st_token_copy(token, &attr->value, buffer, bytes);
 }
@@ -2,6 +2,8 @@
 #define token_h
 
 #include "styre.h"
+#include "atom.h"
+#include "alloc.h"
 
 #include <stdlib.h>
 #include <stdint.h>
@@ -17,32 +19,72 @@ typedef enum {
     st_token_type_eof,
     st_token_type_start_tag,
     st_token_type_end_tag,
+    st_token_type_text,
 } st_token_type_t;
 
 //
 // Create and modity
 //
 
-// Create a new token
-st_status st_token_init(st_token_t **token);
+// Create a new token. All of its memory comes from allocator, or from libc
+// when it is NULL.
+st_status st_token_init(st_token_t **token, const st_allocator_t *allocator);
+void st_token_free(st_token_t *token);
+
+// Reset the token to uninitialized. All storage of the previous token is
+// released at once and reused for the next one.
 st_status st_token_reset(st_token_t *token);
 
-// Set token types
+// Set token types. The offset of an error is the byte offset of the
+// character it was found at.
 st_status st_token_set_error(st_token_t *token, uint32_t codepoint,
-        const char *message, uint32_t line, uint32_t column);
+        const char *message, size_t offset);
 st_status st_token_set_character(st_token_t *token, uint32_t codepoint);
+st_status st_token_set_text(st_token_t *token, const uint8_t *ptr, size_t len);
 st_status st_token_set_start_tag(st_token_t *token, uint32_t codepoint);
 st_status st_token_set_end_tag(st_token_t *token, uint32_t codepoint);
 
 
+// Set the byte offsets of the source of the token in the input, from its
+// first byte to just past its last
+st_status st_token_set_span(st_token_t *token, size_t start, size_t end);
+
+// Set the source of the name of a tag token, and of the name and the value
+// of its last attribute. The value of an attribute is an empty span at the
+// end of its name until it is set. Attributes are kept as offsets from the
+// start of the tag name, and st_err is returned for those that end more than
+// 4 GiB after it.
+st_status st_token_tag_set_name_span(st_token_t *token,
+        size_t start, size_t end);
+st_status st_token_attr_set_name_span(st_token_t *token,
+        size_t start, size_t end);
+st_status st_token_attr_set_value_span(st_token_t *token,
+        size_t start, size_t end);
+
 // Append to the name of a tag token
 st_status st_token_tag_append_name(st_token_t *token, uint32_t codepoint);
 
+// Resolve the atom of a complete tag name
+st_status st_token_tag_finish_name(st_token_t *token);
+
 // Add attributes and attribute values
 st_status st_token_attr_add(st_token_t *token);
 st_status st_token_attr_append_name(st_token_t *token, uint32_t codepoint);
 st_status st_token_attr_append_value(st_token_t *token, uint32_t codepoint);
 
+// Append bytes that are already UTF-8 to a name or value, without decoding
+// them. Names must already be lowercased.
+st_status st_token_tag_append_name_bytes(st_token_t *token,
+        const uint8_t *bytes, size_t n);
+st_status st_token_attr_append_name_bytes(st_token_t *token,
+        const uint8_t *bytes, size_t n);
+st_status st_token_attr_append_value_bytes(st_token_t *token,
+        const uint8_t *bytes, size_t n);
+
+// Resolve the atom of the complete name of the last attribute and add it to
+// the index used by st_token_attr_find
+st_status st_token_attr_finish_name(st_token_t *token);
+
 //
 // Get token information
 //
@@ -50,9 +92,71 @@ st_status st_token_attr_append_value(st_token_t *token, uint32_t codepoint);
 st_token_type_t st_token_type(st_token_t *token);
 uint32_t st_token_codepoint(st_token_t *token);
 
-st_status st_token_tag_name(st_token_t *token, uint8_t **buffer, size_t *bytes);
+// The message of an error token, the character it was found at, and the byte
+// offset of that character in the input. Only the offset is kept, the line
+// and column are worked out from it by st_tokenizer_position when they are
+// asked for.
+const char *st_token_error_message(st_token_t *token);
+uint32_t st_token_error_codepoint(st_token_t *token);
+size_t st_token_error_offset(st_token_t *token);
+
+// Get the UTF-8 bytes of a text or character token, without copying. The
+// bytes of a text token are borrowed from the buffer passed to
+// st_tokenizer_set_string, or from the current chunk of a custom input
+// handler, and stay valid for as long as that buffer does. The text of a
+// character reference is held by the tokenizer until the next token.
+// Character tokens are encoded into the token itself and are valid until it
+// is reset.
+st_status st_token_text(st_token_t *token, const uint8_t **ptr, size_t *len);
+
+// Byte offsets of the source of a token in the input, from its first byte to
+// just past its last, so that the input can be copied around a token as it
+// was written. Tags start at the '<' and end after the '>', and the text of a
+// character reference spans the reference as it was written. The LF of a
+// CR LF is in no token. Offsets count the bytes the tokenizer reads, which
+// for input converted by st_tokenizer_set_encoding are UTF-8.
+void st_token_span(st_token_t *token, size_t *start, size_t *end);
+
+// The source of a tag name and of the name and value of an attribute. Values
+// do not include their quotes, and may be written with character references
+// that their views have replaced. An attribute without a value has an empty
+// value span at the end of its name.
+st_status st_token_tag_name_span(st_token_t *token,
+        size_t *start, size_t *end);
+st_status st_token_attr_name_span(st_token_t *token,
+        size_t attr_num, size_t *start, size_t *end);
+st_status st_token_attr_value_span(st_token_t *token,
+        size_t attr_num, size_t *start, size_t *end);
+
+// Borrowed views of tag names and attributes. Names and values are stored as
+// UTF-8 and the views are valid until the token is reset. They are not
+// NUL-terminated.
+st_status st_token_tag_name_view(st_token_t *token,
+        const uint8_t **ptr, size_t *len);
+st_status st_token_attr_name_view(st_token_t *token,
+        size_t attr_num, const uint8_t **ptr, size_t *len);
+st_status st_token_attr_value_view(st_token_t *token,
+        size_t attr_num, const uint8_t **ptr, size_t *len);
+
+// The atom of a tag name, st_atom_unknown for names that are not a known
+// HTML element
+st_atom_t st_token_tag_atom(st_token_t *token);
 
 size_t st_token_attr_num(st_token_t *token);
+
+// The atom of an attribute name, st_atom_unknown for names without one
+st_atom_t st_token_attr_atom(st_token_t *token, size_t attr_num);
+
+// Find the first attribute with a name, by atom or by the lowercased UTF-8
+// name, in constant time. Returns st_not_found if there is none.
+st_status st_token_attr_find(st_token_t *token, st_atom_t atom,
+        size_t *attr_num);
+st_status st_token_attr_find_name(st_token_t *token,
+        const uint8_t *name, size_t len, size_t *attr_num);
+
+// Copies of tag names and attributes in new NUL-terminated buffers that the
+// caller must free with the allocator of the token
+st_status st_token_tag_name(st_token_t *token, uint8_t **buffer, size_t *bytes);
 st_status st_token_attr_name(st_token_t *token,
         size_t attr_num, uint8_t **buffer, size_t *bytes);
 st_status st_token_attr_value(st_token_t *token,
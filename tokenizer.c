@@ -1,18 +1,49 @@
+#define _POSIX_C_SOURCE 200809L
+
 #include "tokenizer.h"
 
 #include <string.h>
 #include <stdio.h>
+#include <stdint.h>
 #include <assert.h>
+#include <errno.h>
+#include <pthread.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 
 #include "utf8.h"
+#include "scan.h"
+#include "readahead.h"
+#include "transcode.h"
+#include "lines.h"
+#include "batch.h"
+#include "entity.h"
+#include "stats.h"
 
 //
 // Start adapted from Chromium (Blink)
 //
 
-#define BEGIN_STATE(state_name) case st_tokenizer_ ## state_name: state_name:
+#define BEGIN_STATE(state_name)                                                \
+    case st_tokenizer_ ## state_name: state_name: ST_UNUSED_LABEL;
 #define END_STATE() assert(0); break;
 
+// Dispatch on the state through a table of label addresses with compilers
+// that support it, and through the switch otherwise
+#if defined(__GNUC__) && !defined(ST_NO_COMPUTED_GOTO)
+#define ST_TOKENIZER_COMPUTED_GOTO
+#define STATE_LABEL(state_name) [st_tokenizer_ ## state_name] = &&state_name
+#endif
+
+// Not every state label is jumped to, in particular not with the switch
+#ifdef __GNUC__
+#define ST_UNUSED_LABEL __attribute__((unused))
+#else
+#define ST_UNUSED_LABEL
+#endif
+
 // We use this macro when the HTML5 spec says "reconsume the current input
 // character in the <mumble> state."
 #define RECONSUME_IN(state_name)                                               \
@@ -23,7 +54,7 @@
 // character ... and switch to the <mumble> state."
 #define SWITCH_TO(state_name)                                                  \
     t->state = st_tokenizer_ ## state_name;                                    \
-    if ((rc = st_tokenizer_next_codepoint(t)) != st_ok) {                      \
+    if ((rc = NEXT_CODEPOINT(t)) != st_ok) {                                   \
         return rc;                                                             \
     }                                                                          \
     goto state_name;
@@ -46,16 +77,29 @@
     EMIT_TOKEN();
 
 // Used when we reach an error. Takes an error message and calls the callback
-// method.
+// method. The error replaces any token that was being built. Only the offset
+// of the current character is kept, see st_tokenizer_position.
 #define EMIT_ERROR(message)                                                    \
-    if ((rc = st_token_set_error(token, t->codepoint, message, 0, 0))          \
-            != st_ok) {                                                        \
+    st_token_reset(token);                                                     \
+    if ((rc = st_token_set_error(token, st_tokenizer_codepoint(t), message,    \
+                    CURRENT_OFFSET())) != st_ok) {                             \
         return rc;                                                             \
     }                                                                          \
     return st_ok;
 
 #define OPEN_CHARACTER_TOKEN(code)                                             \
-    if ((rc = st_token_set_character(token, code)) == st_ok) {                 \
+    if ((rc = st_tokenizer_character_token(t, token, code)) == st_ok) {        \
+        return rc;                                                             \
+    }
+
+// Byte offset of the current character in the input
+#define CURRENT_OFFSET() (t->buf_o - t->codepoint_len)
+
+// The name ends before the current character
+#define FINISH_TAG_NAME()                                                      \
+    if ((rc = st_token_tag_finish_name(token)) != st_ok ||                     \
+            (rc = st_token_tag_set_name_span(token, t->span_start,             \
+                    CURRENT_OFFSET())) != st_ok) {                             \
         return rc;                                                             \
     }
 
@@ -64,15 +108,18 @@
         return rc;                                                             \
     }
 
+// The name starts with the current character
 #define OPEN_START_TAG_TOKEN(codepoint)                                        \
     if ((rc = st_token_set_start_tag(token, codepoint)) != st_ok) {            \
         return rc;                                                             \
-    }
+    }                                                                          \
+    t->span_start = CURRENT_OFFSET();
 
 #define OPEN_END_TAG_TOKEN(codepoint)                                          \
     if ((rc = st_token_set_end_tag(token, codepoint)) != st_ok) {              \
         return rc;                                                             \
-    }
+    }                                                                          \
+    t->span_start = CURRENT_OFFSET();
 
 #define APPEND_TO_ATTR_NAME(codepoint)                                         \
     if ((rc = st_token_attr_append_name(token, codepoint)) != st_ok) {         \
@@ -84,21 +131,267 @@
         return rc;                                                             \
     }
 
+// Append the current character. A non-ASCII character of UTF-8 input was
+// never decoded, and its bytes are copied as they are.
+#define APPEND_CURRENT(append, append_bytes)                                   \
+    if ((rc = t->codepoint >= 0x80 && BULK_TEXT ?                              \
+                append_bytes(token, t->codepoint_ptr, t->codepoint_len) :      \
+                append(token, t->codepoint)) != st_ok) {                       \
+        return rc;                                                             \
+    }
+
+#define APPEND_CURRENT_TO_TAG_TOKEN()                                          \
+    APPEND_CURRENT(st_token_tag_append_name, st_token_tag_append_name_bytes)
+
+#define APPEND_CURRENT_TO_ATTR_NAME()                                          \
+    APPEND_CURRENT(st_token_attr_append_name, st_token_attr_append_name_bytes)
+
+#define APPEND_CURRENT_TO_ATTR_VALUE()                                         \
+    APPEND_CURRENT(st_token_attr_append_value,                                 \
+            st_token_attr_append_value_bytes)
+
+// Append the run of bytes after the current character that the state passes
+// over, see st_tokenizer_byte_run, and move on to the first byte it has to
+// look at
+#define APPEND_RUN(append_bytes, run)                                          \
+    {                                                                          \
+        const uint8_t *run_ptr = t->buf;                                       \
+        size_t run_len = st_tokenizer_take_run(t, run);                        \
+                                                                               \
+        if (run_len > 0 &&                                                     \
+                (rc = append_bytes(token, run_ptr, run_len)) != st_ok) {       \
+            return rc;                                                         \
+        }                                                                      \
+    }
+
 
-#define OPEN_ATTR(codepoint)                                                   \
+#define FINISH_ATTR_NAME()                                                     \
+    if ((rc = st_token_attr_finish_name(token)) != st_ok ||                    \
+            (rc = st_token_attr_set_name_span(token, t->span_start,            \
+                    CURRENT_OFFSET())) != st_ok) {                             \
+        return rc;                                                             \
+    }
+
+#define OPEN_ATTR()                                                            \
     if ((rc = st_token_attr_add(token)) != st_ok) {                            \
         return rc;                                                             \
     }                                                                          \
-    APPEND_TO_ATTR_NAME(codepoint);
+    t->span_start = CURRENT_OFFSET();
+
+// A quoted value starts after the current character, the quote, and ends
+// before the closing one
+#define OPEN_ATTR_VALUE()                                                      \
+    t->span_start = t->buf_o;
+
+#define FINISH_ATTR_VALUE()                                                    \
+    if ((rc = st_token_attr_set_value_span(token, t->span_start,               \
+                    CURRENT_OFFSET())) != st_ok) {                             \
+        return rc;                                                             \
+    }
+
+// Start a character reference that goes back to a state when it is done.
+// The allowed character is the one that ends the attribute value, which does
+// not start a reference.
+#define OPEN_CHARACTER_REFERENCE(state_name, allowed)                          \
+    t->ref_return = st_tokenizer_ ## state_name;                               \
+    t->ref_allowed = allowed;                                                  \
+    t->ref_buf[0] = '&';                                                       \
+    t->ref_len = 1;
+
+// Replace the character reference with its text and go back to the state it
+// started in, where the current character, which is not part of the
+// reference, is reconsumed
+#define FINISH_REFERENCE_AND_RECONSUME()                                       \
+    if ((rc = st_tokenizer_reference(t, token, t->codepoint)) != st_ok) {      \
+        return rc;                                                             \
+    }                                                                          \
+    t->state = t->ref_return;                                                  \
+    if (st_token_type(token) == st_token_type_text) {                          \
+        t->reconsume = 1;                                                      \
+        EMIT_TOKEN();                                                          \
+    }                                                                          \
+    goto dispatch;
 
+// The same, when the reference ends with the current character or the
+// character after it has not been consumed
+#define FINISH_REFERENCE_AND_RESUME(next)                                      \
+    if ((rc = st_tokenizer_reference(t, token, next)) != st_ok) {              \
+        return rc;                                                             \
+    }                                                                          \
+    t->state = t->ref_return;                                                  \
+    if (st_token_type(token) == st_token_type_text) {                          \
+        EMIT_TOKEN();                                                          \
+    }                                                                          \
+    if ((rc = NEXT_CODEPOINT(t)) != st_ok) {                                   \
+        return rc;                                                             \
+    }                                                                          \
+    goto dispatch;
+
+
+// Counters of the instrumented build
+#ifdef ST_TOKENIZER_STATS
+#define COUNT_CODEPOINTS(n)                                                    \
+    t->stats.codepoints[t->state] += (n);
+#define COUNT_TOKEN(token)                                                     \
+    t->stats.tokens[st_token_type(token)]++;
+#define PAUSE_SAMPLING()                                                       \
+    st_stats_pause();
+#else
+#define COUNT_CODEPOINTS(n)
+#define COUNT_TOKEN(token)
+#define PAUSE_SAMPLING()
+#endif
+
+// Classes of bytes in st_tokenizer_byte_class
+#define ST_BYTE_WHITESPACE 0x01         // Tab, LF, FF and space
+#define ST_BYTE_UPPER 0x02              // A to Z
+#define ST_BYTE_LOWER 0x04              // a to z
+#define ST_BYTE_DIGIT 0x08              // 0 to 9
+#define ST_BYTE_HEX 0x10                // A to F and a to f
+#define ST_BYTE_LENGTH_SHIFT 6          // Length of the UTF-8 sequence the
+                                        // byte starts, less one, in the top
+                                        // two bits
+
+// Every character the state machine tells apart is ASCII, so it looks at
+// classes of bytes instead of comparing each character against ranges. Bytes
+// from 0x80 only carry the length of their sequence.
+static const uint8_t st_tokenizer_byte_class[256] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0x00
+    0x00, 0x01, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00,  // 0x08
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0x10
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0x18
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0x20
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0x28
+    0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,  // 0x30
+    0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0x38
+    0x00, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x02,  // 0x40
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,  // 0x48
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,  // 0x50
+    0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0x58
+    0x00, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x04,  // 0x60
+    0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,  // 0x68
+    0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,  // 0x70
+    0x04, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0x78
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0x80
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0x88
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0x90
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0x98
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0xa0
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0xa8
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0xb0
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0xb8
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,  // 0xc0
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,  // 0xc8
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,  // 0xd0
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,  // 0xd8
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,  // 0xe0
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,  // 0xe8
+    0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0,  // 0xf0
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0xf8
+};
 
-#define IS_WHITESPACE(c) (c== ' ' || c == 0x0A || c == 0x09 || c == 0x0C)
+// States that go through runs of bytes at once, in st_tokenizer_byte_run
+#define ST_RUN_TAG_NAME 0x01
+#define ST_RUN_ATTR_NAME 0x02
+#define ST_RUN_DOUBLE_QUOTED 0x04
+#define ST_RUN_SINGLE_QUOTED 0x08
+
+// The states above that each byte ends a run of. Everything that is not in
+// the run is left to the state: delimiters, NUL, uppercase letters that
+// are lowercased in names, and CR, which is normalized.
+static const uint8_t st_tokenizer_byte_run[256] = {
+    0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0x00
+    0x00, 0x03, 0x03, 0x00, 0x03, 0x0f, 0x00, 0x00,  // 0x08
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0x10
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0x18
+    0x03, 0x00, 0x06, 0x00, 0x00, 0x00, 0x0c, 0x0a,  // 0x20
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,  // 0x28
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0x30
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00,  // 0x38
+    0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,  // 0x40
+    0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,  // 0x48
+    0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,  // 0x50
+    0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0x58
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0x60
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0x68
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0x70
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0x78
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0x80
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0x88
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0x90
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0x98
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0xa0
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0xa8
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0xb0
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0xb8
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0xc0
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0xc8
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0xd0
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0xd8
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0xe0
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0xe8
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0xf0
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0xf8
+};
 
-#define IS_ASCII_LOWER(codepoint) (codepoint >= 'a' && codepoint <= 'z')
-#define IS_ASCII_UPPER(codepoint) (codepoint >= 'A' && codepoint <= 'Z')
-#define TO_ASCII_LOWER(codepoint) (codepoint - 0x20)
+#define ST_BYTE_CLASS(c) ((c) <= 0xFF ? st_tokenizer_byte_class[c] : 0)
+#define ST_BYTE_LENGTH(byte)                                                   \
+    ((st_tokenizer_byte_class[byte] >> ST_BYTE_LENGTH_SHIFT) + 1)
+
+#define IS_WHITESPACE(c) (ST_BYTE_CLASS(c) & ST_BYTE_WHITESPACE)
+
+#define IS_ASCII_LOWER(c) (ST_BYTE_CLASS(c) & ST_BYTE_LOWER)
+#define IS_ASCII_UPPER(c) (ST_BYTE_CLASS(c) & ST_BYTE_UPPER)
+#define TO_ASCII_LOWER(codepoint) (codepoint + 0x20)
+#define IS_ASCII_DIGIT(c) (ST_BYTE_CLASS(c) & ST_BYTE_DIGIT)
+#define IS_ASCII_HEX_DIGIT(c)                                                  \
+    (ST_BYTE_CLASS(c) & (ST_BYTE_DIGIT | ST_BYTE_HEX))
+#define IS_ASCII_ALPHANUMERIC(c)                                               \
+    (ST_BYTE_CLASS(c) & (ST_BYTE_DIGIT | ST_BYTE_LOWER | ST_BYTE_UPPER))
+
+// Inlined even where the compiler would rather not, for functions that are
+// specialized on a constant argument
+#if defined(__GNUC__)
+#define ST_ALWAYS_INLINE inline __attribute__((always_inline))
+#else
+#define ST_ALWAYS_INLINE inline
+#endif
 
 #define REPLACEMENT_CHARACTER 0xFFFD
+#define NO_CHARACTER UINT32_MAX
+
+//
+// File input
+//
+typedef struct {
+    int fd;                                 // File descriptor
+    int owns_fd;                            // If the fd is closed with the
+                                            // input
+    uint8_t *map;                           // Mapping of the whole file
+    size_t map_len;                         // Length of the mapping
+    st_readahead_t *readahead;              // Reader for files that can not
+                                            // be mapped
+} st_tokenizer_file_input_t;
+
+//
+// Input in another encoding than UTF-8
+//
+
+// Size of the blocks the input is converted to UTF-8 in
+#define ST_TOKENIZER_TRANSCODE_BLOCK 65536
+
+typedef struct {
+    st_transcoder_t *transcoder;            // Converts the input to UTF-8,
+                                            // NULL for UTF-8 input
+    uint8_t *block;                         // UTF-8 being tokenized
+    const uint8_t *raw;                     // Input that is left to convert
+    size_t raw_s;                           // Size of the input left
+    size_t raw_o;                           // Offset for the input function
+    st_tokenizer_input_cb raw_func;         // Gets more input to convert
+    void *raw_ctx;                          // Context of the input function
+    int raw_eof;                            // If the input function returned
+                                            // st_eof
+} st_tokenizer_transcode_input_t;
 
 //
 // The tokenizer state object
@@ -108,58 +401,290 @@ struct st_tokenizer {
 
     st_tokenizer_callbacks_t callbacks;     // Callbacks method to call
     void *ctx;                              // User context
+    st_allocator_t allocator;               // Allocator of all memory of the
+                                            // tokenizer
 
     st_tokenizer_next_codepoint_cb next_codepoint;  // Function to call to get
                                                     // the next codepoint.
     st_tokenizer_encode_string_cb encode_func;      // Function to encode a
                                                     // unicode string.
 
+    st_tokenizer_input_type_t input_type;   // Where the input comes from
     st_tokenizer_input_cb input_func;       // Pointer to the input function
     void *input_ctx;                        // Input context
-    uint32_t codepoint;                     // The current codepoint
+    st_tokenizer_file_input_t file;         // File input
+    st_tokenizer_transcode_input_t transcode;   // Conversion of the input
+
+    const uint8_t *doc;                     // Input that is in memory as a
+    size_t doc_len;                         // whole, or NULL
+    st_lines_t *lines;                      // Finds the lines of offsets in
+                                            // doc, created when first asked
+
+    st_token_t *token;                      // The token being built, kept
+                                            // across input chunks
+    int started;                            // If the document has started
+    int stopped;                            // If an error token ended the
+                                            // document, or st_tokenizer_next
+                                            // reached its end
+
+    st_token_batch_t *batch;                // Batch tokens are collected in
+    st_tokenizer_cb_batch batch_func;       // Called with each full batch
+
+    uint32_t codepoint;                     // The current character. With
+                                            // UTF-8 input, only the first
+                                            // byte of a non-ASCII one, see
+                                            // st_tokenizer_codepoint
     int reconsume;                          // If we should reconsume the last
                                             // codepoint
+    int skip_lf;                            // If the last codepoint was a CR
+                                            // and a following LF is dropped
+    int bulk_text;                          // If the input is decoded by
+                                            // the built-in UTF-8 decoder, so
+                                            // that text can be scanned byte
+                                            // by byte
+    const uint8_t *codepoint_ptr;           // Bytes of the current codepoint
+    size_t codepoint_len;                   // Number of bytes of the current
+                                            // codepoint
+
+    uint8_t carry[8];                       // Start of a codepoint that was
+    size_t carry_len;                       // cut by the end of the input
+                                            // chunk
+
+    size_t token_start;                     // Offset of the first character
+                                            // of the token being built
+    size_t span_start;                      // Offset of the start of the
+                                            // name or value being read
+
+    st_tokenizer_state_t ref_return;        // State a character reference
+                                            // goes back to
+    uint32_t ref_allowed;                   // Character that does not start
+                                            // a reference
+    uint8_t ref_buf[ST_ENTITY_MAX_LENGTH + 4];  // Bytes of the reference read
+    size_t ref_len;                             // so far, from the ampersand
+    uint32_t ref_node;                      // Position in the names of named
+    uint32_t ref_index;                     // references
+    uint32_t ref_match;                     // Longest name matched so far
+    size_t ref_match_len;                   // Bytes of ref_buf up to the end
+                                            // of the match, 0 for none
+    uint32_t ref_code;                      // Value of a numeric reference
+    uint8_t ref_text[ST_ENTITY_MAX_LENGTH + 16];    // UTF-8 text that replaces
+                                                    // the reference
+
+#ifdef ST_TOKENIZER_STATS
+    st_tokenizer_stats_t stats;             // Counters of what the tokenizer
+                                            // did
+#endif
 
     const uint8_t *buf;                     // Input buffer
     size_t buf_s;                           // Size of the input buffer
     size_t buf_o;                           // Current offset into the buffer
+    size_t buf_valid;                       // Bytes from buf that are known
+                                            // to be valid UTF-8
 };
 
-typedef struct {
-    FILE *file;                             // File hander
-} st_tokenizer_file_input_t;
-
 
 //
 // Helper methods to read input from the input stream
 //
 static st_status st_tokenizer_next_token(st_tokenizer_t *t, st_token_t *token);
+static st_status st_tokenizer_states_utf8(st_tokenizer_t *t,
+        st_token_t *token);
+static st_status st_tokenizer_states_generic(st_tokenizer_t *t,
+        st_token_t *token);
+static st_status st_tokenizer_next_codepoint_utf8(st_tokenizer_t *t);
 static st_status st_tokenizer_next_codepoint(st_tokenizer_t *t);
+static uint32_t st_tokenizer_codepoint(st_tokenizer_t *t);
+static size_t st_tokenizer_text_run(st_tokenizer_t *t);
+static inline size_t st_tokenizer_take_run(st_tokenizer_t *t, uint8_t run);
+static void st_tokenizer_validate(st_tokenizer_t *t);
+static void st_tokenizer_start_input(st_tokenizer_t *t);
+static inline void st_tokenizer_consume(st_tokenizer_t *t, size_t bytes);
+static st_status st_tokenizer_pump(st_tokenizer_t *t);
+static st_status st_tokenizer_feed_block(st_tokenizer_t *t,
+        const uint8_t *chunk, size_t len);
+static st_status st_tokenizer_end(st_tokenizer_t *t);
+static void st_tokenizer_file_close(st_tokenizer_t *t);
+static void st_tokenizer_new_document(st_tokenizer_t *t);
+static void st_tokenizer_set_document(st_tokenizer_t *t,
+        const uint8_t *doc, size_t len);
+static st_status st_tokenizer_emit(st_tokenizer_t *t, st_token_t *token);
+static void st_tokenizer_flush(st_tokenizer_t *t);
+static st_status st_tokenizer_character_token(st_tokenizer_t *t,
+        st_token_t *token, uint32_t codepoint);
+static st_status st_tokenizer_reference(st_tokenizer_t *t,
+        st_token_t *token, uint32_t next);
+static int st_tokenizer_pending_reference(st_tokenizer_t *t);
+static st_status st_tokenizer_end_reference(st_tokenizer_t *t);
 
 //
 // Initialize a new tokenizer
 //
+
+// Callbacks installed where none are set
+static void st_tokenizer_no_document(st_tokenizer_t *t, void *ctx)
+{
+}
+
+static void st_tokenizer_no_token(st_tokenizer_t *t, st_token_t *token,
+        void *ctx)
+{
+}
+
+static void st_tokenizer_no_error(st_tokenizer_t *t, const char *message,
+        void *ctx)
+{
+}
+
 int st_tokenizer_init(st_tokenizer_t **tokenizer,
-        st_tokenizer_callbacks_t *callbacks, void *ctx)
+        st_tokenizer_callbacks_t *callbacks, void *ctx,
+        const st_allocator_t *allocator)
 {
+    allocator = st_allocator(allocator);
+
     // Allocate memory
-    *tokenizer = malloc(sizeof(**tokenizer));
+    *tokenizer = st_malloc(allocator, sizeof(**tokenizer));
     if (*tokenizer == NULL)
         return -1;
 
     // All memory to zero
     memset(*tokenizer, 0, sizeof(**tokenizer));
+    (*tokenizer)->file.fd = -1;
+
+    // Set initial values, callbacks that are not set do nothing
+    if (callbacks != NULL)
+        (*tokenizer)->callbacks = *callbacks;
+    if ((*tokenizer)->callbacks.document_start == NULL)
+        (*tokenizer)->callbacks.document_start = &st_tokenizer_no_document;
+    if ((*tokenizer)->callbacks.document_end == NULL)
+        (*tokenizer)->callbacks.document_end = &st_tokenizer_no_document;
+    if ((*tokenizer)->callbacks.token == NULL)
+        (*tokenizer)->callbacks.token = &st_tokenizer_no_token;
+    if ((*tokenizer)->callbacks.error == NULL)
+        (*tokenizer)->callbacks.error = &st_tokenizer_no_error;
 
-    // Set initial values
-    (*tokenizer)->callbacks = *callbacks;
     (*tokenizer)->ctx = ctx;
+    (*tokenizer)->allocator = *allocator;
 
     (*tokenizer)->next_codepoint = &utf8_next_codepoint;
     (*tokenizer)->encode_func = &utf8_encode_unicode;
+    (*tokenizer)->bulk_text = 1;
 
     return 0;
 }
 
+void st_tokenizer_destroy(st_tokenizer_t *t)
+{
+    if (t == NULL)
+        return;
+
+    st_tokenizer_file_close(t);
+    st_token_free(t->token);
+
+    st_transcoder_free(t->transcode.transcoder);
+    st_free(&t->allocator, t->transcode.block);
+
+    st_lines_free(t->lines);
+
+    st_free(&t->allocator, t);
+}
+
+st_status st_tokenizer_stats(st_tokenizer_t *t, st_tokenizer_stats_t *stats)
+{
+#ifdef ST_TOKENIZER_STATS
+    *stats = t->stats;
+    return st_ok;
+#else
+    memset(stats, 0, sizeof(*stats));
+    return st_invalid_config;
+#endif
+}
+
+void st_tokenizer_stats_clear(st_tokenizer_t *t)
+{
+#ifdef ST_TOKENIZER_STATS
+    memset(&t->stats, 0, sizeof(t->stats));
+#endif
+}
+
+st_status st_tokenizer_reset(st_tokenizer_t *t)
+{
+    st_tokenizer_new_document(t);
+
+    t->input_type = st_tokenizer_uninitialized_input;
+    t->input_func = NULL;
+    t->input_ctx = NULL;
+
+    t->buf = NULL;
+    t->buf_s = 0;
+    t->buf_o = 0;
+    t->buf_valid = 0;
+
+    return st_ok;
+}
+
+void st_tokenizer_set_context(st_tokenizer_t *t, void *ctx)
+{
+    t->ctx = ctx;
+}
+
+const st_allocator_t *st_tokenizer_allocator(st_tokenizer_t *t)
+{
+    return &t->allocator;
+}
+
+// Forget the previous document when new input is set, so that a tokenizer
+// can be used for one document after another
+static void st_tokenizer_new_document(st_tokenizer_t *t)
+{
+    st_tokenizer_file_close(t);
+
+    t->state = st_tokenizer_data_state;
+    t->started = 0;
+    t->stopped = 0;
+    t->reconsume = 0;
+    t->skip_lf = 0;
+    t->carry_len = 0;
+    t->token_start = 0;
+
+    if (t->transcode.transcoder != NULL)
+        st_transcoder_reset(t->transcode.transcoder);
+
+    st_tokenizer_set_document(t, NULL, 0);
+
+    if (t->token != NULL)
+        st_token_reset(t->token);
+}
+
+// Set the input that is in memory as a whole, or none
+static void st_tokenizer_set_document(st_tokenizer_t *t,
+        const uint8_t *doc, size_t len)
+{
+    t->doc = doc;
+    t->doc_len = len;
+
+    if (t->lines != NULL)
+        st_lines_set(t->lines, doc, len);
+}
+
+st_status st_tokenizer_position(st_tokenizer_t *t, size_t offset,
+        size_t *line, size_t *column)
+{
+    st_status rc;
+
+    if (t->doc == NULL)
+        return st_not_found;
+
+    // Nothing is counted until the first time a position is asked for
+    if (t->lines == NULL) {
+        if ((rc = st_lines_init(&t->lines, &t->allocator)) != st_ok)
+            return rc;
+
+        st_lines_set(t->lines, t->doc, t->doc_len);
+    }
+
+    return st_lines_position(t->lines, offset, line, column);
+}
+
 st_status st_tokenizer_set_encoding_handler(st_tokenizer_t *t,
         st_tokenizer_next_codepoint_cb next_codepoint,
         st_tokenizer_encode_string_cb encode_func)
@@ -167,401 +692,1288 @@ st_status st_tokenizer_set_encoding_handler(st_tokenizer_t *t,
     t->next_codepoint = next_codepoint;
     t->encode_func = encode_func;
 
+    // Only UTF-8 input can be scanned for text runs without decoding
+    t->bulk_text = (next_codepoint == &utf8_next_codepoint);
+
+    // The handler decodes the input as it is
+    st_transcoder_free(t->transcode.transcoder);
+    t->transcode.transcoder = NULL;
+
+    return st_ok;
+}
+
+st_status st_tokenizer_set_encoding(st_tokenizer_t *t,
+        st_encoding_t encoding)
+{
+    st_transcoder_t *transcoder = NULL;
+    st_status rc;
+
+    if ((unsigned)encoding >= ST_ENCODING_COUNT)
+        return st_invalid_config;
+
+    if (encoding != st_encoding_utf8) {
+        if (t->transcode.block == NULL) {
+            t->transcode.block = st_malloc(&t->allocator,
+                    ST_TOKENIZER_TRANSCODE_BLOCK);
+            if (t->transcode.block == NULL)
+                return st_out_of_memory;
+        }
+
+        rc = st_transcoder_init(&transcoder, encoding, &t->allocator);
+        if (rc != st_ok)
+            return rc;
+    }
+
+    // The converted input is UTF-8
+    st_tokenizer_set_encoding_handler(t, &utf8_next_codepoint,
+            &utf8_encode_unicode);
+
+    t->transcode.transcoder = transcoder;
+
     return st_ok;
 }
 
 st_status st_tokenizer_set_input_handler(st_tokenizer_t *t,
         st_tokenizer_input_cb input_func, void *ctx)
 {
+    st_tokenizer_new_document(t);
+
+    t->buf = NULL;
+    t->buf_s = 0;
+    t->buf_o = 0;
+    t->buf_valid = 0;
+
+    t->input_type = st_tokenizer_callback_input;
     t->input_func = input_func;
     t->input_ctx = ctx;
 
+    st_tokenizer_start_input(t);
+
     return st_ok;
 }
 
-// Input callback function for the default string handler
+// Input callback function for the default string handler, and for input that
+// is pushed with st_tokenizer_feed. There is never more input to get.
 static st_status st_tokenizer_string_handler(const uint8_t **buffer,
         size_t *size, size_t *offset, void *ctx)
 {
     return st_eof;
 }
 
+// Input callback for input in another encoding than UTF-8. Converts the next
+// block of the input that was set, and hands out the UTF-8.
+static st_status st_tokenizer_transcode_handler(const uint8_t **buffer,
+        size_t *size, size_t *offset, void *ctx)
+{
+    st_tokenizer_t *t = ctx;
+    st_tokenizer_transcode_input_t *in = &t->transcode;
+    size_t used, written = 0;
+    st_status rc;
+
+    // Input that is all the start of a character converts to nothing
+    while (written == 0) {
+        if (in->raw_s > 0) {
+            st_transcode(in->transcoder, in->raw, in->raw_s, &used,
+                    in->block, ST_TOKENIZER_TRANSCODE_BLOCK, &written);
+            in->raw += used;
+            in->raw_s -= used;
+        } else if (in->raw_eof) {
+            st_transcode_finish(in->transcoder, in->block, &written);
+            if (written == 0)
+                return st_eof;
+        } else if ((rc = in->raw_func(&in->raw, &in->raw_s, &in->raw_o,
+                        in->raw_ctx)) == st_eof) {
+            in->raw_eof = 1;
+        } else if (rc != st_ok) {
+            return rc;
+        }
+    }
+
+    // The offset keeps counting the UTF-8
+    *buffer = in->block;
+    *size = written;
+
+    return st_ok;
+}
+
+// Start reading the input that was set. Input in another encoding than UTF-8
+// is read through the transcoder, and converted one block at a time.
+static void st_tokenizer_start_input(st_tokenizer_t *t)
+{
+    st_tokenizer_transcode_input_t *in = &t->transcode;
+
+    // Strings and mapped files are in memory as a whole, and offsets into
+    // them can be looked up, unless the offsets count converted bytes
+    if (in->transcoder == NULL
+            && t->input_func == &st_tokenizer_string_handler)
+        st_tokenizer_set_document(t, t->buf, t->buf_s);
+
+    if (in->transcoder != NULL) {
+        in->raw = t->buf;
+        in->raw_s = t->buf_s;
+        in->raw_o = 0;
+        in->raw_func = t->input_func;
+        in->raw_ctx = t->input_ctx;
+        in->raw_eof = 0;
+
+        t->input_func = &st_tokenizer_transcode_handler;
+        t->input_ctx = t;
+        t->buf = NULL;
+        t->buf_s = 0;
+
+        // Input in memory is converted up front, so that empty input is
+        // still seen as empty
+        if (in->raw_s > 0)
+            st_tokenizer_transcode_handler(&t->buf, &t->buf_s, &t->buf_o, t);
+    }
+
+    st_tokenizer_validate(t);
+}
+
 st_status st_tokenizer_set_string(st_tokenizer_t *t,
         const uint8_t *buf, size_t len)
 {
+    st_tokenizer_new_document(t);
+
     t->buf = buf;
     t->buf_s = len;
     t->buf_o = 0;
 
+    t->input_type = st_tokenizer_string_input;
     t->input_func = &st_tokenizer_string_handler;
     t->input_ctx = NULL;
 
+    st_tokenizer_start_input(t);
+
     return st_ok;
 }
 
-st_status st_tokenizer_run(st_tokenizer_t *t)
+st_status st_tokenizer_set_fd(st_tokenizer_t *t, int fd)
 {
-    if (t->buf == NULL)
-        return st_invalid_config;
+    struct stat st;
 
-    if (t->buf_s == 0)
-        return st_eof;
+    st_tokenizer_new_document(t);
 
-    if (t->input_func == NULL)
-        return st_invalid_config;
+    if (fstat(fd, &st) != 0)
+        return st_err;
 
-    st_status rc;
+    t->file.fd = fd;
 
-    // Initialize the token
-    st_token_t *token;
-    if ((rc = st_token_init(&token)) != st_ok) {
-        return rc;
-    }
+    t->buf = NULL;
+    t->buf_s = 0;
+    t->buf_o = 0;
+    t->buf_valid = 0;
 
-    assert(st_token_type(token) == st_token_type_uninitialized);
+    t->input_type = st_tokenizer_file_input;
+    t->input_ctx = NULL;
 
-    // Call start of document callback
-    t->callbacks.document_start(t, t->ctx);
+    // Regular files are mapped and tokenized in place. The mapping is read
+    // front to back once, so let the kernel read ahead aggressively.
+    if (S_ISREG(st.st_mode) && st.st_size > 0
+            && (uintmax_t)st.st_size <= SIZE_MAX) {
+        void *map = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
 
-    // Iterate through the input and emit tokens
-    while ((rc = st_tokenizer_next_token(t, token)) == st_ok) {
-        // Emit token
-        t->callbacks.token(t, token, t->ctx);
+        if (map != MAP_FAILED) {
+            posix_madvise(map, st.st_size, POSIX_MADV_SEQUENTIAL);
 
-        // Check if we got an error token
-        if (st_token_type(token) == st_token_type_error) {
-            break;
-        }
+            t->file.map = map;
+            t->file.map_len = st.st_size;
 
-        st_token_reset(token);
+            t->buf = t->file.map;
+            t->buf_s = t->file.map_len;
 
-        assert(st_token_type(token) == st_token_type_uninitialized);
+            t->input_func = &st_tokenizer_string_handler;
+
+            st_tokenizer_start_input(t);
+
+            return st_ok;
+        }
     }
 
-    // If we did not reach the end of the file
-    if (rc != st_eof) {
+    // Pipes, sockets, and files that can not be mapped are read in chunks,
+    // with the next chunk read in the background
+    st_status rc = st_readahead_init(&t->file.readahead, fd, 0,
+            &t->allocator);
+    if (rc != st_ok) {
+        t->file.fd = -1;
         return rc;
     }
 
-    // Call end of document callback
-    t->callbacks.document_end(t, t->ctx);
+    t->input_func = &st_readahead_input;
+    t->input_ctx = t->file.readahead;
+
+    st_tokenizer_start_input(t);
 
     return st_ok;
 }
 
-static st_status st_tokenizer_next_token(st_tokenizer_t *t, st_token_t *token) {
-    // Status code from function calls
+st_status st_tokenizer_set_file(st_tokenizer_t *t, const char *path)
+{
     st_status rc;
+    int fd;
+
+    do {
+        fd = open(path, O_RDONLY);
+    } while (fd < 0 && errno == EINTR);
 
-    // Ignore unused labels created by the macros
-#pragma clang diagnostic push
-#pragma clang diagnostic ignored "-Wunused-label"
+    if (fd < 0)
+        return st_err;
 
-    if (!t->reconsume && (rc = st_tokenizer_next_codepoint(t)) != st_ok) {
+    if ((rc = st_tokenizer_set_fd(t, fd)) != st_ok) {
+        close(fd);
         return rc;
     }
 
-    switch(t->state) {
+    t->file.owns_fd = 1;
 
-        BEGIN_STATE(data_state) {
-            switch(t->codepoint) {
-                case '&':
-                    SWITCH_TO(character_reference_in_data_state);
-                case '<':
-                    SWITCH_TO(tag_open_state);
-                case 0:
-                    EMIT_ERROR("Reached \\0-character.");
-                default:
-                    OPEN_CHARACTER_TOKEN(t->codepoint);
-                    EMIT_TOKEN();
-            }
-        }
-        END_STATE()
+    return st_ok;
+}
 
+// Release the mapping or read buffer of file input
+static void st_tokenizer_file_close(st_tokenizer_t *t)
+{
+    st_tokenizer_file_input_t *file = &t->file;
 
-        BEGIN_STATE(character_reference_in_data_state) {
-            EMIT_ERROR("Unsupported: Character reference in data state");
-        }
-        END_STATE();
-
-
-        BEGIN_STATE(rcdata_state) {
-            switch(t->codepoint) {
-                case '&':
-                    SWITCH_TO(character_reference_in_rcdata_state);
-                case '<':
-                    SWITCH_TO(rcdata_less_than_sign_state);
-                case 0:
-                    EMIT_ERROR("Reached \\0-character.");
-                default:
-                    OPEN_CHARACTER_TOKEN(t->codepoint);
-                    EMIT_TOKEN();
-            }
-        }
-        END_STATE();
+    if (file->fd < 0)
+        return;
 
-        BEGIN_STATE(character_reference_in_rcdata_state) {
-            EMIT_ERROR("Unsupported: Character reference in RCDATA state");
-        }
-        END_STATE();
+    if (file->map != NULL)
+        munmap(file->map, file->map_len);
 
-        BEGIN_STATE(rawtext_state) {
-            EMIT_ERROR("Unsupported: Rawtext state");
-        }
-        END_STATE();
+    st_readahead_free(file->readahead);
 
-        BEGIN_STATE(script_data_state) {
-            EMIT_ERROR("Unsupported: Script data state");
-        }
-        END_STATE();
+    if (file->owns_fd)
+        close(file->fd);
 
-        BEGIN_STATE(plaintext_state) {
-            EMIT_ERROR("Unsupported: Plain text state");
-        }
-        END_STATE();
-
-        BEGIN_STATE(tag_open_state) {
-            if (t->codepoint == '!') {
-                SWITCH_TO(markup_declaration_open_state);
-            } else if (t->codepoint == '/') {
-                SWITCH_TO(end_tag_open_state);
-            } else if (IS_ASCII_UPPER(t->codepoint)) {
-                OPEN_START_TAG_TOKEN(TO_ASCII_LOWER(t->codepoint));
-                SWITCH_TO(tag_name_state);
-            } else if (IS_ASCII_LOWER(t->codepoint)) {
-                OPEN_START_TAG_TOKEN(t->codepoint);
-                SWITCH_TO(tag_name_state);
-            } else if (t->codepoint == '?') {
-                EMIT_ERROR("Parse error: invalid token ?");
-            } else {
-                EMIT_ERROR("Parse error: reached invalid token");
-            }
-        }
-        END_STATE();
-
-        BEGIN_STATE(end_tag_open_state) {
-            if (IS_ASCII_UPPER(t->codepoint)) {
-                OPEN_END_TAG_TOKEN(TO_ASCII_LOWER(t->codepoint));
-                SWITCH_TO(tag_name_state);
-            } else if (IS_ASCII_LOWER(t->codepoint)) {
-                OPEN_END_TAG_TOKEN(t->codepoint);
-                SWITCH_TO(tag_name_state);
-            } else if (t->codepoint == '>') {
-                EMIT_ERROR("Parse error: Empty end tag.");
-            } else {
-                EMIT_ERROR("Parse error: Invalid end tag.");
-            }
-        }
-        END_STATE();
-
-        BEGIN_STATE(tag_name_state) {
-            if (IS_WHITESPACE(t->codepoint)) {
-                SWITCH_TO(before_attribute_name_state);
-            } else if (t->codepoint == '/') {
-                SWITCH_TO(self_closing_start_tag_state);
-            } else if (t->codepoint == '>') {
-                EMIT_AND_RESUME_IN(data_state);
-            } else if (IS_ASCII_UPPER(t->codepoint)) {
-                APPEND_TO_TAG_TOKEN(TO_ASCII_LOWER(t->codepoint));
-                SWITCH_TO(tag_name_state);
-            } else if (t->codepoint == 0) {
-                EMIT_ERROR("Reached \\0 charachter");
-            } else {
-                APPEND_TO_TAG_TOKEN(t->codepoint);
-                SWITCH_TO(tag_name_state);
-            }
-        }
-        END_STATE();
-
-        BEGIN_STATE(rcdata_less_than_sign_state) {
-            switch(t->codepoint) {
-                case '/':
-                    SWITCH_TO(rcdata_end_tag_open_state);
-                default:
-                    OPEN_CHARACTER_TOKEN('<');
-                    EMIT_AND_RECONSUME_IN(rcdata_state);
-            }
-        }
-        END_STATE();
+    memset(file, 0, sizeof(*file));
+    file->fd = -1;
 
-        BEGIN_STATE(rcdata_end_tag_open_state) {
-            EMIT_ERROR("Unsupported: RCDATA end tag open state");
-        }
-        END_STATE();
-
-        // TODO
-
-        BEGIN_STATE(before_attribute_name_state) {
-            if (IS_WHITESPACE(t->codepoint)) {
-                SWITCH_TO(before_attribute_name_state);
-            } else if (t->codepoint == '/') {
-                SWITCH_TO(self_closing_start_tag_state);
-            } else if (t->codepoint == '>') {
-                EMIT_AND_RESUME_IN(data_state);
-            } else if (IS_ASCII_UPPER(t->codepoint)) {
-                OPEN_ATTR(TO_ASCII_LOWER(t->codepoint));
-                SWITCH_TO(attribute_name_state);
-            } else if (t->codepoint == 0) {
-                EMIT_ERROR("Reached \\0-charachter.");
-            } else if (t->codepoint == '"' || t->codepoint == '<' ||
-                    t->codepoint == '\'' || t->codepoint == '=') {
-                EMIT_ERROR("Invalid start of token name");
-            } else {
-                OPEN_ATTR(t->codepoint);
-                SWITCH_TO(attribute_name_state);
-            }
-        }
-        END_STATE();
-
-        BEGIN_STATE(attribute_name_state) {
-            if (IS_WHITESPACE(t->codepoint)) {
-                SWITCH_TO(after_attribute_name_state);
-            } else if (t->codepoint == '/') {
-                SWITCH_TO(self_closing_start_tag_state);
-            } else if (t->codepoint == '=') {
-                SWITCH_TO(before_attribute_value_state);
-            } else if (t->codepoint == '>') {
-                EMIT_AND_RESUME_IN(data_state);
-            } else if (IS_ASCII_UPPER(t->codepoint)) {
-                APPEND_TO_ATTR_NAME(TO_ASCII_LOWER(t->codepoint));
-                SWITCH_TO(attribute_name_state);
-            } else if (t->codepoint == 0) {
-                EMIT_ERROR("Reached \\0-character");
-            } else if (t->codepoint == '"' || t->codepoint == '\'' ||
-                    t->codepoint == '>') {
-                EMIT_ERROR("Invalid part of token name");
-            } else {
-                APPEND_TO_ATTR_NAME(t->codepoint);
-                SWITCH_TO(attribute_name_state);
-            }
-        }
-        END_STATE();
+    if (t->input_type == st_tokenizer_file_input) {
+        st_tokenizer_set_document(t, NULL, 0);
 
-        BEGIN_STATE(after_attribute_name_state) {
-            EMIT_ERROR("Unsupported: After attribute name state");
-        }
-        END_STATE();
-
-        BEGIN_STATE(before_attribute_value_state) {
-            if (IS_WHITESPACE(t->codepoint)) {
-                SWITCH_TO(before_attribute_value_state);
-            } else if (t->codepoint == '"') {
-                SWITCH_TO(attribute_value_double_quoted_state);
-            } else if (t->codepoint == '&') {
-                RECONSUME_IN(attribute_value_unquoted_state);
-            } else if (t->codepoint == '\'') {
-                SWITCH_TO(attribute_value_single_quoted_state);
-            } else if (t->codepoint == 0) {
-                EMIT_ERROR("Reached \\0-character");
-            } else if (t->codepoint == '>') {
-                EMIT_ERROR("Premature closing bracked");
-            } else if (t->codepoint == '<' || t->codepoint == '=' ||
-                    t->codepoint == '`') {
-                EMIT_ERROR("Invalid character");
-            } else {
-                APPEND_TO_ATTR_VALUE(t->codepoint);
-                SWITCH_TO(attribute_value_unquoted_state);
-            }
-        }
-        END_STATE();
-
-        BEGIN_STATE(attribute_value_double_quoted_state) {
-            if (t->codepoint == '"') {
-                SWITCH_TO(after_attribute_value_quoted_state);
-            } else if (t->codepoint == '&') {
-                SWITCH_TO(character_reference_in_attribute_value_state);
-            } else if (t->codepoint == '0') {
-                EMIT_ERROR("Reached \\0-character");
-            } else {
-                APPEND_TO_ATTR_VALUE(t->codepoint);
-                SWITCH_TO(attribute_value_double_quoted_state);
-            }
-        }
-        END_STATE();
-
-        BEGIN_STATE(attribute_value_single_quoted_state) {
-            if (t->codepoint == '\'') {
-                SWITCH_TO(after_attribute_value_quoted_state);
-            } else if (t->codepoint == '&') {
-                SWITCH_TO(character_reference_in_attribute_value_state);
-            } else if (t->codepoint == 0) {
-                EMIT_ERROR("Reached \\0-character");
-            } else {
-                APPEND_TO_ATTR_VALUE(t->codepoint);
-                SWITCH_TO(attribute_value_single_quoted_state);
-            }
-        }
-        END_STATE();
+        t->input_type = st_tokenizer_uninitialized_input;
+        t->input_func = NULL;
+        t->input_ctx = NULL;
 
-        BEGIN_STATE(attribute_value_unquoted_state) {
-            EMIT_ERROR("Unsupported: Attribute value (unquoted) state");
-        }
-        END_STATE();
+        t->buf = NULL;
+        t->buf_s = 0;
+        t->buf_valid = 0;
+    }
+}
 
-        BEGIN_STATE(character_reference_in_attribute_value_state) {
-            EMIT_ERROR("Unsupported: Character reference in attribute value"
-                    " state");
-        }
-        END_STATE();
-
-        BEGIN_STATE(after_attribute_value_quoted_state) {
-            if (IS_WHITESPACE(t->codepoint)) {
-                SWITCH_TO(before_attribute_name_state);
-            } else if (t->codepoint == '/') {
-                SWITCH_TO(self_closing_start_tag_state);
-            } else if (t->codepoint == '>') {
-                EMIT_AND_RESUME_IN(data_state);
-            } else {
-                EMIT_ERROR("Invalid character");
-            }
-        }
-        END_STATE();
+st_status st_tokenizer_run(st_tokenizer_t *t)
+{
+    if (t->input_func == NULL)
+        return st_invalid_config;
 
-        // TODO
+    if (t->input_type == st_tokenizer_string_input && t->buf_s == 0)
+        return st_eof;
 
-        BEGIN_STATE(self_closing_start_tag_state) {
-            EMIT_ERROR("Unsupported: Self closing start tag state");
-        }
-        END_STATE();
+    st_status rc;
+
+    // Call start of document callback
+    t->started = 1;
+    t->callbacks.document_start(t, t->ctx);
 
-        // TODO
+    // Iterate through the input and emit tokens
+    if ((rc = st_tokenizer_pump(t)) == st_eof) {
+        rc = st_tokenizer_end(t);
+    }
 
-        BEGIN_STATE(markup_declaration_open_state) {
-            EMIT_ERROR("Unsupported: Markup declaration open state");
-        }
-        END_STATE();
+    // The token and its storage are kept for the next document
+    if (t->token != NULL)
+        st_token_reset(t->token);
 
+    st_tokenizer_file_close(t);
 
-        default:
-            EMIT_ERROR("Unsupported state.");
+    return rc;
+}
 
+// Start a document of pushed input, unless one is being pushed
+static void st_tokenizer_start_push(st_tokenizer_t *t)
+{
+    if (t->input_type != st_tokenizer_push_input) {
+        st_tokenizer_new_document(t);
+        t->input_type = st_tokenizer_push_input;
+        t->input_func = &st_tokenizer_string_handler;
+        t->input_ctx = NULL;
+        t->buf_o = 0;
     }
 
-    // Reenable unused label warnings
-#pragma clang diagnostic pop
-
-    return st_err;
+    if (!t->started) {
+        t->started = 1;
+        t->callbacks.document_start(t, t->ctx);
+    }
 }
 
-static st_status st_tokenizer_next_codepoint(st_tokenizer_t *t)
+st_status st_tokenizer_feed(st_tokenizer_t *t,
+        const uint8_t *chunk, size_t len)
 {
+    st_tokenizer_start_push(t);
+
+    // Nothing more is tokenized once an error token ended the document
+    if (t->stopped)
+        return st_ok;
+
+    if (t->transcode.transcoder == NULL)
+        return st_tokenizer_feed_block(t, chunk, len);
+
+    // Input in another encoding is converted and tokenized one block at a
+    // time
+    st_tokenizer_transcode_input_t *in = &t->transcode;
+    size_t used, written;
     st_status rc;
-    size_t bytes;
 
-retry:
-    // Try to decode the next codepoint
-    if ((rc = t->next_codepoint(t->buf, t->buf_s, &t->codepoint, &bytes))
-            == st_ok) {
-        t->buf += bytes;
-        t->buf_s -= bytes;
-        t->buf_o += bytes;
-    } else if (rc == st_eof) {
-        // Decoding failed because we ran out of bytes to read, try to get more
-        // bytes by calling the input function and then retrying to decode.
-        if ((rc = t->input_func(&t->buf, &t->buf_s, &t->buf_o, t->input_ctx))
-                == st_ok) {
-            goto retry;
-        }
+    while (len > 0 && !t->stopped) {
+        st_transcode(in->transcoder, chunk, len, &used, in->block,
+                ST_TOKENIZER_TRANSCODE_BLOCK, &written);
+        chunk += used;
+        len -= used;
+
+        if (written > 0
+                && (rc = st_tokenizer_feed_block(t, in->block, written))
+                    != st_ok)
+            return rc;
+    }
+
+    return st_ok;
+}
+
+// Tokenize a chunk of UTF-8 that was pushed
+static st_status st_tokenizer_feed_block(st_tokenizer_t *t,
+        const uint8_t *chunk, size_t len)
+{
+    // The offset keeps counting from the previous chunk
+    t->buf = chunk;
+    t->buf_s = len;
+
+    // Input that completes a codepoint from the previous chunk is validated
+    // once the codepoint has been decoded
+    if (t->carry_len == 0)
+        st_tokenizer_validate(t);
+    else
+        t->buf_valid = 0;
+
+    st_status rc = st_tokenizer_pump(t);
+
+    // The chunk is not kept, and any codepoint it ends in the middle of is in
+    // the carry buffer
+    t->buf = NULL;
+    t->buf_s = 0;
+    t->buf_valid = 0;
+
+    return rc == st_eof ? st_ok : rc;
+}
+
+st_status st_tokenizer_finish(st_tokenizer_t *t)
+{
+    st_status rc = st_ok;
+
+    // Without a chunk the document is empty
+    st_tokenizer_start_push(t);
+
+    // A character that the converted input was cut in the middle of
+    if (!t->stopped && t->transcode.transcoder != NULL) {
+        size_t written;
+
+        st_transcode_finish(t->transcode.transcoder, t->transcode.block,
+                &written);
+        if (written > 0)
+            rc = st_tokenizer_feed_block(t, t->transcode.block, written);
+    }
+
+    if (!t->stopped && rc == st_ok)
+        rc = st_tokenizer_end(t);
+
+    // The token and its storage are kept for the next document
+    if (t->token != NULL)
+        st_token_reset(t->token);
+
+    // The next chunk that is fed starts a new document
+    t->input_type = st_tokenizer_uninitialized_input;
+
+    return rc;
+}
+
+//
+// Parallel tokenization of one document
+//
+
+// Smallest piece of a document worth tokenizing on its own thread
+#define ST_TOKENIZER_SEGMENT_MIN (256 * 1024)
+
+// A piece of the input tokenized on its own, and the batches it produced
+typedef struct {
+    st_tokenizer_t *t;                      // Tokenizer for the piece
+    const uint8_t *buf;                     // Start of the piece
+    size_t len;                             // Length of the piece
+    size_t offset;                          // Offset of the piece in the
+                                            // document
+    st_status rc;                           // Result of tokenizing it
+    st_token_batch_t **batches;             // Full batches, in order
+    size_t num_batches;
+    size_t allocated_batches;
+    pthread_t thread;                       // Thread tokenizing the piece
+    int threaded;                           // If the thread was started
+} st_tokenizer_segment_t;
+
+// Batch callback of a segment, keeps the full batch and continues in a new
+// one
+static void st_tokenizer_segment_collect(st_tokenizer_t *t,
+        st_token_batch_t *batch, void *ctx)
+{
+    st_tokenizer_segment_t *seg = ctx;
+    st_token_batch_t *next;
+
+    if (seg->num_batches == seg->allocated_batches) {
+        size_t allocated = seg->allocated_batches ?
+            seg->allocated_batches * 2 : 16;
+        st_token_batch_t **batches = st_realloc(&t->allocator,
+                seg->batches, allocated * sizeof(*batches));
+
+        if (batches == NULL) {
+            seg->rc = st_out_of_memory;
+            return;
+        }
+
+        seg->batches = batches;
+        seg->allocated_batches = allocated;
+    }
+
+    if (st_token_batch_init(&next, batch->capacity, batch->attr_capacity,
+                batch->data_capacity, &t->allocator) != st_ok) {
+        seg->rc = st_out_of_memory;
+        return;
+    }
+
+    seg->batches[seg->num_batches++] = batch;
+    t->batch = next;
+}
+
+// Tokenize a piece of input with the tokenizer of a segment
+static void st_tokenizer_segment_feed(st_tokenizer_segment_t *seg,
+        const uint8_t *buf, size_t len)
+{
+    st_status rc = st_tokenizer_feed(seg->t, buf, len);
+
+    // Keep an error from the batch callback
+    if (seg->rc == st_ok)
+        seg->rc = rc;
+}
+
+// Tokenize a segment as if it started the document, with offsets that count
+// from the start of the document
+static void *st_tokenizer_segment_run(void *arg)
+{
+    st_tokenizer_segment_t *seg = arg;
+
+    st_tokenizer_start_push(seg->t);
+    seg->t->buf_o = seg->offset;
+
+    st_tokenizer_segment_feed(seg, seg->buf, seg->len);
+
+    return NULL;
+}
+
+// If a segment tokenizer ended between two tokens in the data state, which
+// is where every other segment is speculated to start
+static int st_tokenizer_segment_clean(st_tokenizer_t *t)
+{
+    return t->state == st_tokenizer_data_state && !t->reconsume
+        && t->carry_len == 0 && (t->token == NULL
+                || st_token_type(t->token) == st_token_type_uninitialized);
+}
+
+// Hand the full batches of a segment to the batch callback, and the batch
+// that it is filling when its tokenizer is done
+static void st_tokenizer_segment_deliver(st_tokenizer_t *t,
+        st_tokenizer_segment_t *seg, int done)
+{
+    for (size_t i = 0; i < seg->num_batches; i++) {
+        t->batch_func(t, seg->batches[i], t->ctx);
+        st_token_batch_free(seg->batches[i]);
+    }
+    seg->num_batches = 0;
+
+    if (done && seg->t->batch->count > 0) {
+        t->batch_func(t, seg->t->batch, t->ctx);
+        st_token_batch_clear(seg->t->batch);
+    }
+}
+
+static void st_tokenizer_segment_free(st_tokenizer_t *t,
+        st_tokenizer_segment_t *seg)
+{
+    for (size_t i = 0; i < seg->num_batches; i++)
+        st_token_batch_free(seg->batches[i]);
+    st_free(&t->allocator, seg->batches);
+
+    if (seg->t != NULL) {
+        st_token_batch_free(seg->t->batch);
+        st_tokenizer_destroy(seg->t);
+    }
+}
+
+st_status st_tokenizer_run_parallel(st_tokenizer_t *t, size_t threads)
+{
+    st_tokenizer_segment_t *segs;
+    size_t num_segs, i;
+    st_status rc = st_ok;
+
+    if (t->batch == NULL)
+        return st_invalid_config;
+
+    if (threads == 0) {
+        long n = sysconf(_SC_NPROCESSORS_ONLN);
+        threads = n > 0 ? n : 1;
+    }
+
+    num_segs = t->buf_s / ST_TOKENIZER_SEGMENT_MIN;
+    if (num_segs > threads)
+        num_segs = threads;
+
+    // Only UTF-8 input that is in memory as a whole can be split up
+    if (num_segs < 2 || !t->bulk_text || t->started
+            || t->input_func != &st_tokenizer_string_handler
+            || (t->input_type != st_tokenizer_string_input
+                && t->input_type != st_tokenizer_file_input))
+        return st_tokenizer_run(t);
+
+    segs = st_malloc(&t->allocator, num_segs * sizeof(*segs));
+    if (segs == NULL)
+        return st_out_of_memory;
+
+    memset(segs, 0, num_segs * sizeof(*segs));
+
+    // Split the input right before a '<' near each even share. A '<' is
+    // always the start of a codepoint, and where a tag opens in the data
+    // state when the speculation holds.
+    const uint8_t *start = t->buf, *end = t->buf + t->buf_s;
+    size_t n = 0;
+
+    for (i = 1; i <= num_segs && start < end; i++) {
+        const uint8_t *split = end;
+
+        if (i < num_segs) {
+            const uint8_t *target = t->buf + t->buf_s / num_segs * i;
+            if (target <= start)
+                target = start + 1;
+            split = memchr(target, '<', end - target);
+            if (split == NULL)
+                split = end;
+        }
+
+        segs[n].buf = start;
+        segs[n].len = split - start;
+        segs[n].offset = start - t->buf;
+        n++;
+
+        start = split;
+    }
+    num_segs = n;
+
+    // Every segment gets its own tokenizer and batches
+    for (i = 0; i < num_segs; i++) {
+        st_tokenizer_segment_t *seg = &segs[i];
+        st_token_batch_t *batch;
+
+        // Its tokens are only delivered in batches
+        if (st_tokenizer_init(&seg->t, NULL, seg, &t->allocator) != 0) {
+            rc = st_out_of_memory;
+            goto done;
+        }
+
+        if ((rc = st_token_batch_init(&batch, t->batch->capacity,
+                        t->batch->attr_capacity, t->batch->data_capacity,
+                        &t->allocator)) != st_ok) {
+            goto done;
+        }
+
+        st_tokenizer_set_batch(seg->t, batch, &st_tokenizer_segment_collect);
+    }
+
+    // Tokenize all segments at once, the first one on this thread
+    for (i = 1; i < num_segs; i++) {
+        segs[i].threaded = (pthread_create(&segs[i].thread, NULL,
+                    &st_tokenizer_segment_run, &segs[i]) == 0);
+    }
+
+    // Segments without a thread are tokenized here
+    for (i = 0; i < num_segs; i++) {
+        if (!segs[i].threaded)
+            st_tokenizer_segment_run(&segs[i]);
+    }
+
+    for (i = 1; i < num_segs; i++) {
+        if (segs[i].threaded)
+            pthread_join(segs[i].thread, NULL);
+    }
+
+    // Stitch the results together in order. A segment was tokenized right if
+    // the one before it ended cleanly in the data state. Otherwise the
+    // tokenizer of the segment before carries on through it, exactly like a
+    // sequential run.
+    t->started = 1;
+    t->callbacks.document_start(t, t->ctx);
+
+    st_tokenizer_segment_t *cur = &segs[0];
+
+    for (i = 0; i < num_segs; i++) {
+        if (i > 0 && !st_tokenizer_segment_clean(cur->t)) {
+            st_tokenizer_segment_feed(cur, segs[i].buf, segs[i].len);
+        } else if (i > 0) {
+            st_tokenizer_segment_deliver(t, cur, 1);
+            cur = &segs[i];
+        }
+
+        // An error token ends the document, as does an error
+        if (cur->t->stopped || (rc = cur->rc) != st_ok) {
+            st_tokenizer_segment_deliver(t, cur, 1);
+            goto done;
+        }
+
+        // The tokenizer may carry on with the batch it is filling
+        st_tokenizer_segment_deliver(t, cur, 0);
+    }
+
+    // The text of a character reference the input ended in
+    if ((rc = st_tokenizer_end_reference(cur->t)) != st_ok)
+        goto done;
+    st_tokenizer_segment_deliver(t, cur, 1);
+
+    // The input ended in the middle of a codepoint
+    if (cur->t->carry_len > 0) {
+        rc = st_utf8_invalid;
+        goto done;
+    }
+
+    rc = st_tokenizer_end(t);
+
+done:
+    for (i = 0; i < num_segs; i++) {
+#ifdef ST_TOKENIZER_STATS
+        if (segs[i].t != NULL)
+            st_stats_add(&t->stats, &segs[i].t->stats);
+#endif
+        st_tokenizer_segment_free(t, &segs[i]);
+    }
+    st_free(&t->allocator, segs);
+
+    st_tokenizer_file_close(t);
+
+    return rc;
+}
+
+st_status st_tokenizer_next(st_tokenizer_t *t, st_token_t **token)
+{
+    st_status rc;
+
+    if (t->input_type == st_tokenizer_push_input)
+        return st_invalid_config;
+
+    // Nothing more is tokenized once the input ended, or an error token or an
+    // error ended the document. File input is closed by then.
+    if (t->stopped) {
+        rc = st_eof;
+        goto done;
+    }
+
+    if (t->input_func == NULL)
+        return st_invalid_config;
+
+    // The previous token is released when the next one is asked for
+    if (t->token == NULL) {
+        if ((rc = st_token_init(&t->token, &t->allocator)) != st_ok) {
+            return rc;
+        }
+    } else {
+        st_token_reset(t->token);
+    }
+
+    t->started = 1;
+
+    // The events sampled for the statistics are not left running between
+    // calls
+    rc = st_tokenizer_next_token(t, t->token);
+    PAUSE_SAMPLING();
+
+    if (rc == st_ok) {
+        if (st_token_type(t->token) == st_token_type_error)
+            t->stopped = 1;
+
+        *token = t->token;
+        return st_ok;
+    }
+
+    // A character reference at the end of the input is the last token
+    if (rc == st_eof && st_tokenizer_pending_reference(t)) {
+        *token = t->token;
+        return st_ok;
+    }
+
+    // The input ended in the middle of a codepoint
+    if (rc == st_eof && t->carry_len > 0)
+        rc = st_utf8_invalid;
+
+done:
+    t->stopped = 1;
+
+    // The token and its storage are kept for the next document
+    if (t->token != NULL)
+        st_token_reset(t->token);
+
+    st_tokenizer_file_close(t);
+
+    return rc;
+}
+
+// Emit tokens until the input runs out or an error token ends the document.
+// Returns st_eof when more input is needed.
+static st_status st_tokenizer_pump(st_tokenizer_t *t)
+{
+    st_status rc;
+
+    // The token lives on the tokenizer so that a token that is cut by the end
+    // of an input chunk is completed from the next one
+    if (t->token == NULL
+            && (rc = st_token_init(&t->token, &t->allocator)) != st_ok) {
+        return rc;
+    }
+
+    st_token_t *token = t->token;
+
+    // The events sampled for the statistics are not left running when run
+    // or feed return
+    while ((rc = st_tokenizer_next_token(t, token)) == st_ok) {
+        // Emit token
+        if ((rc = st_tokenizer_emit(t, token)) != st_ok) {
+            break;
+        }
+
+        // Check if we got an error token
+        if (st_token_type(token) == st_token_type_error) {
+            PAUSE_SAMPLING();
+            t->stopped = 1;
+            st_token_reset(token);
+            st_tokenizer_flush(t);
+            return st_ok;
+        }
+
+        st_token_reset(token);
+
+        assert(st_token_type(token) == st_token_type_uninitialized);
+    }
+
+    PAUSE_SAMPLING();
+
+    // Tokens before an error are delivered, as they are without batching
+    if (rc != st_eof)
+        st_tokenizer_flush(t);
+
+    return rc;
+}
+
+st_status st_tokenizer_set_batch(st_tokenizer_t *t, st_token_batch_t *batch,
+        st_tokenizer_cb_batch batch_func)
+{
+    if (batch != NULL && batch_func == NULL)
+        return st_invalid_config;
+
+    t->batch = batch;
+    t->batch_func = batch_func;
+
+    return st_ok;
+}
+
+// Emit a token through the token callback, or collect it in the batch
+static st_status st_tokenizer_emit(st_tokenizer_t *t, st_token_t *token)
+{
+    st_status rc;
+
+    if (t->batch == NULL) {
+        t->callbacks.token(t, token, t->ctx);
+        return st_ok;
+    }
+
+    // Text is split over as many batches as it takes
+    if (st_token_type(token) == st_token_type_text) {
+        const uint8_t *ptr;
+        size_t len, added, start, end;
+
+        st_token_text(token, &ptr, &len);
+        st_token_span(token, &start, &end);
+
+        while ((added = st_token_batch_add_text(t->batch, ptr, len,
+                        start, end)) < len) {
+            if (t->batch->count == 0)
+                return st_invalid_config;
+
+            st_tokenizer_flush(t);
+            ptr += added;
+            len -= added;
+            start = end - start > added ? start + added : end;
+        }
+
+        return st_ok;
+    }
+
+    // The batch callback may replace the batch
+    if ((rc = st_token_batch_add(t->batch, token)) == st_out_of_memory
+            && t->batch->count > 0) {
+        st_tokenizer_flush(t);
+        rc = st_token_batch_add(t->batch, token);
+    }
+
+    return rc;
+}
+
+// Deliver the tokens collected in the batch
+static void st_tokenizer_flush(st_tokenizer_t *t)
+{
+    if (t->batch == NULL || t->batch->count == 0)
+        return;
+
+    t->batch_func(t, t->batch, t->ctx);
+    st_token_batch_clear(t->batch);
+}
+
+// End the document after the last of the input
+static st_status st_tokenizer_end(st_tokenizer_t *t)
+{
+    st_status rc;
+
+    if ((rc = st_tokenizer_end_reference(t)) != st_ok)
+        return rc;
+
+    st_tokenizer_flush(t);
+
+    // The input ended in the middle of a codepoint
+    if (t->carry_len > 0)
+        return st_utf8_invalid;
+
+    // Call end of document callback
+    t->callbacks.document_end(t, t->ctx);
+
+    return st_ok;
+}
+
+// Get the next token from the state machine. Input that the built-in UTF-8
+// decoder reads goes through the instance that has it inlined.
+static inline st_status st_tokenizer_next_token(st_tokenizer_t *t,
+        st_token_t *token)
+{
+    st_status rc;
+
+#ifdef ST_TOKENIZER_STATS
+    st_stats_enter(&t->stats, &t->state);
+    rc = t->bulk_text ? st_tokenizer_states_utf8(t, token)
+        : st_tokenizer_states_generic(t, token);
+    st_stats_leave();
+
+    if (rc == st_ok) {
+        COUNT_TOKEN(token);
+    }
+#else
+    rc = t->bulk_text ? st_tokenizer_states_utf8(t, token)
+        : st_tokenizer_states_generic(t, token);
+#endif
+
+    // The token ends with the current character, unless that is reconsumed
+    if (rc == st_ok) {
+        st_token_set_span(token, t->token_start,
+                t->reconsume ? CURRENT_OFFSET() : t->buf_o);
+    }
+
+    return rc;
+}
+
+// The state machine, instantiated once for the built-in UTF-8 decoder, which
+// is inlined, and once for a handler set with
+// st_tokenizer_set_encoding_handler
+#define ST_TOKENIZER_STATES st_tokenizer_states_utf8
+#define NEXT_CODEPOINT(t) st_tokenizer_next_codepoint_utf8(t)
+#define BULK_TEXT 1
+#include "tokenizer_states.h"
+#undef ST_TOKENIZER_STATES
+#undef NEXT_CODEPOINT
+#undef BULK_TEXT
+
+#define ST_TOKENIZER_STATES st_tokenizer_states_generic
+#define NEXT_CODEPOINT(t) st_tokenizer_next_codepoint(t)
+#define BULK_TEXT 0
+#include "tokenizer_states.h"
+#undef ST_TOKENIZER_STATES
+#undef NEXT_CODEPOINT
+#undef BULK_TEXT
+
+// Validate the UTF-8 in the input buffer in bulk, so that it can be read
+// without checking every sequence
+static void st_tokenizer_validate(st_tokenizer_t *t)
+{
+    t->buf_valid = 0;
+
+    // The bytes up to the first invalid or incomplete sequence are valid, and
+    // the decoder reports the error when it gets there
+    if (t->bulk_text)
+        utf8_validate(t->buf, t->buf_s, &t->buf_valid);
+}
+
+// Move past bytes of the input
+static inline void st_tokenizer_consume(st_tokenizer_t *t, size_t bytes)
+{
+    t->buf += bytes;
+    t->buf_s -= bytes;
+    t->buf_o += bytes;
+    t->buf_valid = t->buf_valid > bytes ? t->buf_valid - bytes : 0;
+}
+
+// Decode a codepoint into t->codepoint, with the built-in UTF-8 decoder when
+// utf8 is set and with the handler otherwise
+static ST_ALWAYS_INLINE st_status st_tokenizer_decode(st_tokenizer_t *t,
+        int utf8, const uint8_t *in, size_t len, size_t *bytes)
+{
+    return utf8 ? utf8_decode(in, len, &t->codepoint, bytes)
+        : t->next_codepoint(in, len, &t->codepoint, bytes);
+}
+
+// Complete a codepoint that was cut by the end of the previous input chunk
+// with bytes from the current one
+static st_status st_tokenizer_complete_carry(st_tokenizer_t *t, int utf8)
+{
+    st_status rc = st_eof;
+    size_t bytes;
+
+    while (rc == st_eof && t->buf_s > 0) {
+        if (t->carry_len == sizeof(t->carry))
+            return st_err;
+
+        t->carry[t->carry_len++] = *t->buf;
+        st_tokenizer_consume(t, 1);
+
+        rc = st_tokenizer_decode(t, utf8, t->carry, t->carry_len, &bytes);
+    }
+
+    if (rc == st_ok) {
+        t->codepoint_ptr = t->carry;
+        t->codepoint_len = t->carry_len;
+        t->carry_len = 0;
+
+        // The rest of the chunk can be validated now
+        st_tokenizer_validate(t);
+    }
+
+    return rc;
+}
+
+// Consume the next codepoint, see st_tokenizer_decode for utf8
+static ST_ALWAYS_INLINE st_status st_tokenizer_read_codepoint(
+        st_tokenizer_t *t, int utf8)
+{
+    st_status rc;
+    size_t bytes;
+
+retry:
+    if (t->carry_len > 0) {
+        if ((rc = st_tokenizer_complete_carry(t, utf8)) == st_ok) {
+            goto decoded;
+        } else if (rc == st_eof) {
+            goto refill;
+        }
+        return rc;
+    }
+
+    // Validated input is not decoded. The state machine only tells ASCII
+    // characters apart, so a non-ASCII character is left as its first byte,
+    // and its bytes are copied wherever it ends up.
+    if (utf8 && t->buf_valid > 0) {
+        t->codepoint = *t->buf;
+        bytes = ST_BYTE_LENGTH(t->codepoint);
+        rc = st_ok;
+    } else {
+        // Try to decode the next codepoint
+        rc = st_tokenizer_decode(t, utf8, t->buf, t->buf_s, &bytes);
+    }
+
+    if (rc == st_ok) {
+        t->codepoint_ptr = t->buf;
+        t->codepoint_len = bytes;
+        st_tokenizer_consume(t, bytes);
+
+decoded:
+        // Normalize newlines, both CR LF and a lone CR become LF
+        if (t->codepoint == '\r') {
+            t->codepoint = '\n';
+            t->skip_lf = 1;
+        } else if (t->skip_lf) {
+            t->skip_lf = 0;
+            if (t->codepoint == '\n')
+                goto retry;
+        }
+
+        COUNT_CODEPOINTS(1);
+    } else if (rc == st_eof) {
+refill:
+        // Decoding failed because we ran out of bytes to read. Keep the start
+        // of a codepoint that is cut by the end of the buffer, and try to get
+        // more bytes by calling the input function and then retrying to
+        // decode.
+        if (t->buf_s > 0) {
+            if (t->carry_len + t->buf_s > sizeof(t->carry))
+                return st_err;
+
+            memcpy(t->carry + t->carry_len, t->buf, t->buf_s);
+            t->carry_len += t->buf_s;
+            st_tokenizer_consume(t, t->buf_s);
+        }
+
+        if ((rc = t->input_func(&t->buf, &t->buf_s, &t->buf_o, t->input_ctx))
+                == st_ok) {
+            t->buf_valid = 0;
+            if (t->carry_len == 0)
+                st_tokenizer_validate(t);
+            goto retry;
+        }
+    }
+
+    return rc;
+}
+
+static st_status st_tokenizer_next_codepoint_utf8(st_tokenizer_t *t)
+{
+    return st_tokenizer_read_codepoint(t, 1);
+}
+
+static st_status st_tokenizer_next_codepoint(st_tokenizer_t *t)
+{
+    return st_tokenizer_read_codepoint(t, 0);
+}
+
+// Consume the run of text at the current position, up to the first byte the
+// data state has to handle one at a time. Returns the length of the run.
+static size_t st_tokenizer_text_run(st_tokenizer_t *t)
+{
+    // Drop the LF following a CR that was already consumed
+    if (t->skip_lf && t->buf_s > 0) {
+        t->skip_lf = 0;
+        if (*t->buf == '\n') {
+            st_tokenizer_consume(t, 1);
+        }
+    }
+
+    // Only validated bytes can be passed on without decoding them
+    size_t len = st_scan_text(t->buf, t->buf_valid);
+
+#ifdef ST_TOKENIZER_STATS
+    // Every byte but the continuation bytes starts a codepoint
+    for (size_t i = 0; i < len; i++) {
+        COUNT_CODEPOINTS((t->buf[i] & 0xC0) != 0x80);
+    }
+#endif
+
+    st_tokenizer_consume(t, len);
+
+    return len;
+}
+
+// The current character as a codepoint, decoded from its bytes when the
+// state machine did not need to
+static uint32_t st_tokenizer_codepoint(st_tokenizer_t *t)
+{
+    uint32_t codepoint = t->codepoint;
+
+    if (codepoint >= 0x80 && t->bulk_text)
+        utf8_decode_valid(t->codepoint_ptr, &codepoint);
+
+    return codepoint;
+}
+
+// Consume the validated bytes up to the first one that ends a run of the
+// state, and return how many there were. Nothing is taken while an LF may
+// still have to be dropped after a CR.
+static inline size_t st_tokenizer_take_run(st_tokenizer_t *t, uint8_t run)
+{
+    const uint8_t *p = t->buf, *end = t->buf + t->buf_valid;
+
+    if (t->skip_lf)
+        return 0;
+
+    while (p < end && !(st_tokenizer_byte_run[*p] & run))
+        p++;
+
+    size_t len = p - t->buf;
+
+#ifdef ST_TOKENIZER_STATS
+    for (size_t i = 0; i < len; i++) {
+        COUNT_CODEPOINTS((t->buf[i] & 0xC0) != 0x80);
+    }
+#endif
+
+    st_tokenizer_consume(t, len);
+
+    return len;
+}
+
+// Every ASCII character, so that single character text tokens have something
+// static to point to
+static const uint8_t st_tokenizer_ascii[128] = {
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,
+     15,  16,  17,  18,  19,  20,  21,  22,  23,  24,  25,  26,  27,  28,  29,
+     30,  31,  32,  33,  34,  35,  36,  37,  38,  39,  40,  41,  42,  43,  44,
+     45,  46,  47,  48,  49,  50,  51,  52,  53,  54,  55,  56,  57,  58,  59,
+     60,  61,  62,  63,  64,  65,  66,  67,  68,  69,  70,  71,  72,  73,  74,
+     75,  76,  77,  78,  79,  80,  81,  82,  83,  84,  85,  86,  87,  88,  89,
+     90,  91,  92,  93,  94,  95,  96,  97,  98,  99, 100, 101, 102, 103, 104,
+    105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119,
+    120, 121, 122, 123, 124, 125, 126, 127,
+};
+
+// Open a token for a single character. With UTF-8 input this is a text token
+// that borrows the bytes of the codepoint from the input, or from the table
+// above for ASCII, which also covers characters that were normalized or are
+// not the current codepoint. Other encodings get a character token.
+static st_status st_tokenizer_character_token(st_tokenizer_t *t,
+        st_token_t *token, uint32_t codepoint)
+{
+    if (!t->bulk_text)
+        return st_token_set_character(token, codepoint);
+
+    if (codepoint < 0x80)
+        return st_token_set_text(token, &st_tokenizer_ascii[codepoint], 1);
+
+    // A non-ASCII character is always the current codepoint
+    assert(codepoint == t->codepoint);
+
+    return st_token_set_text(token, t->codepoint_ptr, t->codepoint_len);
+}
+
+// Characters that numeric references to the C1 controls stand for, as in
+// windows-1252. Codes it does not use stay as they are.
+static const uint16_t st_tokenizer_c1_references[32] = {
+    0x20AC, 0x0081, 0x201A, 0x0192, 0x201E, 0x2026, 0x2020, 0x2021,
+    0x02C6, 0x2030, 0x0160, 0x2039, 0x0152, 0x008D, 0x017D, 0x008F,
+    0x0090, 0x2018, 0x2019, 0x201C, 0x201D, 0x2022, 0x2013, 0x2014,
+    0x02DC, 0x2122, 0x0161, 0x203A, 0x0153, 0x009D, 0x017E, 0x0178,
+};
+
+// The character a numeric reference stands for
+static uint32_t st_tokenizer_numeric_reference(uint32_t code)
+{
+    if (code == 0 || code > 0x10FFFF || (code >= 0xD800 && code <= 0xDFFF))
+        return REPLACEMENT_CHARACTER;
+
+    if (code >= 0x80 && code <= 0x9F)
+        return st_tokenizer_c1_references[code - 0x80];
+
+    return code;
+}
+
+// Resolve the character reference that was read into the text that replaces
+// it, and add that to the token. In the data and RCDATA states this is a
+// text token, and otherwise it is appended to the attribute value. next is
+// the character after the reference, or 0 if there is none.
+static st_status st_tokenizer_reference(st_tokenizer_t *t,
+        st_token_t *token, uint32_t next)
+{
+    int text = t->ref_return == st_tokenizer_data_state ||
+        t->ref_return == st_tokenizer_rcdata_state;
+    uint32_t codepoints[2];
+    size_t n = 0, literal = 0, len = 0, i;
+    st_status rc;
+
+    switch (t->state) {
+        case st_tokenizer_named_character_reference_state:
+            if (t->ref_match_len == 0)
+                break;
+
+            // A name without a semicolon in an attribute value followed by
+            // more of what could be a name is left alone, it is likely part
+            // of a URL
+            if (!text && t->ref_buf[t->ref_match_len - 1] != ';') {
+                uint32_t c = t->ref_match_len < t->ref_len ?
+                    t->ref_buf[t->ref_match_len] : next;
+
+                if (c == '=' || IS_ASCII_ALPHANUMERIC(c))
+                    break;
+            }
+
+            n = st_entity_codepoints(t->ref_match, codepoints);
+            literal = t->ref_match_len;
+            break;
+
+        case st_tokenizer_hexadecimal_character_reference_state:
+        case st_tokenizer_decimal_character_reference_state:
+            codepoints[0] = st_tokenizer_numeric_reference(t->ref_code);
+            n = 1;
+            literal = t->ref_len;
+            break;
+
+        default:
+            break;
+    }
+
+    // What was read after the end of a name is kept as it is, and so is all
+    // of it when it is not a reference
+    if (!text) {
+        for (i = 0; i < n; i++) {
+            APPEND_TO_ATTR_VALUE(codepoints[i]);
+        }
+        for (i = literal; i < t->ref_len; i++) {
+            APPEND_TO_ATTR_VALUE(t->ref_buf[i]);
+        }
+        return st_ok;
+    }
+
+    for (i = 0; i < n; i++)
+        len += utf8_encode_codepoint(codepoints[i], t->ref_text + len);
+
+    memcpy(t->ref_text + len, t->ref_buf + literal, t->ref_len - literal);
+    len += t->ref_len - literal;
+
+    return st_token_set_text(token, t->ref_text, len);
+}
+
+// Check if the input ended in a character reference in text, and resolve it
+// into a text token if it did
+static int st_tokenizer_pending_reference(st_tokenizer_t *t)
+{
+    switch (t->state) {
+        case st_tokenizer_character_reference_in_data_state:
+        case st_tokenizer_character_reference_in_rcdata_state:
+        case st_tokenizer_character_reference_state:
+        case st_tokenizer_named_character_reference_state:
+        case st_tokenizer_numeric_character_reference_state:
+        case st_tokenizer_hexadecimal_character_reference_start_state:
+        case st_tokenizer_decimal_character_reference_start_state:
+        case st_tokenizer_hexadecimal_character_reference_state:
+        case st_tokenizer_decimal_character_reference_state:
+            break;
+        default:
+            return 0;
+    }
+
+    if (t->ref_return != st_tokenizer_data_state &&
+            t->ref_return != st_tokenizer_rcdata_state)
+        return 0;
+
+    if (t->token == NULL || st_tokenizer_reference(t, t->token, 0) != st_ok)
+        return 0;
+
+    t->state = t->ref_return;
+    COUNT_TOKEN(t->token);
+
+    st_token_set_span(t->token, t->token_start, t->buf_o);
+
+    return 1;
+}
+
+// Emit the character reference the input ended in, if any
+static st_status st_tokenizer_end_reference(st_tokenizer_t *t)
+{
+    st_status rc = st_ok;
+
+    if (st_tokenizer_pending_reference(t)) {
+        rc = st_tokenizer_emit(t, t->token);
+        st_token_reset(t->token);
     }
 
     return rc;
@@ -570,5 +1982,5 @@ retry:
 st_status st_tokenizer_encode_unicode(st_tokenizer_t *t,
         uint32_t *in, size_t size, uint8_t **out, size_t *bytes)
 {
-    return t->encode_func(in, size, out, bytes);
+    return t->encode_func(in, size, out, bytes, &t->allocator);
 }
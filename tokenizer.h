@@ -8,9 +8,13 @@
 
 #include <stdlib.h>
 #include <stdint.h>
+#include <stdio.h>
 
 #include "styre.h"
+#include "alloc.h"
+#include "encoding.h"
 #include "token.h"
+#include "batch.h"
 
 // typedefs
 typedef enum st_tokenizer_state st_tokenizer_state_t;
@@ -65,8 +69,23 @@ enum st_tokenizer_state {
     st_tokenizer_markup_declaration_open_state,                // Ref. 8.2.4.45
 
     // TODO
+
+    // Steps of consuming a character reference, entered from the character
+    // reference states above
+    st_tokenizer_character_reference_state,                    // Ref. 8.2.4.69
+    st_tokenizer_named_character_reference_state,              // Ref. 8.2.4.69
+    st_tokenizer_numeric_character_reference_state,            // Ref. 8.2.4.69
+    st_tokenizer_hexadecimal_character_reference_start_state,  // Ref. 8.2.4.69
+    st_tokenizer_decimal_character_reference_start_state,      // Ref. 8.2.4.69
+    st_tokenizer_hexadecimal_character_reference_state,        // Ref. 8.2.4.69
+    st_tokenizer_decimal_character_reference_state,            // Ref. 8.2.4.69
 };
 
+// Number of states, and of token types
+#define ST_TOKENIZER_NUM_STATES                                                \
+    ((size_t)st_tokenizer_decimal_character_reference_state + 1)
+#define ST_TOKEN_NUM_TYPES ((size_t)st_token_type_text + 1)
+
 //
 // Input types
 //
@@ -75,13 +94,19 @@ typedef enum {
     st_tokenizer_string_input,
     st_tokenizer_file_input,
     st_tokenizer_callback_input,
+    st_tokenizer_push_input,
 } st_tokenizer_input_type_t;
 
 //
 // Callbacks
 //
 
-// Tokenizer input callback
+// Tokenizer input callback. Called when the current buffer has been used up,
+// it should point buffer and size at the next chunk of input and return st_ok,
+// or return st_eof at the end of the input. The offset is the number of bytes
+// of input consumed so far. A previous chunk is not read again once the
+// callback has been called, but text tokens emitted from it must stay valid
+// until the callback returns.
 typedef st_status (*st_tokenizer_input_cb)(const uint8_t **buffer,
         size_t *size, size_t *offset, void *ctx);
 
@@ -89,9 +114,11 @@ typedef st_status (*st_tokenizer_input_cb)(const uint8_t **buffer,
 typedef st_status (*st_tokenizer_next_codepoint_cb)(const uint8_t *in,
         size_t len, uint32_t *out, size_t *bytes);
 
-// Function to encode an array of codepoints
+// Function to encode an array of codepoints into a new string, allocated
+// from the given allocator
 typedef st_status (*st_tokenizer_encode_string_cb)(const uint32_t *in,
-        size_t len, uint8_t **out, size_t *bytes);
+        size_t len, uint8_t **out, size_t *bytes,
+        const st_allocator_t *allocator);
 
 // Start of document callback
 typedef void (*st_tokenizer_cb_document_start)(st_tokenizer_t *tokenizer,
@@ -104,6 +131,11 @@ typedef void (*st_tokenizer_cb_document_end)(st_tokenizer_t *tokenizer,
 typedef void (*st_tokenizer_cd_token)(st_tokenizer_t *tokenizer,
         st_token_t *token, void *ctx);
 
+// Batch callback, called with each full batch and with the last tokens of the
+// document. The batch is emptied when the callback returns.
+typedef void (*st_tokenizer_cb_batch)(st_tokenizer_t *tokenizer,
+        st_token_batch_t *batch, void *ctx);
+
 // Error callback
 typedef void (*st_tokenizer_cb_error)(st_tokenizer_t *tokenizer,
         const char *message, void *ctx);
@@ -118,23 +150,163 @@ struct st_tokenizer_callbacks {
     st_tokenizer_cb_error error;
 };
 
-// Initialize a new tokenizer
+// Initialize a new tokenizer. The tokenizer and everything it allocates,
+// tokens, file buffers and the batches of st_tokenizer_run_parallel, come
+// from allocator, or from libc when it is NULL. The allocator is copied.
+// Callbacks may be NULL, as may any of them, such as when tokens are pulled
+// with st_tokenizer_next, and those that are not set do nothing.
 int st_tokenizer_init(st_tokenizer_t **tokenizer,
-        st_tokenizer_callbacks_t *callbacks, void *ctx);
+        st_tokenizer_callbacks_t *callbacks, void *ctx,
+        const st_allocator_t *allocator);
+
+// Free a tokenizer and everything it keeps
+void st_tokenizer_destroy(st_tokenizer_t *t);
+
+// Forget the input and the document, so the tokenizer can be pointed at a new
+// one. Callbacks, encoding and batch are kept, as is the token with all of its
+// storage, so reusing a tokenizer allocates nothing once it has seen a
+// document like the next one.
+st_status st_tokenizer_reset(st_tokenizer_t *t);
+
+// Set the context passed to the callbacks
+void st_tokenizer_set_context(st_tokenizer_t *t, void *ctx);
+
+// Get the allocator of the tokenizer
+const st_allocator_t *st_tokenizer_allocator(st_tokenizer_t *t);
 
-// Set encoding functions
+// Set encoding functions. The input is decoded with next_codepoint as it is,
+// so this ends a conversion set with st_tokenizer_set_encoding.
 st_status st_tokenizer_set_encoding_handler(st_tokenizer_t *t,
         st_tokenizer_next_codepoint_cb next_codepoint,
         st_tokenizer_encode_string_cb encode_func);
 
+// Set the encoding of the input that is set after it. Input in any encoding
+// but UTF-8 is converted to UTF-8 in blocks as it is read, and tokenized as
+// UTF-8, so text tokens point into the converted block and are valid until
+// the next token, and offsets count bytes of UTF-8. Converted input is never
+// split by st_tokenizer_run_parallel.
+st_status st_tokenizer_set_encoding(st_tokenizer_t *t,
+        st_encoding_t encoding);
+
+// Set the input to a string. Setting any input starts a new document, so a
+// tokenizer can be used for one document after another.
 st_status st_tokenizer_set_string(st_tokenizer_t *t,
         const uint8_t *buf, size_t len);
 
+// Set the input to a file. Regular files are memory mapped and tokenized in
+// place, and text tokens point into the mapping. Pipes and other files that
+// can not be mapped are read in chunks. The file is released when
+// st_tokenizer_run returns or the input is changed.
+st_status st_tokenizer_set_file(st_tokenizer_t *t, const char *path);
+
+// Set the input to an open file descriptor, which is left open
+st_status st_tokenizer_set_fd(st_tokenizer_t *t, int fd);
+
+// Set a callback that is pulled for chunks of input by st_tokenizer_run
+st_status st_tokenizer_set_input_handler(st_tokenizer_t *t,
+        st_tokenizer_input_cb input_func, void *ctx);
+
+// Encode codepoints with the encoding of the tokenizer, into a new string
+// that the caller must free with the allocator of the tokenizer
 st_status st_tokenizer_encode_unicode(st_tokenizer_t *t,
         uint32_t *in, size_t size, uint8_t **out, size_t *bytes);
 
+// Collect tokens in a batch instead of calling the token callback for each
+// one. Pass NULL to go back to the token callback. Tokenizing returns
+// st_invalid_config when a token does not fit in the empty batch.
+st_status st_tokenizer_set_batch(st_tokenizer_t *t, st_token_batch_t *batch,
+        st_tokenizer_cb_batch batch_func);
+
+// Get the line and column of a byte offset into the document, such as the
+// offset of an error token, both counted from 1 and the column in
+// characters. Lines end at LF, CR LF or CR. Nothing is counted while
+// tokenizing, the lines are counted from the input when this is called, so
+// it only works for input that is in memory as a whole: a string, or a
+// mapped file until st_tokenizer_run returns. Returns st_not_found for other
+// input, for converted input, and for offsets past the end of the document.
+st_status st_tokenizer_position(st_tokenizer_t *t, size_t offset,
+        size_t *line, size_t *column);
+
+// Tokenize the whole input
 st_status st_tokenizer_run(st_tokenizer_t *t);
 
+// Get the next token without going through the callbacks. The token is owned
+// by the tokenizer and is valid until the next call. Returns st_eof at the end
+// of the input, and on every call after the end, an error token or an error
+// until new input is set. No callbacks are called. Not for input pushed with
+// st_tokenizer_feed.
+st_status st_tokenizer_next(st_tokenizer_t *t, st_token_t **token);
+
+// Tokenize the whole input like st_tokenizer_run, with the document split
+// into pieces that are tokenized on up to threads threads at once, or one per
+// CPU when threads is 0. Every piece but the first is assumed to start in the
+// data state, and pieces where that was wrong are tokenized again, so the
+// tokens and their spans are the same as from st_tokenizer_run. Tokens are
+// delivered through the batch callback, so a batch must be set. The batches
+// passed to it are owned by the tokenizer and have the capacities of the
+// batch that was set. They are not filled the same: the batch before a piece
+// that was tokenized on its own ends early, so the batches after it, and the
+// places where long text is split over two of them, differ from a sequential
+// run.
+// Input that is not a string or mapped file, or too small to be worth
+// splitting, is tokenized with st_tokenizer_run. The allocator of the
+// tokenizer is called from the threads of the pieces.
+st_status st_tokenizer_run_parallel(st_tokenizer_t *t, size_t threads);
+
+// Push a chunk of input and emit all tokens that it completes. Codepoints and
+// tokens that are cut by the end of the chunk are kept and completed by the
+// next one, so chunks can be split anywhere. The chunk is not referenced
+// after the call returns.
+st_status st_tokenizer_feed(st_tokenizer_t *t,
+        const uint8_t *chunk, size_t len);
+
+// End input that was pushed with st_tokenizer_feed. Without a chunk pushed
+// since the last document it ends an empty document.
+st_status st_tokenizer_finish(st_tokenizer_t *t);
+
+//
+// Instrumentation
+//
+// A tokenizer built with ST_TOKENIZER_STATS defined counts the codepoints
+// consumed in each state and the tokens emitted of each type. Where
+// perf_event_open allows it, it also samples the CPU cycles and branch misses
+// of the thread and adds them to the state the tokenizer is in. Samples are
+// only taken while the tokenizer runs, not in the callbacks, and the events
+// are disabled when st_tokenizer_run, st_tokenizer_feed, st_tokenizer_finish
+// and st_tokenizer_next return. The samples are delivered as the signal
+// SIGRTMIN + 4, for which a handler is installed for the whole process the
+// first time a tokenizer runs, so the application must leave that signal to
+// it. Without ST_TOKENIZER_STATS none of this is compiled in.
+//
+typedef struct {
+    uint64_t codepoints[ST_TOKENIZER_NUM_STATES];   // Codepoints consumed
+    uint64_t tokens[ST_TOKEN_NUM_TYPES];            // Tokens of each type
+
+    int cycles_sampled;                     // If cycles were sampled
+    int cycles_are_ns;                      // If the cycles are nanoseconds
+                                            // of task clock, because the CPU
+                                            // counters are not available
+    int branch_misses_sampled;              // If branch misses were sampled
+    uint64_t cycles[ST_TOKENIZER_NUM_STATES];           // Estimated from the
+    uint64_t branch_misses[ST_TOKENIZER_NUM_STATES];    // samples
+} st_tokenizer_stats_t;
+
+// Get the counters since the tokenizer was created or the counters were
+// cleared. They add up over documents, and the pieces tokenized by
+// st_tokenizer_run_parallel are added in. Returns st_invalid_config when the
+// tokenizer was built without ST_TOKENIZER_STATS.
+st_status st_tokenizer_stats(st_tokenizer_t *t, st_tokenizer_stats_t *stats);
+
+// Set the counters to zero
+void st_tokenizer_stats_clear(st_tokenizer_t *t);
+
+// Print a table of the counters for the states and token types that were
+// seen
+void st_tokenizer_stats_dump(const st_tokenizer_stats_t *stats, FILE *out);
+
+// Name of a state, without the st_tokenizer_ prefix and _state suffix
+const char *st_tokenizer_state_name(st_tokenizer_state_t state);
+
 // TODO
 //#ifdef __cplusplus
 //}
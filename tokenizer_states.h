@@ -0,0 +1,513 @@
+// The state machine of the tokenizer, included by tokenizer.c once for every
+// decoder it is instantiated for, with these defined:
+//
+// ST_TOKENIZER_STATES  Name of the function
+// NEXT_CODEPOINT(t)    Consumes the next codepoint
+// BULK_TEXT            If the input is UTF-8 from the built-in decoder, so
+//                      text is scanned and copied as bytes
+//
+// There is no include guard on purpose.
+
+static st_status ST_TOKENIZER_STATES(st_tokenizer_t *t, st_token_t *token)
+{
+    // Status code from function calls
+    st_status rc;
+
+#ifdef ST_TOKENIZER_COMPUTED_GOTO
+    static const void *const states[ST_TOKENIZER_NUM_STATES] = {
+        [0 ... ST_TOKENIZER_NUM_STATES - 1] = &&unsupported_state,
+        STATE_LABEL(data_state),
+        STATE_LABEL(character_reference_in_data_state),
+        STATE_LABEL(rcdata_state),
+        STATE_LABEL(character_reference_in_rcdata_state),
+        STATE_LABEL(rawtext_state),
+        STATE_LABEL(script_data_state),
+        STATE_LABEL(plaintext_state),
+        STATE_LABEL(tag_open_state),
+        STATE_LABEL(end_tag_open_state),
+        STATE_LABEL(tag_name_state),
+        STATE_LABEL(rcdata_less_than_sign_state),
+        STATE_LABEL(rcdata_end_tag_open_state),
+        STATE_LABEL(before_attribute_name_state),
+        STATE_LABEL(attribute_name_state),
+        STATE_LABEL(after_attribute_name_state),
+        STATE_LABEL(before_attribute_value_state),
+        STATE_LABEL(attribute_value_double_quoted_state),
+        STATE_LABEL(attribute_value_single_quoted_state),
+        STATE_LABEL(attribute_value_unquoted_state),
+        STATE_LABEL(character_reference_in_attribute_value_state),
+        STATE_LABEL(after_attribute_value_quoted_state),
+        STATE_LABEL(self_closing_start_tag_state),
+        STATE_LABEL(markup_declaration_open_state),
+        STATE_LABEL(character_reference_state),
+        STATE_LABEL(named_character_reference_state),
+        STATE_LABEL(numeric_character_reference_state),
+        STATE_LABEL(hexadecimal_character_reference_start_state),
+        STATE_LABEL(decimal_character_reference_start_state),
+        STATE_LABEL(hexadecimal_character_reference_state),
+        STATE_LABEL(decimal_character_reference_state),
+    };
+#endif
+
+    // Runs of text in the data and RCDATA states are scanned in bulk, straight
+    // up to the next character the state machine has to look at, and emitted
+    // as a single text token.
+    if ((t->state == st_tokenizer_data_state ||
+                t->state == st_tokenizer_rcdata_state) &&
+            !t->reconsume && BULK_TEXT) {
+        size_t len = st_tokenizer_text_run(t);
+
+        if (len > 0) {
+            t->token_start = t->buf_o - len;
+            if ((rc = st_token_set_text(token, t->buf - len, len)) != st_ok) {
+                return rc;
+            }
+            EMIT_TOKEN();
+        }
+    }
+
+    if (t->reconsume) {
+        t->reconsume = 0;
+    } else if ((rc = NEXT_CODEPOINT(t)) != st_ok) {
+        return rc;
+    }
+
+    // Tokens start in these states, a token that was cut by the end of an
+    // input chunk goes on in another one
+    if (t->state == st_tokenizer_data_state ||
+            t->state == st_tokenizer_rcdata_state) {
+        t->token_start = CURRENT_OFFSET();
+    }
+
+dispatch:
+#ifdef ST_TOKENIZER_COMPUTED_GOTO
+    goto *states[t->state];
+#endif
+    switch(t->state) {
+
+        BEGIN_STATE(data_state) {
+            switch(t->codepoint) {
+                case '&':
+                    OPEN_CHARACTER_REFERENCE(data_state, NO_CHARACTER);
+                    SWITCH_TO(character_reference_in_data_state);
+                case '<':
+                    SWITCH_TO(tag_open_state);
+                case 0:
+                    EMIT_ERROR("Reached \\0-character.");
+                default:
+                    OPEN_CHARACTER_TOKEN(t->codepoint);
+                    EMIT_TOKEN();
+            }
+        }
+        END_STATE()
+
+
+        BEGIN_STATE(character_reference_in_data_state) {
+            RECONSUME_IN(character_reference_state);
+        }
+        END_STATE();
+
+
+        BEGIN_STATE(rcdata_state) {
+            switch(t->codepoint) {
+                case '&':
+                    OPEN_CHARACTER_REFERENCE(rcdata_state, NO_CHARACTER);
+                    SWITCH_TO(character_reference_in_rcdata_state);
+                case '<':
+                    SWITCH_TO(rcdata_less_than_sign_state);
+                case 0:
+                    EMIT_ERROR("Reached \\0-character.");
+                default:
+                    OPEN_CHARACTER_TOKEN(t->codepoint);
+                    EMIT_TOKEN();
+            }
+        }
+        END_STATE();
+
+        BEGIN_STATE(character_reference_in_rcdata_state) {
+            RECONSUME_IN(character_reference_state);
+        }
+        END_STATE();
+
+        BEGIN_STATE(rawtext_state) {
+            EMIT_ERROR("Unsupported: Rawtext state");
+        }
+        END_STATE();
+
+        BEGIN_STATE(script_data_state) {
+            EMIT_ERROR("Unsupported: Script data state");
+        }
+        END_STATE();
+
+        BEGIN_STATE(plaintext_state) {
+            EMIT_ERROR("Unsupported: Plain text state");
+        }
+        END_STATE();
+
+        BEGIN_STATE(tag_open_state) {
+            if (t->codepoint == '!') {
+                SWITCH_TO(markup_declaration_open_state);
+            } else if (t->codepoint == '/') {
+                SWITCH_TO(end_tag_open_state);
+            } else if (IS_ASCII_UPPER(t->codepoint)) {
+                OPEN_START_TAG_TOKEN(TO_ASCII_LOWER(t->codepoint));
+                SWITCH_TO(tag_name_state);
+            } else if (IS_ASCII_LOWER(t->codepoint)) {
+                OPEN_START_TAG_TOKEN(t->codepoint);
+                SWITCH_TO(tag_name_state);
+            } else if (t->codepoint == '?') {
+                EMIT_ERROR("Parse error: invalid token ?");
+            } else {
+                EMIT_ERROR("Parse error: reached invalid token");
+            }
+        }
+        END_STATE();
+
+        BEGIN_STATE(end_tag_open_state) {
+            if (IS_ASCII_UPPER(t->codepoint)) {
+                OPEN_END_TAG_TOKEN(TO_ASCII_LOWER(t->codepoint));
+                SWITCH_TO(tag_name_state);
+            } else if (IS_ASCII_LOWER(t->codepoint)) {
+                OPEN_END_TAG_TOKEN(t->codepoint);
+                SWITCH_TO(tag_name_state);
+            } else if (t->codepoint == '>') {
+                EMIT_ERROR("Parse error: Empty end tag.");
+            } else {
+                EMIT_ERROR("Parse error: Invalid end tag.");
+            }
+        }
+        END_STATE();
+
+        BEGIN_STATE(tag_name_state) {
+            if (IS_WHITESPACE(t->codepoint)) {
+                FINISH_TAG_NAME();
+                SWITCH_TO(before_attribute_name_state);
+            } else if (t->codepoint == '/') {
+                FINISH_TAG_NAME();
+                SWITCH_TO(self_closing_start_tag_state);
+            } else if (t->codepoint == '>') {
+                FINISH_TAG_NAME();
+                EMIT_AND_RESUME_IN(data_state);
+            } else if (IS_ASCII_UPPER(t->codepoint)) {
+                APPEND_TO_TAG_TOKEN(TO_ASCII_LOWER(t->codepoint));
+                APPEND_RUN(st_token_tag_append_name_bytes, ST_RUN_TAG_NAME);
+                SWITCH_TO(tag_name_state);
+            } else if (t->codepoint == 0) {
+                EMIT_ERROR("Reached \\0 charachter");
+            } else {
+                APPEND_CURRENT_TO_TAG_TOKEN();
+                APPEND_RUN(st_token_tag_append_name_bytes, ST_RUN_TAG_NAME);
+                SWITCH_TO(tag_name_state);
+            }
+        }
+        END_STATE();
+
+        BEGIN_STATE(rcdata_less_than_sign_state) {
+            switch(t->codepoint) {
+                case '/':
+                    SWITCH_TO(rcdata_end_tag_open_state);
+                default:
+                    OPEN_CHARACTER_TOKEN('<');
+                    EMIT_AND_RECONSUME_IN(rcdata_state);
+            }
+        }
+        END_STATE();
+
+        BEGIN_STATE(rcdata_end_tag_open_state) {
+            EMIT_ERROR("Unsupported: RCDATA end tag open state");
+        }
+        END_STATE();
+
+        // TODO
+
+        BEGIN_STATE(before_attribute_name_state) {
+            if (IS_WHITESPACE(t->codepoint)) {
+                SWITCH_TO(before_attribute_name_state);
+            } else if (t->codepoint == '/') {
+                SWITCH_TO(self_closing_start_tag_state);
+            } else if (t->codepoint == '>') {
+                EMIT_AND_RESUME_IN(data_state);
+            } else if (IS_ASCII_UPPER(t->codepoint)) {
+                OPEN_ATTR();
+                APPEND_TO_ATTR_NAME(TO_ASCII_LOWER(t->codepoint));
+                APPEND_RUN(st_token_attr_append_name_bytes, ST_RUN_ATTR_NAME);
+                SWITCH_TO(attribute_name_state);
+            } else if (t->codepoint == 0) {
+                EMIT_ERROR("Reached \\0-charachter.");
+            } else if (t->codepoint == '"' || t->codepoint == '<' ||
+                    t->codepoint == '\'' || t->codepoint == '=') {
+                EMIT_ERROR("Invalid start of token name");
+            } else {
+                OPEN_ATTR();
+                APPEND_CURRENT_TO_ATTR_NAME();
+                APPEND_RUN(st_token_attr_append_name_bytes, ST_RUN_ATTR_NAME);
+                SWITCH_TO(attribute_name_state);
+            }
+        }
+        END_STATE();
+
+        BEGIN_STATE(attribute_name_state) {
+            if (IS_WHITESPACE(t->codepoint)) {
+                FINISH_ATTR_NAME();
+                SWITCH_TO(after_attribute_name_state);
+            } else if (t->codepoint == '/') {
+                FINISH_ATTR_NAME();
+                SWITCH_TO(self_closing_start_tag_state);
+            } else if (t->codepoint == '=') {
+                FINISH_ATTR_NAME();
+                SWITCH_TO(before_attribute_value_state);
+            } else if (t->codepoint == '>') {
+                FINISH_ATTR_NAME();
+                EMIT_AND_RESUME_IN(data_state);
+            } else if (IS_ASCII_UPPER(t->codepoint)) {
+                APPEND_TO_ATTR_NAME(TO_ASCII_LOWER(t->codepoint));
+                APPEND_RUN(st_token_attr_append_name_bytes, ST_RUN_ATTR_NAME);
+                SWITCH_TO(attribute_name_state);
+            } else if (t->codepoint == 0) {
+                EMIT_ERROR("Reached \\0-character");
+            } else if (t->codepoint == '"' || t->codepoint == '\'' ||
+                    t->codepoint == '>') {
+                EMIT_ERROR("Invalid part of token name");
+            } else {
+                APPEND_CURRENT_TO_ATTR_NAME();
+                APPEND_RUN(st_token_attr_append_name_bytes, ST_RUN_ATTR_NAME);
+                SWITCH_TO(attribute_name_state);
+            }
+        }
+        END_STATE();
+
+        BEGIN_STATE(after_attribute_name_state) {
+            EMIT_ERROR("Unsupported: After attribute name state");
+        }
+        END_STATE();
+
+        BEGIN_STATE(before_attribute_value_state) {
+            if (IS_WHITESPACE(t->codepoint)) {
+                SWITCH_TO(before_attribute_value_state);
+            } else if (t->codepoint == '"') {
+                OPEN_ATTR_VALUE();
+                SWITCH_TO(attribute_value_double_quoted_state);
+            } else if (t->codepoint == '&') {
+                RECONSUME_IN(attribute_value_unquoted_state);
+            } else if (t->codepoint == '\'') {
+                OPEN_ATTR_VALUE();
+                SWITCH_TO(attribute_value_single_quoted_state);
+            } else if (t->codepoint == 0) {
+                EMIT_ERROR("Reached \\0-character");
+            } else if (t->codepoint == '>') {
+                EMIT_ERROR("Premature closing bracked");
+            } else if (t->codepoint == '<' || t->codepoint == '=' ||
+                    t->codepoint == '`') {
+                EMIT_ERROR("Invalid character");
+            } else {
+                APPEND_CURRENT_TO_ATTR_VALUE();
+                SWITCH_TO(attribute_value_unquoted_state);
+            }
+        }
+        END_STATE();
+
+        BEGIN_STATE(attribute_value_double_quoted_state) {
+            if (t->codepoint == '"') {
+                FINISH_ATTR_VALUE();
+                SWITCH_TO(after_attribute_value_quoted_state);
+            } else if (t->codepoint == '&') {
+                OPEN_CHARACTER_REFERENCE(attribute_value_double_quoted_state,
+                        '"');
+                SWITCH_TO(character_reference_in_attribute_value_state);
+            } else if (t->codepoint == 0) {
+                EMIT_ERROR("Reached \\0-character");
+            } else {
+                APPEND_CURRENT_TO_ATTR_VALUE();
+                APPEND_RUN(st_token_attr_append_value_bytes,
+                        ST_RUN_DOUBLE_QUOTED);
+                SWITCH_TO(attribute_value_double_quoted_state);
+            }
+        }
+        END_STATE();
+
+        BEGIN_STATE(attribute_value_single_quoted_state) {
+            if (t->codepoint == '\'') {
+                FINISH_ATTR_VALUE();
+                SWITCH_TO(after_attribute_value_quoted_state);
+            } else if (t->codepoint == '&') {
+                OPEN_CHARACTER_REFERENCE(attribute_value_single_quoted_state,
+                        '\'');
+                SWITCH_TO(character_reference_in_attribute_value_state);
+            } else if (t->codepoint == 0) {
+                EMIT_ERROR("Reached \\0-character");
+            } else {
+                APPEND_CURRENT_TO_ATTR_VALUE();
+                APPEND_RUN(st_token_attr_append_value_bytes,
+                        ST_RUN_SINGLE_QUOTED);
+                SWITCH_TO(attribute_value_single_quoted_state);
+            }
+        }
+        END_STATE();
+
+        BEGIN_STATE(attribute_value_unquoted_state) {
+            EMIT_ERROR("Unsupported: Attribute value (unquoted) state");
+        }
+        END_STATE();
+
+        BEGIN_STATE(character_reference_in_attribute_value_state) {
+            RECONSUME_IN(character_reference_state);
+        }
+        END_STATE();
+
+        BEGIN_STATE(after_attribute_value_quoted_state) {
+            if (IS_WHITESPACE(t->codepoint)) {
+                SWITCH_TO(before_attribute_name_state);
+            } else if (t->codepoint == '/') {
+                SWITCH_TO(self_closing_start_tag_state);
+            } else if (t->codepoint == '>') {
+                EMIT_AND_RESUME_IN(data_state);
+            } else {
+                EMIT_ERROR("Invalid character");
+            }
+        }
+        END_STATE();
+
+        // TODO
+
+        BEGIN_STATE(self_closing_start_tag_state) {
+            EMIT_ERROR("Unsupported: Self closing start tag state");
+        }
+        END_STATE();
+
+        // TODO
+
+        BEGIN_STATE(markup_declaration_open_state) {
+            EMIT_ERROR("Unsupported: Markup declaration open state");
+        }
+        END_STATE();
+
+        // TODO
+
+        // Character references do not stop the tokenizer. What is not a
+        // valid reference is kept as it was written.
+        BEGIN_STATE(character_reference_state) {
+            if (IS_WHITESPACE(t->codepoint) || t->codepoint == '<' ||
+                    t->codepoint == '&' || t->codepoint == t->ref_allowed) {
+                FINISH_REFERENCE_AND_RECONSUME();
+            } else if (t->codepoint == '#') {
+                t->ref_buf[t->ref_len++] = '#';
+                SWITCH_TO(numeric_character_reference_state);
+            } else {
+                t->ref_node = ST_ENTITY_ROOT;
+                t->ref_index = 0;
+                t->ref_match_len = 0;
+                RECONSUME_IN(named_character_reference_state);
+            }
+        }
+        END_STATE();
+
+        BEGIN_STATE(named_character_reference_state) {
+            // Names are ASCII, so the walk through them can go byte by byte
+            // over validated input, and falls back to decoding at the end of
+            // it
+            uint8_t byte = t->codepoint;
+            st_entity_result_t result = st_entity_none;
+
+            if (t->codepoint < 0x80) {
+                result = st_entity_step(&t->ref_node, &t->ref_index, byte,
+                        &t->ref_match);
+            }
+
+            if (result == st_entity_none) {
+                FINISH_REFERENCE_AND_RECONSUME();
+            }
+
+            for (;;) {
+                t->ref_buf[t->ref_len++] = byte;
+                if (result == st_entity_match)
+                    t->ref_match_len = t->ref_len;
+
+                if (t->buf_valid == 0)
+                    break;
+
+                byte = *t->buf;
+                result = st_entity_step(&t->ref_node, &t->ref_index, byte,
+                        &t->ref_match);
+                if (result == st_entity_none) {
+                    FINISH_REFERENCE_AND_RESUME(byte);
+                }
+
+                st_tokenizer_consume(t, 1);
+                COUNT_CODEPOINTS(1);
+            }
+
+            SWITCH_TO(named_character_reference_state);
+        }
+        END_STATE();
+
+        BEGIN_STATE(numeric_character_reference_state) {
+            t->ref_code = 0;
+            if (t->codepoint == 'x' || t->codepoint == 'X') {
+                t->ref_buf[t->ref_len++] = t->codepoint;
+                SWITCH_TO(hexadecimal_character_reference_start_state);
+            } else {
+                RECONSUME_IN(decimal_character_reference_start_state);
+            }
+        }
+        END_STATE();
+
+        BEGIN_STATE(hexadecimal_character_reference_start_state) {
+            if (IS_ASCII_HEX_DIGIT(t->codepoint)) {
+                RECONSUME_IN(hexadecimal_character_reference_state);
+            } else {
+                FINISH_REFERENCE_AND_RECONSUME();
+            }
+        }
+        END_STATE();
+
+        BEGIN_STATE(decimal_character_reference_start_state) {
+            if (IS_ASCII_DIGIT(t->codepoint)) {
+                RECONSUME_IN(decimal_character_reference_state);
+            } else {
+                FINISH_REFERENCE_AND_RECONSUME();
+            }
+        }
+        END_STATE();
+
+        BEGIN_STATE(hexadecimal_character_reference_state) {
+            uint32_t digit;
+
+            if (IS_ASCII_DIGIT(t->codepoint)) {
+                digit = t->codepoint - '0';
+            } else if (IS_ASCII_HEX_DIGIT(t->codepoint)) {
+                digit = (t->codepoint | 0x20) - 'a' + 10;
+            } else if (t->codepoint == ';') {
+                FINISH_REFERENCE_AND_RESUME(0);
+            } else {
+                FINISH_REFERENCE_AND_RECONSUME();
+            }
+
+            // Stop counting once the value is out of range
+            if (t->ref_code <= 0x10FFFF)
+                t->ref_code = t->ref_code * 16 + digit;
+            SWITCH_TO(hexadecimal_character_reference_state);
+        }
+        END_STATE();
+
+        BEGIN_STATE(decimal_character_reference_state) {
+            if (IS_ASCII_DIGIT(t->codepoint)) {
+                if (t->ref_code <= 0x10FFFF)
+                    t->ref_code = t->ref_code * 10 + t->codepoint - '0';
+                SWITCH_TO(decimal_character_reference_state);
+            } else if (t->codepoint == ';') {
+                FINISH_REFERENCE_AND_RESUME(0);
+            } else {
+                FINISH_REFERENCE_AND_RECONSUME();
+            }
+        }
+        END_STATE();
+
+
+        default:
+        unsupported_state: ST_UNUSED_LABEL;
+            EMIT_ERROR("Unsupported state.");
+
+    }
+
+    return st_err;
+}
@@ -0,0 +1,259 @@
+#!/usr/bin/env python3
+#
+# Generates atom.h and atom.c, the interned element and attribute names known
+# to the tokenizer and a perfect hash table to look them up with.
+#
+# The hash is 32-bit FNV-1a over the lowercased UTF-8 bytes of a name, which
+# the tokenizer computes incrementally while it appends to the name. The table
+# uses hash and displace: the low bits of the hash pick a bucket, and the
+# bucket's displacement is mixed into the high bits to pick a slot. The
+# displacements are searched for here so that no two names share a slot.
+#
+# Usage: tools/gen_atoms.py [output directory]
+#
+
+import os
+import sys
+
+# Standard HTML elements, and the obsolete ones the parsing algorithm knows
+ELEMENTS = """
+a abbr acronym address applet area article aside audio b base basefont bdi bdo
+bgsound big blink blockquote body br button canvas caption center cite code col
+colgroup data datalist dd del details dfn dialog dir div dl dt em embed fieldset
+figcaption figure font footer form frame frameset h1 h2 h3 h4 h5 h6 head header
+hgroup hr html i iframe image img input ins isindex kbd keygen label legend li
+link listing main map mark marquee math menu menuitem meta meter nav nobr
+noembed noframes noscript object ol optgroup option output p param picture
+plaintext pre progress q rb rp rt rtc ruby s samp script search section select
+slot small source spacer span strike strong style sub summary sup svg table
+tbody td template textarea tfoot th thead time title tr track tt u ul var video
+wbr xmp
+""".split()
+
+# Common attribute names, sharing the namespace with the elements
+ATTRIBUTES = """
+accept accept-charset accesskey action align allow alt aria-describedby
+aria-expanded aria-hidden aria-label aria-labelledby async autocomplete
+autofocus autoplay background bgcolor border charset checked cite class color
+cols colspan content contenteditable controls coords crossorigin data datetime
+decoding default defer dir dirname disabled download draggable enctype
+enterkeyhint face for form formaction formenctype formmethod formnovalidate
+formtarget headers height hidden high href hreflang http-equiv id integrity
+inputmode is ismap itemid itemprop itemref itemscope itemtype kind label lang
+language list loading loop low max maxlength media method min minlength
+multiple muted name nonce novalidate onblur onchange onclick onerror onfocus
+oninput onkeydown onkeyup onload onmouseout onmouseover onsubmit open optimum
+pattern ping placeholder playsinline poster preload property readonly
+referrerpolicy rel required rev reversed role rows rowspan sandbox scope
+selected shape size sizes slot span spellcheck src srcdoc srclang srcset start
+step style summary tabindex target title translate type usemap valign value
+width wrap xmlns
+""".split()
+
+FNV_OFFSET = 2166136261
+FNV_PRIME = 16777619
+GOLDEN = 0x9E3779B1
+
+
+def fnv1a(name):
+    h = FNV_OFFSET
+    for b in name.encode():
+        h = ((h ^ b) * FNV_PRIME) & 0xFFFFFFFF
+    return h
+
+
+def slot(h, disp, bits):
+    return ((((h >> 8) ^ disp) * GOLDEN) & 0xFFFFFFFF) >> (32 - bits)
+
+
+def build(names):
+    # Table with a load factor of at most 1/2, and a bucket per two names
+    bits = max(4, (2 * len(names) - 1).bit_length())
+    buckets = 1 << max(2, (len(names) // 2 - 1).bit_length())
+
+    groups = [[] for _ in range(buckets)]
+    for atom, name in enumerate(names, 1):
+        groups[fnv1a(name) & (buckets - 1)].append(atom)
+
+    slots = [0] * (1 << bits)
+    disps = [0] * buckets
+
+    # Place the largest buckets first, while the table is still empty
+    order = sorted(range(buckets), key=lambda b: -len(groups[b]))
+    for b in order:
+        if not groups[b]:
+            continue
+        for disp in range(1 << 16):
+            wanted = [slot(fnv1a(names[a - 1]), disp, bits) for a in groups[b]]
+            if len(set(wanted)) == len(wanted) and \
+                    all(slots[s] == 0 for s in wanted):
+                break
+        else:
+            sys.exit("no displacement found for bucket %d" % b)
+        disps[b] = disp
+        for a, s in zip(groups[b], wanted):
+            slots[s] = a
+
+    return bits, buckets, slots, disps
+
+
+def ident(name):
+    return "st_atom_" + name.replace("-", "_")
+
+
+def table(values, per_line, width):
+    lines = []
+    for i in range(0, len(values), per_line):
+        lines.append("    " + " ".join(
+            "%*d," % (width, v) for v in values[i:i + per_line]))
+    return "\n".join(lines)
+
+
+def main():
+    out = sys.argv[1] if len(sys.argv) > 1 else "."
+    assert len(set(ELEMENTS)) == len(ELEMENTS)
+    assert len(set(ATTRIBUTES)) == len(ATTRIBUTES)
+    names = ELEMENTS + [n for n in ATTRIBUTES if n not in ELEMENTS]
+
+    # Names that would clash with the other identifiers of the atom API
+    reserved = {"unknown", "count", "lookup", "lookup_hash", "to_string",
+                "hash"}
+    assert not reserved.intersection(names)
+
+    bits, buckets, slots, disps = build(names)
+
+    header = []
+    header.append("// Generated by tools/gen_atoms.py, do not edit")
+    header.append("#ifndef atom_h")
+    header.append("#define atom_h")
+    header.append("")
+    header.append("#include <stdlib.h>")
+    header.append("#include <stdint.h>")
+    header.append("")
+    header.append("// Interned names. Names without an atom are st_atom_unknown.")
+    header.append("typedef enum {")
+    header.append("    st_atom_unknown = 0,")
+    for name in names:
+        header.append("    %s," % ident(name))
+    header.append("    st_atom_count,")
+    header.append("} st_atom_t;")
+    header.append("")
+    header.append("// Incremental 32-bit FNV-1a hash of the lowercased UTF-8 bytes of a name")
+    header.append("#define ST_ATOM_HASH_INIT %uu" % FNV_OFFSET)
+    header.append("#define ST_ATOM_HASH_UPDATE(hash, byte) \\")
+    header.append("    (((hash) ^ (uint8_t)(byte)) * %uu)" % FNV_PRIME)
+    header.append("")
+    header.append("// Look up the atom of a lowercased name")
+    header.append("st_atom_t st_atom_lookup(const uint8_t *name, size_t len);")
+    header.append("")
+    header.append("// Look up the atom of a lowercased name with an already computed hash")
+    header.append("st_atom_t st_atom_lookup_hash(uint32_t hash,")
+    header.append("        const uint8_t *name, size_t len);")
+    header.append("")
+    header.append("// Get the name of an atom, NULL for st_atom_unknown")
+    header.append("const char *st_atom_to_string(st_atom_t atom, size_t *len);")
+    header.append("")
+    header.append("// Get the hash of the name of an atom")
+    header.append("uint32_t st_atom_hash(st_atom_t atom);")
+    header.append("")
+    header.append("#endif")
+
+    pool = []
+    offsets = []
+    for name in names:
+        offsets.append(sum(len(n) + 1 for n in pool))
+        pool.append(name)
+
+    source = []
+    source.append("// Generated by tools/gen_atoms.py, do not edit")
+    source.append('#include "atom.h"')
+    source.append("")
+    source.append("#include <string.h>")
+    source.append("")
+    source.append("#define ST_ATOM_TABLE_BITS %d" % bits)
+    source.append("#define ST_ATOM_BUCKETS %d" % buckets)
+    source.append("")
+    source.append("// All names, NUL-separated")
+    source.append("static const char st_atom_pool[] =")
+    for name in pool:
+        source.append('    "%s\\0"' % name)
+    source.append("    ;")
+    source.append("")
+    source.append("// Offset of each name in the pool, by atom")
+    source.append("static const uint16_t st_atom_offsets[st_atom_count] = {")
+    source.append(table([0] + offsets, 10, 5))
+    source.append("};")
+    source.append("")
+    source.append("// Length of each name, by atom")
+    source.append("static const uint8_t st_atom_lengths[st_atom_count] = {")
+    source.append(table([0] + [len(n) for n in names], 12, 3))
+    source.append("};")
+    source.append("")
+    source.append("// Hash of each name, by atom")
+    source.append("static const uint32_t st_atom_hashes[st_atom_count] = {")
+    source.append(table([0] + [fnv1a(n) for n in names], 6, 10))
+    source.append("};")
+    source.append("")
+    source.append("// Displacement of each bucket")
+    source.append("static const uint16_t st_atom_displacements[ST_ATOM_BUCKETS] = {")
+    source.append(table(disps, 10, 5))
+    source.append("};")
+    source.append("")
+    source.append("// The atom in each slot of the table")
+    source.append("static const uint16_t st_atom_slots[1 << ST_ATOM_TABLE_BITS] = {")
+    source.append(table(slots, 10, 5))
+    source.append("};")
+    source.append("""
+st_atom_t st_atom_lookup_hash(uint32_t hash, const uint8_t *name, size_t len)
+{
+    uint32_t disp = st_atom_displacements[hash & (ST_ATOM_BUCKETS - 1)];
+    uint32_t slot = ((hash >> 8) ^ disp) * %uu;
+
+    st_atom_t atom = st_atom_slots[slot >> (32 - ST_ATOM_TABLE_BITS)];
+
+    // The slot holds the only name that can have this hash, check that it is
+    // the one we are looking for
+    if (atom == st_atom_unknown || st_atom_lengths[atom] != len ||
+            memcmp(st_atom_pool + st_atom_offsets[atom], name, len) != 0)
+        return st_atom_unknown;
+
+    return atom;
+}
+
+st_atom_t st_atom_lookup(const uint8_t *name, size_t len)
+{
+    uint32_t hash = ST_ATOM_HASH_INIT;
+
+    for (size_t i = 0; i < len; i++)
+        hash = ST_ATOM_HASH_UPDATE(hash, name[i]);
+
+    return st_atom_lookup_hash(hash, name, len);
+}
+
+const char *st_atom_to_string(st_atom_t atom, size_t *len)
+{
+    if (atom <= st_atom_unknown || atom >= st_atom_count)
+        return NULL;
+
+    if (len != NULL)
+        *len = st_atom_lengths[atom];
+
+    return st_atom_pool + st_atom_offsets[atom];
+}
+
+uint32_t st_atom_hash(st_atom_t atom)
+{
+    if (atom <= st_atom_unknown || atom >= st_atom_count)
+        return ST_ATOM_HASH_INIT;
+
+    return st_atom_hashes[atom];
+}""" % GOLDEN)
+
+    with open(os.path.join(out, "atom.h"), "w") as f:
+        f.write("\n".join(header) + "\n")
+    with open(os.path.join(out, "atom.c"), "w") as f:
+        f.write("\n".join(source) + "\n")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,275 @@
+#!/usr/bin/env python3
+#
+# Generates encoding.h and encoding.c, the encodings the transcoder converts
+# to UTF-8, the labels they are known by, and the tables of the single-byte
+# ones.
+#
+# The names and labels are those of the WHATWG Encoding Standard. The
+# single-byte tables hold the codepoint of each byte from 0x80 up, and are
+# taken from the Python codecs with the fixes the standard makes to them:
+# bytes that a Windows code page leaves undefined in 0x80 to 0x9F decode to
+# the C1 control of the same value, and the other undefined bytes decode to
+# U+FFFD. As in the standard, ISO-8859-1 and ASCII are decoded as
+# windows-1252, and ISO-8859-9 as windows-1254.
+#
+# Usage: tools/gen_encodings.py [output directory]
+#
+
+import os
+import sys
+
+# Encodings that are not single-byte, in the order of the enum
+MULTI_BYTE = [
+    ("utf8", "UTF-8", """
+        unicode-1-1-utf-8 unicode11utf8 unicode20utf8 utf-8 utf8
+        x-unicode20utf8"""),
+    ("utf16le", "UTF-16LE", """
+        csunicode iso-10646-ucs-2 ucs-2 unicode unicodefeff utf-16
+        utf-16le"""),
+    ("utf16be", "UTF-16BE", """
+        unicodefffe utf-16be"""),
+]
+
+# Single-byte encodings, with the Python codec their table comes from
+SINGLE_BYTE = [
+    ("ibm866", "IBM866", "cp866", """
+        866 cp866 csibm866 ibm866"""),
+    ("iso_8859_2", "ISO-8859-2", "iso8859_2", """
+        csisolatin2 iso-8859-2 iso-ir-101 iso8859-2 iso88592 iso_8859-2
+        iso_8859-2:1987 l2 latin2"""),
+    ("iso_8859_3", "ISO-8859-3", "iso8859_3", """
+        csisolatin3 iso-8859-3 iso-ir-109 iso8859-3 iso88593 iso_8859-3
+        iso_8859-3:1988 l3 latin3"""),
+    ("iso_8859_4", "ISO-8859-4", "iso8859_4", """
+        csisolatin4 iso-8859-4 iso-ir-110 iso8859-4 iso88594 iso_8859-4
+        iso_8859-4:1988 l4 latin4"""),
+    ("iso_8859_5", "ISO-8859-5", "iso8859_5", """
+        csisolatincyrillic cyrillic iso-8859-5 iso-ir-144 iso8859-5 iso88595
+        iso_8859-5 iso_8859-5:1988"""),
+    ("iso_8859_6", "ISO-8859-6", "iso8859_6", """
+        arabic asmo-708 csiso88596e csiso88596i csisolatinarabic ecma-114
+        iso-8859-6 iso-8859-6-e iso-8859-6-i iso-ir-127 iso8859-6 iso88596
+        iso_8859-6 iso_8859-6:1987"""),
+    ("iso_8859_7", "ISO-8859-7", "iso8859_7", """
+        csisolatingreek ecma-118 elot_928 greek greek8 iso-8859-7 iso-ir-126
+        iso8859-7 iso88597 iso_8859-7 iso_8859-7:1987 sun_eu_greek"""),
+    ("iso_8859_8", "ISO-8859-8", "iso8859_8", """
+        csiso88598e csiso88598i csisolatinhebrew hebrew iso-8859-8
+        iso-8859-8-e iso-8859-8-i iso-ir-138 iso8859-8 iso88598 iso_8859-8
+        iso_8859-8:1988 logical visual"""),
+    ("iso_8859_10", "ISO-8859-10", "iso8859_10", """
+        csisolatin6 iso-8859-10 iso-ir-157 iso8859-10 iso885910 l6 latin6"""),
+    ("iso_8859_13", "ISO-8859-13", "iso8859_13", """
+        iso-8859-13 iso8859-13 iso885913"""),
+    ("iso_8859_14", "ISO-8859-14", "iso8859_14", """
+        iso-8859-14 iso8859-14 iso885914"""),
+    ("iso_8859_15", "ISO-8859-15", "iso8859_15", """
+        csisolatin9 iso-8859-15 iso8859-15 iso885915 iso_8859-15 l9"""),
+    ("iso_8859_16", "ISO-8859-16", "iso8859_16", """
+        iso-8859-16"""),
+    ("koi8_r", "KOI8-R", "koi8_r", """
+        cskoi8r koi koi8 koi8-r koi8_r"""),
+    ("macintosh", "macintosh", "mac_roman", """
+        csmacintosh mac macintosh x-mac-roman"""),
+    ("windows_874", "windows-874", "cp874", """
+        dos-874 iso-8859-11 iso8859-11 iso885911 tis-620 windows-874"""),
+    ("windows_1250", "windows-1250", "cp1250", """
+        cp1250 windows-1250 x-cp1250"""),
+    ("windows_1251", "windows-1251", "cp1251", """
+        cp1251 windows-1251 x-cp1251"""),
+    ("windows_1252", "windows-1252", "cp1252", """
+        ansi_x3.4-1968 ascii cp1252 cp819 csisolatin1 ibm819 iso-8859-1
+        iso-ir-100 iso8859-1 iso88591 iso_8859-1 iso_8859-1:1987 l1 latin1
+        us-ascii windows-1252 x-cp1252"""),
+    ("windows_1253", "windows-1253", "cp1253", """
+        cp1253 windows-1253 x-cp1253"""),
+    ("windows_1254", "windows-1254", "cp1254", """
+        cp1254 csisolatin5 iso-8859-9 iso-ir-148 iso8859-9 iso88599
+        iso_8859-9 iso_8859-9:1989 l5 latin5 windows-1254 x-cp1254"""),
+    ("windows_1255", "windows-1255", "cp1255", """
+        cp1255 windows-1255 x-cp1255"""),
+    ("windows_1256", "windows-1256", "cp1256", """
+        cp1256 windows-1256 x-cp1256"""),
+    ("windows_1257", "windows-1257", "cp1257", """
+        cp1257 windows-1257 x-cp1257"""),
+    ("windows_1258", "windows-1258", "cp1258", """
+        cp1258 windows-1258 x-cp1258"""),
+]
+
+# Bytes the Python codecs get wrong, by the standard
+OVERRIDES = {
+    "cp1255": {0xCA: 0x05BA},
+}
+
+
+def high_half(codec, name):
+    codepoints = []
+    for b in range(0x80, 0x100):
+        try:
+            cp = ord(bytes([b]).decode(codec))
+        except UnicodeDecodeError:
+            if name.startswith("windows-") and b < 0xA0:
+                cp = b
+            else:
+                cp = 0xFFFD
+        codepoints.append(OVERRIDES.get(codec, {}).get(b, cp))
+    assert all(cp <= 0xFFFF for cp in codepoints)
+    return codepoints
+
+
+def main():
+    out = sys.argv[1] if len(sys.argv) > 1 else "."
+
+    encodings = [(e, n, l.split()) for e, n, l in MULTI_BYTE]
+    encodings += [(e, n, l.split()) for e, n, _, l in SINGLE_BYTE]
+    tables = [high_half(c, n) for _, n, c, _ in SINGLE_BYTE]
+
+    labels = sorted((label, i) for i, (_, _, ls) in enumerate(encodings)
+                    for label in ls)
+    assert len(set(l for l, _ in labels)) == len(labels)
+    max_label = max(len(l) for l, _ in labels)
+
+    header = []
+    header.append("// Generated by tools/gen_encodings.py, do not edit")
+    header.append("#ifndef encoding_h")
+    header.append("#define encoding_h")
+    header.append("")
+    header.append('#include "styre.h"')
+    header.append("")
+    header.append("#include <stdlib.h>")
+    header.append("#include <stdint.h>")
+    header.append("")
+    header.append("// Encodings the input can be transcoded from, by their names in the")
+    header.append("// Encoding Standard. The single-byte ones come after")
+    header.append("// ST_ENCODING_FIRST_SINGLE_BYTE.")
+    header.append("typedef enum {")
+    for i, (enum, name, _) in enumerate(encodings):
+        header.append("    %-36s// %s" % (
+            "st_encoding_%s%s," % (enum, " = 0" if i == 0 else ""), name))
+    header.append("} st_encoding_t;")
+    header.append("")
+    header.append("#define ST_ENCODING_FIRST_SINGLE_BYTE st_encoding_%s" %
+                  SINGLE_BYTE[0][0])
+    header.append("#define ST_ENCODING_COUNT %d" % len(encodings))
+    header.append("")
+    header.append("// Find the encoding with a label, such as the charset of a Content-Type")
+    header.append("// header. Case and surrounding whitespace are ignored. Returns")
+    header.append("// st_not_found for labels that are not known.")
+    header.append("st_status st_encoding_lookup(const char *label, size_t len,")
+    header.append("        st_encoding_t *encoding);")
+    header.append("")
+    header.append("// Get the name of an encoding, NULL for values that are not encodings")
+    header.append("const char *st_encoding_name(st_encoding_t encoding);")
+    header.append("")
+    header.append("// Get the codepoints of bytes 0x80 to 0xFF of a single-byte encoding,")
+    header.append("// U+FFFD for bytes it does not use, or NULL for the other encodings")
+    header.append("const uint16_t *st_encoding_high_half(st_encoding_t encoding);")
+    header.append("")
+    header.append("#endif")
+
+    source = []
+    source.append("// Generated by tools/gen_encodings.py, do not edit")
+    source.append('#include "encoding.h"')
+    source.append("")
+    source.append("#include <string.h>")
+    source.append("")
+    source.append("// Length of the longest label")
+    source.append("#define ST_ENCODING_MAX_LABEL %d" % max_label)
+    source.append("")
+    source.append("static const char *st_encoding_names[ST_ENCODING_COUNT] = {")
+    for _, name, _ in encodings:
+        source.append('    "%s",' % name)
+    source.append("};")
+    source.append("")
+    source.append("typedef struct {")
+    source.append("    const char *label;")
+    source.append("    st_encoding_t encoding;")
+    source.append("} st_encoding_label_t;")
+    source.append("")
+    source.append("// All labels, sorted")
+    source.append("static const st_encoding_label_t st_encoding_labels[%d] = {" %
+                  len(labels))
+    for label, i in labels:
+        source.append('    {"%s", st_encoding_%s},' % (label, encodings[i][0]))
+    source.append("};")
+    source.append("")
+    source.append("// Codepoints of bytes 0x80 to 0xFF of the single-byte encodings")
+    source.append("static const uint16_t st_encoding_tables[%d][128] = {" %
+                  len(tables))
+    for (enum, name, _, _), table in zip(SINGLE_BYTE, tables):
+        source.append("    [st_encoding_%s - ST_ENCODING_FIRST_SINGLE_BYTE] = {"
+                      % enum)
+        for i in range(0, 128, 8):
+            source.append("        " + " ".join(
+                "0x%04X," % cp for cp in table[i:i + 8]))
+        source.append("    },")
+    source.append("};")
+    source.append("""
+static int st_encoding_compare(const void *key, const void *entry)
+{
+    return strcmp(key, ((const st_encoding_label_t *)entry)->label);
+}
+
+static int st_encoding_space(char c)
+{
+    return c == '\\t' || c == '\\n' || c == '\\f' || c == '\\r' || c == ' ';
+}
+
+st_status st_encoding_lookup(const char *label, size_t len,
+        st_encoding_t *encoding)
+{
+    char key[ST_ENCODING_MAX_LABEL + 1];
+    const st_encoding_label_t *found;
+
+    while (len > 0 && st_encoding_space(label[0])) {
+        label++;
+        len--;
+    }
+    while (len > 0 && st_encoding_space(label[len - 1]))
+        len--;
+
+    if (len == 0 || len > ST_ENCODING_MAX_LABEL)
+        return st_not_found;
+
+    for (size_t i = 0; i < len; i++) {
+        char c = label[i];
+        key[i] = (c >= 'A' && c <= 'Z') ? c + 0x20 : c;
+    }
+    key[len] = '\\0';
+
+    found = bsearch(key, st_encoding_labels,
+            sizeof(st_encoding_labels) / sizeof(st_encoding_labels[0]),
+            sizeof(st_encoding_labels[0]), &st_encoding_compare);
+    if (found == NULL)
+        return st_not_found;
+
+    *encoding = found->encoding;
+
+    return st_ok;
+}
+
+const char *st_encoding_name(st_encoding_t encoding)
+{
+    if ((unsigned)encoding >= ST_ENCODING_COUNT)
+        return NULL;
+
+    return st_encoding_names[encoding];
+}
+
+const uint16_t *st_encoding_high_half(st_encoding_t encoding)
+{
+    if (encoding < ST_ENCODING_FIRST_SINGLE_BYTE
+            || (unsigned)encoding >= ST_ENCODING_COUNT)
+        return NULL;
+
+    return st_encoding_tables[encoding - ST_ENCODING_FIRST_SINGLE_BYTE];
+}""")
+
+    with open(os.path.join(out, "encoding.h"), "w") as f:
+        f.write("\n".join(header) + "\n")
+    with open(os.path.join(out, "encoding.c"), "w") as f:
+        f.write("\n".join(source) + "\n")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,278 @@
+#!/usr/bin/env python3
+#
+# Generates entity.h and entity.c, the named character references of HTML and
+# a DAFSA to match them with, one byte at a time.
+#
+# The names are put in a trie, which is then minimized by merging the nodes
+# that accept the same suffixes. The result is a directed acyclic word graph
+# where every node is a run of edges, one per byte, and the last edge of a run
+# is flagged. Walking it from the root gives the number of the name that was
+# matched as well: every edge carries the number of names that are reached
+# through the edges before it, and entering a node that ends a name counts
+# that name. Names are numbered in sorted order, which is also the order of
+# the table of their codepoints.
+#
+# Usage: tools/gen_entities.py [output directory]
+#
+
+import os
+import sys
+from html.entities import html5
+
+LAST = 1
+FINAL = 2
+LEAF = 4
+NONE = 0xFFFF
+
+
+class Node:
+    def __init__(self):
+        self.final = False
+        self.edges = {}
+        self.words = 0
+
+
+def build(names):
+    root = Node()
+    for name in names:
+        node = root
+        for b in name.encode():
+            node = node.edges.setdefault(b, Node())
+        node.final = True
+
+    # Merge nodes with the same finality and the same merged children,
+    # bottom up
+    unique = {}
+
+    def merge(node):
+        for b in node.edges:
+            node.edges[b] = merge(node.edges[b])
+        key = (node.final,
+               tuple((b, id(n)) for b, n in sorted(node.edges.items())))
+        if key not in unique:
+            node.words = int(node.final) + \
+                sum(n.words for n in node.edges.values())
+            unique[key] = node
+        return unique[key]
+
+    return merge(root)
+
+
+def layout(root):
+    # Every node with edges gets a run in the edge table, the root first
+    offsets = {}
+    order = []
+    queue = [root]
+    while queue:
+        node = queue.pop(0)
+        if id(node) in offsets or not node.edges:
+            continue
+        offsets[id(node)] = sum(len(n.edges) for n in order)
+        order.append(node)
+        queue.extend(n for _, n in sorted(node.edges.items()))
+
+    edges = []
+    for node in order:
+        skip = 0
+        items = sorted(node.edges.items())
+        for i, (b, target) in enumerate(items):
+            flags = 0
+            if i == len(items) - 1:
+                flags |= LAST
+            if target.final:
+                flags |= FINAL
+            if not target.edges:
+                flags |= LEAF
+            edges.append((b, flags, offsets.get(id(target), NONE), skip))
+            skip += target.words
+
+    assert len(edges) < NONE
+    return edges
+
+
+def walk(edges, name):
+    # The same walk as st_entity_step, to check the tables
+    node, index, match = 0, 0, None
+    for b in name.encode():
+        if node == NONE:
+            return None
+        while True:
+            byte, flags, target, skip = edges[node]
+            if byte == b:
+                break
+            if flags & LAST:
+                return None
+            node += 1
+        index += skip
+        match = None
+        if flags & FINAL:
+            match = index
+            index += 1
+        node = NONE if flags & LEAF else target
+    return match
+
+
+def table(values, per_line, width):
+    lines = []
+    for i in range(0, len(values), per_line):
+        lines.append("    " + " ".join(
+            "%*d," % (width, v) for v in values[i:i + per_line]))
+    return "\n".join(lines)
+
+
+def main():
+    out = sys.argv[1] if len(sys.argv) > 1 else "."
+    names = sorted(html5, key=lambda n: n.encode())
+
+    root = build(names)
+    edges = layout(root)
+
+    for i, name in enumerate(names):
+        assert walk(edges, name) == i
+
+    # Edges that leave the root, by byte
+    root_edges = [255] * 128
+    i = 0
+    while True:
+        root_edges[edges[i][0]] = i
+        if edges[i][1] & LAST:
+            break
+        i += 1
+    assert i < 255
+
+    first = [ord(html5[n][0]) for n in names]
+    second = [ord(html5[n][1]) if len(html5[n]) > 1 else 0 for n in names]
+    assert all(len(html5[n]) <= 2 for n in names)
+    assert max(second) <= 0xFFFF
+
+    header = []
+    header.append("// Generated by tools/gen_entities.py, do not edit")
+    header.append("#ifndef entity_h")
+    header.append("#define entity_h")
+    header.append("")
+    header.append("#include <stdlib.h>")
+    header.append("#include <stdint.h>")
+    header.append("")
+    header.append("// Number of named character references")
+    header.append("#define ST_ENTITY_COUNT %d" % len(names))
+    header.append("")
+    header.append("// Length of the longest name, without the ampersand")
+    header.append("#define ST_ENTITY_MAX_LENGTH %d" %
+                  max(len(n) for n in names))
+    header.append("")
+    header.append("// Node a walk starts at, and the node past the end of a name that no")
+    header.append("// other name continues")
+    header.append("#define ST_ENTITY_ROOT 0")
+    header.append("#define ST_ENTITY_END %d" % NONE)
+    header.append("")
+    header.append("// Result of a step")
+    header.append("typedef enum {")
+    header.append("    st_entity_none = 0,             // No name continues with the byte")
+    header.append("    st_entity_prefix,               // The bytes so far start a name")
+    header.append("    st_entity_match,                // The bytes so far are a name")
+    header.append("} st_entity_result_t;")
+    header.append("")
+    header.append("// Walk one byte of a name, the one after the ampersand first. Node and")
+    header.append("// index start at ST_ENTITY_ROOT and 0, and are left alone when no name")
+    header.append("// continues with the byte. On a match, match is set to the number of the")
+    header.append("// name.")
+    header.append("st_entity_result_t st_entity_step(uint32_t *node, uint32_t *index,")
+    header.append("        uint8_t byte, uint32_t *match);")
+    header.append("")
+    header.append("// Get the one or two codepoints of a name, returns how many there are")
+    header.append("size_t st_entity_codepoints(uint32_t index, uint32_t codepoints[2]);")
+    header.append("")
+    header.append("#endif")
+
+    source = []
+    source.append("// Generated by tools/gen_entities.py, do not edit")
+    source.append('#include "entity.h"')
+    source.append("")
+    source.append("#define ST_ENTITY_LAST %d       // Last edge of a node" % LAST)
+    source.append("#define ST_ENTITY_FINAL %d      // The edge ends a name" % FINAL)
+    source.append("#define ST_ENTITY_LEAF %d       // No edges leave the target" % LEAF)
+    source.append("")
+    source.append("typedef struct {")
+    source.append("    uint8_t byte;                   // Byte of the name")
+    source.append("    uint8_t flags;")
+    source.append("    uint16_t node;                  // First edge of the target")
+    source.append("    uint16_t skip;                  // Names reached through the edges")
+    source.append("                                    // before this one")
+    source.append("} st_entity_edge_t;")
+    source.append("")
+    source.append("// The edges of all nodes, the root first")
+    source.append("static const st_entity_edge_t st_entity_edges[%d] = {" %
+                  len(edges))
+    for i in range(0, len(edges), 3):
+        source.append("    " + " ".join(
+            "{%3d, %d, %5d, %4d}," % e for e in edges[i:i + 3]))
+    source.append("};")
+    source.append("")
+    source.append("// Edge that leaves the root with each ASCII byte, 255 for none")
+    source.append("static const uint8_t st_entity_root[128] = {")
+    source.append(table(root_edges, 12, 3))
+    source.append("};")
+    source.append("")
+    source.append("// Codepoints of each name")
+    source.append("static const uint32_t st_entity_first[ST_ENTITY_COUNT] = {")
+    source.append(table(first, 8, 6))
+    source.append("};")
+    source.append("")
+    source.append("static const uint16_t st_entity_second[ST_ENTITY_COUNT] = {")
+    source.append(table(second, 10, 5))
+    source.append("};")
+    source.append("""
+st_entity_result_t st_entity_step(uint32_t *node, uint32_t *index,
+        uint8_t byte, uint32_t *match)
+{
+    const st_entity_edge_t *edge;
+    uint32_t i = *node;
+
+    if (i == ST_ENTITY_ROOT) {
+        if (byte >= 128 || st_entity_root[byte] == 255)
+            return st_entity_none;
+        i = st_entity_root[byte];
+    } else if (i == ST_ENTITY_END) {
+        return st_entity_none;
+    }
+
+    // The edges of a node are sorted by byte
+    for (;; i++) {
+        edge = &st_entity_edges[i];
+        if (edge->byte == byte)
+            break;
+        if (edge->byte > byte || (edge->flags & ST_ENTITY_LAST))
+            return st_entity_none;
+    }
+
+    *index += edge->skip;
+    *node = (edge->flags & ST_ENTITY_LEAF) ? ST_ENTITY_END : edge->node;
+
+    if (!(edge->flags & ST_ENTITY_FINAL))
+        return st_entity_prefix;
+
+    // The name ends here, and the names that continue it come after it
+    *match = (*index)++;
+
+    return st_entity_match;
+}
+
+size_t st_entity_codepoints(uint32_t index, uint32_t codepoints[2])
+{
+    if (index >= ST_ENTITY_COUNT)
+        return 0;
+
+    codepoints[0] = st_entity_first[index];
+    codepoints[1] = st_entity_second[index];
+
+    return codepoints[1] != 0 ? 2 : 1;
+}""")
+
+    with open(os.path.join(out, "entity.h"), "w") as f:
+        f.write("\n".join(header) + "\n")
+    with open(os.path.join(out, "entity.c"), "w") as f:
+        f.write("\n".join(source) + "\n")
+
+
+if __name__ == "__main__":
+    main()
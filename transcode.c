@@ -0,0 +1,415 @@
+#include "transcode.h"
+
+#include <string.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#if defined(__GNUC__) || defined(__clang__)
+#define ST_TRANSCODE_X86
+#include <immintrin.h>
+#endif
+#endif
+
+// Converts from in[*i] to out[*o], and moves both past what was converted
+typedef void (*st_transcode_fn)(const st_transcoder_t *tc,
+        const uint8_t *in, size_t len, size_t *i,
+        uint8_t *out, size_t out_len, size_t *o);
+
+struct st_transcoder {
+    st_encoding_t encoding;                 // Encoding of the input
+    st_transcode_fn kernel;                 // Converts the bulk of the input
+
+    uint8_t utf8[128][4];                   // UTF-8 of bytes 0x80 to 0xFF of
+                                            // a single-byte encoding, with
+                                            // the length in the last byte
+
+    uint8_t pending[4];                     // Start of a UTF-16 character cut
+    size_t pending_len;                     // by the end of the input
+
+    st_allocator_t allocator;               // Allocator of the transcoder
+};
+
+// Encode a codepoint as UTF-8, returns the number of bytes
+static inline size_t st_transcode_utf8(uint32_t cp, uint8_t *out)
+{
+    if (cp < 0x80) {
+        out[0] = cp;
+        return 1;
+    } else if (cp < 0x800) {
+        out[0] = 0xC0 | (cp >> 6);
+        out[1] = 0x80 | (cp & 0x3F);
+        return 2;
+    } else if (cp < 0x10000) {
+        out[0] = 0xE0 | (cp >> 12);
+        out[1] = 0x80 | ((cp >> 6) & 0x3F);
+        out[2] = 0x80 | (cp & 0x3F);
+        return 3;
+    }
+
+    out[0] = 0xF0 | (cp >> 18);
+    out[1] = 0x80 | ((cp >> 12) & 0x3F);
+    out[2] = 0x80 | ((cp >> 6) & 0x3F);
+    out[3] = 0x80 | (cp & 0x3F);
+    return 4;
+}
+
+//
+// UTF-8, copied as it is. The tokenizer validates it.
+//
+static void st_transcode_copy(const st_transcoder_t *tc,
+        const uint8_t *in, size_t len, size_t *i,
+        uint8_t *out, size_t out_len, size_t *o)
+{
+    size_t n = len - *i;
+
+    if (n > out_len - *o)
+        n = out_len - *o;
+
+    memcpy(out + *o, in + *i, n);
+    *i += n;
+    *o += n;
+}
+
+//
+// Single-byte encodings, scalar fallback
+//
+
+// Convert one byte, out must have room for four
+#define ST_TRANSCODE_BYTE(tc, b, out, o)                                       \
+    do {                                                                       \
+        if ((b) < 0x80) {                                                      \
+            (out)[(o)++] = (b);                                                \
+        } else {                                                               \
+            const uint8_t *u = (tc)->utf8[(b) - 0x80];                         \
+            memcpy((out) + (o), u, 4);                                         \
+            (o) += u[3];                                                       \
+        }                                                                      \
+    } while (0)
+
+static void st_transcode_single_scalar(const st_transcoder_t *tc,
+        const uint8_t *in, size_t len, size_t *i,
+        uint8_t *out, size_t out_len, size_t *o)
+{
+    size_t ii = *i, oo = *o;
+
+    while (ii < len && out_len - oo >= ST_TRANSCODE_MIN_OUT) {
+        uint8_t b = in[ii++];
+        ST_TRANSCODE_BYTE(tc, b, out, oo);
+    }
+
+    *i = ii;
+    *o = oo;
+}
+
+//
+// UTF-16, scalar fallback
+//
+
+static inline uint32_t st_transcode_unit(const uint8_t *in, int be)
+{
+    return be ? (uint32_t)in[0] << 8 | in[1] : (uint32_t)in[1] << 8 | in[0];
+}
+
+// Convert the character at the start of the input, out must have room for
+// four bytes. Returns the bytes of input used, or 0 when the input ends
+// before the character does.
+static inline size_t st_transcode_utf16_char(const uint8_t *in, size_t len,
+        int be, uint8_t *out, size_t *o)
+{
+    uint32_t unit, low;
+
+    if (len < 2)
+        return 0;
+
+    unit = st_transcode_unit(in, be);
+
+    // A lead surrogate must be followed by a trail surrogate, and a lone
+    // surrogate becomes U+FFFD
+    if (unit >= 0xD800 && unit <= 0xDBFF) {
+        if (len < 4)
+            return 0;
+
+        low = st_transcode_unit(in + 2, be);
+        if (low >= 0xDC00 && low <= 0xDFFF) {
+            *o += st_transcode_utf8(0x10000 + ((unit - 0xD800) << 10)
+                    + (low - 0xDC00), out + *o);
+            return 4;
+        }
+
+        unit = 0xFFFD;
+    } else if (unit >= 0xDC00 && unit <= 0xDFFF) {
+        unit = 0xFFFD;
+    }
+
+    *o += st_transcode_utf8(unit, out + *o);
+
+    return 2;
+}
+
+static inline void st_transcode_utf16_scalar(const uint8_t *in, size_t len,
+        size_t *i, uint8_t *out, size_t out_len, size_t *o, int be)
+{
+    size_t ii = *i, oo = *o, used;
+
+    while (out_len - oo >= ST_TRANSCODE_MIN_OUT
+            && (used = st_transcode_utf16_char(in + ii, len - ii, be,
+                    out, &oo)) > 0)
+        ii += used;
+
+    *i = ii;
+    *o = oo;
+}
+
+static void st_transcode_utf16le_scalar(const st_transcoder_t *tc,
+        const uint8_t *in, size_t len, size_t *i,
+        uint8_t *out, size_t out_len, size_t *o)
+{
+    st_transcode_utf16_scalar(in, len, i, out, out_len, o, 0);
+}
+
+static void st_transcode_utf16be_scalar(const st_transcoder_t *tc,
+        const uint8_t *in, size_t len, size_t *i,
+        uint8_t *out, size_t out_len, size_t *o)
+{
+    st_transcode_utf16_scalar(in, len, i, out, out_len, o, 1);
+}
+
+#ifdef ST_TRANSCODE_X86
+
+//
+// SSE2, copies 16 bytes at a time while they are ASCII
+//
+__attribute__((target("sse2")))
+static void st_transcode_single_sse2(const st_transcoder_t *tc,
+        const uint8_t *in, size_t len, size_t *i,
+        uint8_t *out, size_t out_len, size_t *o)
+{
+    size_t ii = *i, oo = *o;
+
+    // A block takes at most three bytes of output per byte, and the last
+    // one is stored as four
+    while (len - ii >= 16 && out_len - oo >= 16 * 3 + 1) {
+        __m128i v = _mm_loadu_si128((const __m128i *)(in + ii));
+        unsigned int mask = _mm_movemask_epi8(v);
+
+        // The ASCII bytes up to the first that is not are stored as well
+        _mm_storeu_si128((__m128i *)(out + oo), v);
+
+        if (mask == 0) {
+            ii += 16;
+            oo += 16;
+            continue;
+        }
+
+        size_t n = __builtin_ctz(mask);
+        size_t end = ii + 16;
+
+        ii += n;
+        oo += n;
+
+        while (ii < end) {
+            uint8_t b = in[ii++];
+            ST_TRANSCODE_BYTE(tc, b, out, oo);
+        }
+    }
+
+    *i = ii;
+    *o = oo;
+    st_transcode_single_scalar(tc, in, len, i, out, out_len, o);
+}
+
+//
+// SSE2, converts 8 UTF-16 units at a time while they are ASCII
+//
+__attribute__((target("sse2")))
+static inline void st_transcode_utf16_sse2(const uint8_t *in, size_t len,
+        size_t *i, uint8_t *out, size_t out_len, size_t *o, int be)
+{
+    const __m128i high = _mm_set1_epi16((short)0xFF80);
+    const __m128i zero = _mm_setzero_si128();
+
+    size_t ii = *i, oo = *o;
+
+    // Eight units take at most 24 bytes, and a surrogate pair that starts
+    // in the block but ends after it takes four
+    while (len - ii >= 16 && out_len - oo >= 8 * 3 + 4) {
+        __m128i v = _mm_loadu_si128((const __m128i *)(in + ii));
+
+        if (be)
+            v = _mm_or_si128(_mm_slli_epi16(v, 8), _mm_srli_epi16(v, 8));
+
+        __m128i ascii = _mm_cmpeq_epi16(_mm_and_si128(v, high), zero);
+
+        if (_mm_movemask_epi8(ascii) == 0xFFFF) {
+            _mm_storel_epi64((__m128i *)(out + oo), _mm_packus_epi16(v, v));
+            ii += 16;
+            oo += 8;
+            continue;
+        }
+
+        size_t end = ii + 16, used;
+
+        while (ii < end && (used = st_transcode_utf16_char(in + ii, len - ii,
+                        be, out, &oo)) > 0)
+            ii += used;
+
+        if (ii < end)
+            break;
+    }
+
+    *i = ii;
+    *o = oo;
+    st_transcode_utf16_scalar(in, len, i, out, out_len, o, be);
+}
+
+__attribute__((target("sse2")))
+static void st_transcode_utf16le_sse2(const st_transcoder_t *tc,
+        const uint8_t *in, size_t len, size_t *i,
+        uint8_t *out, size_t out_len, size_t *o)
+{
+    st_transcode_utf16_sse2(in, len, i, out, out_len, o, 0);
+}
+
+__attribute__((target("sse2")))
+static void st_transcode_utf16be_sse2(const st_transcoder_t *tc,
+        const uint8_t *in, size_t len, size_t *i,
+        uint8_t *out, size_t out_len, size_t *o)
+{
+    st_transcode_utf16_sse2(in, len, i, out, out_len, o, 1);
+}
+
+#endif
+
+// Pick the kernel for an encoding and the CPU
+static st_transcode_fn st_transcode_kernel(st_encoding_t encoding)
+{
+#ifdef ST_TRANSCODE_X86
+    __builtin_cpu_init();
+
+    int sse2 = __builtin_cpu_supports("sse2");
+#endif
+
+    switch (encoding) {
+        case st_encoding_utf8:
+            return &st_transcode_copy;
+
+#ifdef ST_TRANSCODE_X86
+        case st_encoding_utf16le:
+            return sse2 ? &st_transcode_utf16le_sse2
+                : &st_transcode_utf16le_scalar;
+
+        case st_encoding_utf16be:
+            return sse2 ? &st_transcode_utf16be_sse2
+                : &st_transcode_utf16be_scalar;
+
+        default:
+            return sse2 ? &st_transcode_single_sse2
+                : &st_transcode_single_scalar;
+#else
+        case st_encoding_utf16le:
+            return &st_transcode_utf16le_scalar;
+
+        case st_encoding_utf16be:
+            return &st_transcode_utf16be_scalar;
+
+        default:
+            return &st_transcode_single_scalar;
+#endif
+    }
+}
+
+st_status st_transcoder_init(st_transcoder_t **tc, st_encoding_t encoding,
+        const st_allocator_t *allocator)
+{
+    const uint16_t *high = st_encoding_high_half(encoding);
+    st_transcoder_t *c;
+
+    if ((unsigned)encoding >= ST_ENCODING_COUNT)
+        return st_invalid_config;
+
+    allocator = st_allocator(allocator);
+
+    *tc = c = st_malloc(allocator, sizeof(*c));
+    if (c == NULL)
+        return st_out_of_memory;
+
+    memset(c, 0, sizeof(*c));
+    c->allocator = *allocator;
+    c->encoding = encoding;
+    c->kernel = st_transcode_kernel(encoding);
+
+    // Single-byte encodings are converted through a table of the UTF-8 of
+    // each byte, so that nothing is encoded while converting
+    if (high != NULL) {
+        for (size_t b = 0; b < 128; b++)
+            c->utf8[b][3] = st_transcode_utf8(high[b], c->utf8[b]);
+    }
+
+    return st_ok;
+}
+
+void st_transcoder_free(st_transcoder_t *tc)
+{
+    if (tc == NULL)
+        return;
+
+    st_free(&tc->allocator, tc);
+}
+
+st_encoding_t st_transcoder_encoding(st_transcoder_t *tc)
+{
+    return tc->encoding;
+}
+
+void st_transcoder_reset(st_transcoder_t *tc)
+{
+    tc->pending_len = 0;
+}
+
+void st_transcode(st_transcoder_t *tc, const uint8_t *in, size_t len,
+        size_t *consumed, uint8_t *out, size_t out_len, size_t *written)
+{
+    int be = (tc->encoding == st_encoding_utf16be);
+    size_t i = 0, o = 0, used;
+
+    // Complete a character that the previous input ended in the middle of,
+    // one byte at a time. Four bytes always make a character.
+    while (tc->pending_len > 0 && out_len - o >= ST_TRANSCODE_MIN_OUT) {
+        used = st_transcode_utf16_char(tc->pending, tc->pending_len, be,
+                out, &o);
+
+        if (used == 0) {
+            if (i == len)
+                break;
+            tc->pending[tc->pending_len++] = in[i++];
+            continue;
+        }
+
+        memmove(tc->pending, tc->pending + used, tc->pending_len - used);
+        tc->pending_len -= used;
+    }
+
+    if (tc->pending_len == 0 && out_len >= ST_TRANSCODE_MIN_OUT) {
+        tc->kernel(tc, in, len, &i, out, out_len, &o);
+
+        // With room left, the kernel stopped at the start of a character
+        // that the input ends in the middle of
+        if (out_len - o >= ST_TRANSCODE_MIN_OUT && i < len) {
+            memcpy(tc->pending, in + i, len - i);
+            tc->pending_len = len - i;
+            i = len;
+        }
+    }
+
+    *consumed = i;
+    *written = o;
+}
+
+void st_transcode_finish(st_transcoder_t *tc, uint8_t *out, size_t *written)
+{
+    *written = 0;
+
+    if (tc->pending_len > 0) {
+        *written = st_transcode_utf8(0xFFFD, out);
+        tc->pending_len = 0;
+    }
+}
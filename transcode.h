@@ -0,0 +1,43 @@
+#ifndef transcode_h
+#define transcode_h
+
+#include "styre.h"
+#include "alloc.h"
+#include "encoding.h"
+
+#include <stdlib.h>
+#include <stdint.h>
+
+typedef struct st_transcoder st_transcoder_t;
+
+// Fewest bytes of output a call converts into, the longest UTF-8 sequence
+#define ST_TRANSCODE_MIN_OUT 4
+
+// Create a transcoder from encoding to UTF-8, allocated from allocator, or
+// from libc when it is NULL. UTF-8 input is copied as it is.
+st_status st_transcoder_init(st_transcoder_t **tc, st_encoding_t encoding,
+        const st_allocator_t *allocator);
+
+// Free a transcoder
+void st_transcoder_free(st_transcoder_t *tc);
+
+// Get the encoding a transcoder converts from
+st_encoding_t st_transcoder_encoding(st_transcoder_t *tc);
+
+// Forget a character that was cut by the end of the input, to start on a new
+// stream
+void st_transcoder_reset(st_transcoder_t *tc);
+
+// Convert input to UTF-8. Stops when the input is used up, or when fewer than
+// ST_TRANSCODE_MIN_OUT bytes of out are left. Sets consumed to the bytes of
+// input that were used and written to the bytes of out that were filled. The
+// start of a character that is cut by the end of the input is kept, and
+// completed by the next call. Malformed input becomes U+FFFD.
+void st_transcode(st_transcoder_t *tc, const uint8_t *in, size_t len,
+        size_t *consumed, uint8_t *out, size_t out_len, size_t *written);
+
+// End the stream, a character that was cut by the end of it becomes U+FFFD.
+// Out must have room for ST_TRANSCODE_MIN_OUT bytes.
+void st_transcode_finish(st_transcoder_t *tc, uint8_t *out, size_t *written);
+
+#endif
@@ -2,76 +2,369 @@
 
 #include <stdlib.h>
 
+const uint8_t utf8_sequence_length[256] = {
+    // 00..7F
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    // 80..BF
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    // C0..DF
+    0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    // E0..EF
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    // F0..FF
+    4, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
 st_status utf8_next_codepoint(const uint8_t *in, size_t len,
         uint32_t *out, size_t *bytes)
 {
-    if (len == 0)
-        return st_eof;
+    return utf8_decode(in, len, out, bytes);
+}
+
+//
+// Validation
+//
+
+// Validate one byte at a time from the start of a sequence
+static st_status utf8_validate_scalar(const uint8_t *in, size_t len,
+        size_t *valid)
+{
+    size_t i = 0;
+
+    while (i < len) {
+        if (in[i] < 0x80) {
+            i++;
+            continue;
+        }
+
+        uint32_t codepoint;
+        size_t bytes;
+        st_status rc = utf8_next_codepoint(in + i, len - i, &codepoint, &bytes);
+
+        if (rc != st_ok) {
+            *valid = i;
+            return rc;
+        }
+
+        i += bytes;
+    }
+
+    *valid = len;
+
+    return st_ok;
+}
+
+// Find where validation can restart one byte at a time, given that all
+// sequences that start before pos have been checked but those that end at or
+// after it may not be complete. This is the start of the first sequence that
+// begins within the three bytes before pos, or pos itself.
+static size_t utf8_sequence_start(const uint8_t *in, size_t pos)
+{
+    size_t start = pos >= 3 ? pos - 3 : 0;
+
+    // Skip continuation bytes of a sequence that ends before pos
+    while (start < pos && (in[start] & 0xC0) == 0x80)
+        start++;
+
+    return start;
+}
+
+#if (defined(__x86_64__) || defined(__i386__)) && \
+    (defined(__GNUC__) || defined(__clang__))
+#define UTF8_X86
+#include <immintrin.h>
+#endif
+
+#ifdef UTF8_X86
 
-    const uint8_t first = in[0];
+//
+// Vectorized validation as described in "Validating UTF-8 In Less Than One
+// Instruction Per Byte" by John Keiser and Daniel Lemire. Every byte is
+// classified by three table lookups on the high and low nibble of the
+// previous byte and the high nibble of the byte itself, which together
+// catch every error within two-byte windows. A separate check makes sure
+// that the third and fourth byte of long sequences are continuations.
+//
 
-    // Get the next character
-    if (first <= 0x7F) {
+#define TOO_SHORT       (1 << 0)    // 11______ 0_______, 11______ 11______
+#define TOO_LONG        (1 << 1)    // 0_______ 10______
+#define OVERLONG_3      (1 << 2)    // 11100000 100_____
+#define TOO_LARGE       (1 << 3)    // 11110100 1001____ and above
+#define SURROGATE       (1 << 4)    // 11101101 101_____
+#define OVERLONG_2      (1 << 5)    // 1100000_ 10______
+#define TOO_LARGE_1000  (1 << 6)    // 11110101 1000____ and above
+#define OVERLONG_4      (1 << 6)    // 11110000 1000____
+#define TWO_CONTS       (1 << 7)    // 10______ 10______
+#define CARRY           (TOO_SHORT | TOO_LONG | TWO_CONTS)
 
-        // Single ASCII character
-        *out = first;
+#define UTF8_BYTE_1_HIGH                                                       \
+    TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG,                                    \
+    TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG,                                    \
+    TWO_CONTS, TWO_CONTS, TWO_CONTS, TWO_CONTS,                                \
+    TOO_SHORT | OVERLONG_2,                                                    \
+    TOO_SHORT,                                                                 \
+    TOO_SHORT | OVERLONG_3 | SURROGATE,                                        \
+    TOO_SHORT | TOO_LARGE | TOO_LARGE_1000 | OVERLONG_4
 
-        // Set number of bytes consumed
-        *bytes = 1;
+#define UTF8_BYTE_1_LOW                                                        \
+    CARRY | OVERLONG_3 | OVERLONG_2 | OVERLONG_4,                              \
+    CARRY | OVERLONG_2,                                                        \
+    CARRY,                                                                     \
+    CARRY,                                                                     \
+    CARRY | TOO_LARGE,                                                         \
+    CARRY | TOO_LARGE | TOO_LARGE_1000,                                        \
+    CARRY | TOO_LARGE | TOO_LARGE_1000,                                        \
+    CARRY | TOO_LARGE | TOO_LARGE_1000,                                        \
+    CARRY | TOO_LARGE | TOO_LARGE_1000,                                        \
+    CARRY | TOO_LARGE | TOO_LARGE_1000,                                        \
+    CARRY | TOO_LARGE | TOO_LARGE_1000,                                        \
+    CARRY | TOO_LARGE | TOO_LARGE_1000,                                        \
+    CARRY | TOO_LARGE | TOO_LARGE_1000,                                        \
+    CARRY | TOO_LARGE | TOO_LARGE_1000 | SURROGATE,                            \
+    CARRY | TOO_LARGE | TOO_LARGE_1000,                                        \
+    CARRY | TOO_LARGE | TOO_LARGE_1000
 
-        return st_ok;
+#define UTF8_BYTE_2_HIGH                                                       \
+    TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT,                                \
+    TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT,                                \
+    TOO_LONG | OVERLONG_2 | TWO_CONTS | OVERLONG_3 | TOO_LARGE_1000 |          \
+        OVERLONG_4,                                                            \
+    TOO_LONG | OVERLONG_2 | TWO_CONTS | OVERLONG_3 | TOO_LARGE,                \
+    TOO_LONG | OVERLONG_2 | TWO_CONTS | SURROGATE | TOO_LARGE,                 \
+    TOO_LONG | OVERLONG_2 | TWO_CONTS | SURROGATE | TOO_LARGE,                 \
+    TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT
 
-    } else if ((first & 0xE0) == 0xC0) {
+__attribute__((target("ssse3")))
+static st_status utf8_validate_ssse3(const uint8_t *in, size_t len,
+        size_t *valid)
+{
+    const __m128i byte_1_high = _mm_setr_epi8(UTF8_BYTE_1_HIGH);
+    const __m128i byte_1_low = _mm_setr_epi8(UTF8_BYTE_1_LOW);
+    const __m128i byte_2_high = _mm_setr_epi8(UTF8_BYTE_2_HIGH);
+    const __m128i nibble = _mm_set1_epi8(0x0F);
+    const __m128i zero = _mm_setzero_si128();
+
+    // Bytes that may not be the last, second to last or third to last of a
+    // block, because the sequence they start does not fit
+    const __m128i max_last = _mm_setr_epi8(
+            -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+            (char)(0xF0 - 1), (char)(0xE0 - 1), (char)(0xC0 - 1));
 
-        // Set number of bytes consumed
-        *bytes = 2;
+    __m128i prev = zero;
+    __m128i prev_incomplete = zero;
+    size_t i = 0;
 
-        // Load first byte into place
-        *out = first & 0x1F;
+    for (; i + 16 <= len; i += 16) {
+        __m128i input = _mm_loadu_si128((const __m128i *)(in + i));
 
-    } else if ((first & 0xF0) == 0xE0) {
+        // All-ASCII blocks are valid if the previous block was complete
+        if (_mm_movemask_epi8(input) == 0) {
+            if (_mm_movemask_epi8(_mm_cmpeq_epi8(prev_incomplete, zero))
+                    != 0xFFFF)
+                break;
 
-        // Set number of bytes consumed
-        *bytes = 3;
+            prev = input;
+            continue;
+        }
 
-        // Load first byte into place
-        *out = first & 0x0F;
+        // The input shifted by one, two and three bytes, with the end of the
+        // previous block shifted in
+        __m128i prev1 = _mm_alignr_epi8(input, prev, 15);
+        __m128i prev2 = _mm_alignr_epi8(input, prev, 14);
+        __m128i prev3 = _mm_alignr_epi8(input, prev, 13);
 
-    } else if ((first & 0xF8) == 0xF0) {
+        __m128i special = _mm_and_si128(
+                _mm_and_si128(
+                    _mm_shuffle_epi8(byte_1_high, _mm_and_si128(
+                            _mm_srli_epi16(prev1, 4), nibble)),
+                    _mm_shuffle_epi8(byte_1_low, _mm_and_si128(
+                            prev1, nibble))),
+                _mm_shuffle_epi8(byte_2_high, _mm_and_si128(
+                        _mm_srli_epi16(input, 4), nibble)));
 
-        // Set number of bytes consumed
-        *bytes = 4;
+        // Only 111_____ and 1111____ two and three bytes back are >= 0x80
+        __m128i must23 = _mm_or_si128(
+                _mm_subs_epu8(prev2, _mm_set1_epi8((char)(0xE0 - 0x80))),
+                _mm_subs_epu8(prev3, _mm_set1_epi8((char)(0xF0 - 0x80))));
+        __m128i must23_80 = _mm_and_si128(must23, _mm_set1_epi8((char)0x80));
 
-        // Load first byte into place
-        *out = first & 0x07;
+        __m128i error = _mm_xor_si128(must23_80, special);
+        if (_mm_movemask_epi8(_mm_cmpeq_epi8(error, zero)) != 0xFFFF)
+            break;
 
+        prev = input;
+        prev_incomplete = _mm_subs_epu8(input, max_last);
     }
 
-    // Two byte character
-    if (len < *bytes)
-        return st_eof;
+    // Finish one byte at a time, from the start of the sequence that was cut
+    // by the block boundary or that had an error
+    size_t start = utf8_sequence_start(in, i);
+    st_status rc = utf8_validate_scalar(in + start, len - start, valid);
+    *valid += start;
 
-    // Load remaining bytes
-    for (int i = 1; i < *bytes; i++) {
-        // Check that this byte is a valid UTF-8 byte
-        if ((in[i] & 0xC0) == 0x80) {
-            // Append bytes
-            *out = (*out << 6) | (in[i] & 0x3F);
-        } else {
-            // Invalid bytes reached
-            return st_utf8_invalid;
+    return rc;
+}
+
+__attribute__((target("avx2")))
+static st_status utf8_validate_avx2(const uint8_t *in, size_t len,
+        size_t *valid)
+{
+    const __m256i byte_1_high = _mm256_setr_epi8(UTF8_BYTE_1_HIGH,
+            UTF8_BYTE_1_HIGH);
+    const __m256i byte_1_low = _mm256_setr_epi8(UTF8_BYTE_1_LOW,
+            UTF8_BYTE_1_LOW);
+    const __m256i byte_2_high = _mm256_setr_epi8(UTF8_BYTE_2_HIGH,
+            UTF8_BYTE_2_HIGH);
+    const __m256i nibble = _mm256_set1_epi8(0x0F);
+
+    // Bytes that may not be the last, second to last or third to last of a
+    // block, because the sequence they start does not fit
+    const __m256i max_last = _mm256_setr_epi8(
+            -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+            -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+            (char)(0xF0 - 1), (char)(0xE0 - 1), (char)(0xC0 - 1));
+
+    __m256i prev = _mm256_setzero_si256();
+    __m256i prev_incomplete = _mm256_setzero_si256();
+    size_t i = 0;
+
+    for (; i + 32 <= len; i += 32) {
+        __m256i input = _mm256_loadu_si256((const __m256i *)(in + i));
+
+        // All-ASCII blocks are valid if the previous block was complete
+        if (_mm256_movemask_epi8(input) == 0) {
+            if (!_mm256_testz_si256(prev_incomplete, prev_incomplete))
+                break;
+
+            prev = input;
+            continue;
         }
+
+        // The input shifted by one, two and three bytes, with the end of the
+        // previous block shifted in
+        __m256i shifted = _mm256_permute2x128_si256(prev, input, 0x21);
+        __m256i prev1 = _mm256_alignr_epi8(input, shifted, 15);
+        __m256i prev2 = _mm256_alignr_epi8(input, shifted, 14);
+        __m256i prev3 = _mm256_alignr_epi8(input, shifted, 13);
+
+        __m256i special = _mm256_and_si256(
+                _mm256_and_si256(
+                    _mm256_shuffle_epi8(byte_1_high, _mm256_and_si256(
+                            _mm256_srli_epi16(prev1, 4), nibble)),
+                    _mm256_shuffle_epi8(byte_1_low, _mm256_and_si256(
+                            prev1, nibble))),
+                _mm256_shuffle_epi8(byte_2_high, _mm256_and_si256(
+                        _mm256_srli_epi16(input, 4), nibble)));
+
+        __m256i must23 = _mm256_or_si256(
+                _mm256_subs_epu8(prev2, _mm256_set1_epi8((char)(0xE0 - 0x80))),
+                _mm256_subs_epu8(prev3, _mm256_set1_epi8((char)(0xF0 - 0x80))));
+        __m256i must23_80 = _mm256_and_si256(must23,
+                _mm256_set1_epi8((char)0x80));
+
+        __m256i error = _mm256_xor_si256(must23_80, special);
+        if (!_mm256_testz_si256(error, error))
+            break;
+
+        prev = input;
+        prev_incomplete = _mm256_subs_epu8(input, max_last);
     }
 
-    // Return 1 to indicate success
-    return st_ok;
+    // Finish one byte at a time, from the start of the sequence that was cut
+    // by the block boundary or that had an error
+    size_t start = utf8_sequence_start(in, i);
+    st_status rc = utf8_validate_scalar(in + start, len - start, valid);
+    *valid += start;
+
+    return rc;
+}
+
+#endif
+
+typedef st_status (*utf8_validate_fn)(const uint8_t *in, size_t len,
+        size_t *valid);
+
+static st_status utf8_validate_resolve(const uint8_t *in, size_t len,
+        size_t *valid);
+
+static utf8_validate_fn utf8_validate_impl = &utf8_validate_resolve;
+
+// Pick the best implementation on the first call
+static st_status utf8_validate_resolve(const uint8_t *in, size_t len,
+        size_t *valid)
+{
+    utf8_validate_fn impl = &utf8_validate_scalar;
+
+#ifdef UTF8_X86
+    __builtin_cpu_init();
+
+    if (__builtin_cpu_supports("avx2"))
+        impl = &utf8_validate_avx2;
+    else if (__builtin_cpu_supports("ssse3"))
+        impl = &utf8_validate_ssse3;
+#endif
+
+    // Threads may resolve at the same time, and all store the same pointer
+    __atomic_store_n(&utf8_validate_impl, impl, __ATOMIC_RELAXED);
+
+    return impl(in, len, valid);
+}
+
+st_status utf8_validate(const uint8_t *in, size_t len, size_t *valid)
+{
+    utf8_validate_fn impl = __atomic_load_n(&utf8_validate_impl,
+            __ATOMIC_RELAXED);
+
+    return impl(in, len, valid);
+}
+
+// Encode a single codepoint into out, which must have room for 4 bytes.
+// Returns the number of bytes written, or 0 for an invalid codepoint.
+size_t utf8_encode_codepoint(uint32_t codepoint, uint8_t *out)
+{
+    if (codepoint < 0x80) {
+        out[0] = codepoint;
+        return 1;
+    } else if (codepoint < 0x800) {
+        out[0] = 192 + codepoint / 64;
+        out[1] = 128 + codepoint % 64;
+        return 2;
+    } else if ((codepoint - 0xd800u) < 0x800) {
+        return 0;
+    } else if (codepoint < 0x10000) {
+        out[0] = 224 + codepoint / 4096;
+        out[1] = 128 + codepoint / 64 % 64;
+        out[2] = 128 + codepoint % 64;
+        return 3;
+    } else if (codepoint < 0x110000) {
+        out[0] = 240 + codepoint / 262144;
+        out[1] = 128 + codepoint / 4096 % 64;
+        out[2] = 128 + codepoint / 64 % 64;
+        out[3] = 128 + codepoint % 64;
+        return 4;
+    }
+
+    return 0;
 }
 
 st_status utf8_encode_unicode(const uint32_t *in, size_t len,
-        uint8_t **out, size_t *bytes)
+        uint8_t **out, size_t *bytes, const st_allocator_t *allocator)
 {
+    allocator = st_allocator(allocator);
+
     *bytes = 0;
-    *out = malloc(len * 4);
+    *out = st_malloc(allocator, len * 4 + 1);
     if (*out == NULL)
         return st_out_of_memory;
 
@@ -98,10 +391,12 @@ st_status utf8_encode_unicode(const uint32_t *in, size_t len,
     }
 
     // Add null character at the end
-    (*out)[*bytes++] = 0;
+    (*out)[*bytes] = 0;
 
     return st_ok;
 
 error:
+    st_free(allocator, *out);
+    *out = NULL;
     return st_invalid_unicode;
 }
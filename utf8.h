@@ -5,11 +5,107 @@
 #include <stdint.h>
 
 #include "styre.h"
+#include "alloc.h"
 
+// Number of bytes in a sequence by its first byte, 0 for bytes that can not
+// start one: continuation bytes, C0, C1 and F5..FF
+extern const uint8_t utf8_sequence_length[256];
+
+// Decode the next codepoint. Returns st_eof if the input ends in the middle
+// of it, or st_utf8_invalid. Inline for callers that decode every character.
+static inline st_status utf8_decode(const uint8_t *in, size_t len,
+        uint32_t *out, size_t *bytes)
+{
+    if (len == 0)
+        return st_eof;
+
+    const uint8_t first = in[0];
+
+    // Single ASCII character
+    if (first <= 0x7F) {
+        *out = first;
+        *bytes = 1;
+
+        return st_ok;
+    }
+
+    const size_t n = utf8_sequence_length[first];
+
+    // Stray continuation byte or a byte that never occurs in UTF-8
+    if (n == 0)
+        return st_utf8_invalid;
+
+    // The range of the second byte rules out overlong forms, surrogates and
+    // codepoints above U+10FFFF
+    uint8_t lo = 0x80;
+    uint8_t hi = 0xBF;
+
+    switch (first) {
+        case 0xE0: lo = 0xA0; break;
+        case 0xED: hi = 0x9F; break;
+        case 0xF0: lo = 0x90; break;
+        case 0xF4: hi = 0x8F; break;
+    }
+
+    // Load the first byte into place
+    uint32_t codepoint = first & (0x7F >> n);
+
+    // Load remaining bytes, checking the ones we have even if the sequence is
+    // cut short so that an invalid sequence is not reported as incomplete
+    for (size_t i = 1; i < n; i++) {
+        if (i >= len)
+            return st_eof;
+
+        if (in[i] < lo || in[i] > hi)
+            return st_utf8_invalid;
+
+        codepoint = (codepoint << 6) | (in[i] & 0x3F);
+
+        lo = 0x80;
+        hi = 0xBF;
+    }
+
+    *out = codepoint;
+    *bytes = n;
+
+    return st_ok;
+}
+
+// The same as utf8_decode, for st_tokenizer_set_encoding_handler
 st_status utf8_next_codepoint(const uint8_t *in, size_t len,
         uint32_t *out, size_t *bytes);
 
+// Validate a buffer of UTF-8. Returns st_ok if it is valid, st_eof if it is
+// valid but ends with an incomplete sequence, or st_utf8_invalid. Sets valid
+// to the number of bytes before the incomplete or invalid sequence.
+st_status utf8_validate(const uint8_t *in, size_t len, size_t *valid);
+
+// Decode the next codepoint of input that is known to be valid UTF-8. Returns
+// the number of bytes it took.
+static inline size_t utf8_decode_valid(const uint8_t *in, uint32_t *out)
+{
+    if (in[0] < 0x80) {
+        *out = in[0];
+        return 1;
+    } else if (in[0] < 0xE0) {
+        *out = ((in[0] & 0x1F) << 6) | (in[1] & 0x3F);
+        return 2;
+    } else if (in[0] < 0xF0) {
+        *out = ((in[0] & 0x0F) << 12) | ((in[1] & 0x3F) << 6) |
+            (in[2] & 0x3F);
+        return 3;
+    }
+
+    *out = ((in[0] & 0x07) << 18) | ((in[1] & 0x3F) << 12) |
+        ((in[2] & 0x3F) << 6) | (in[3] & 0x3F);
+    return 4;
+}
+
+size_t utf8_encode_codepoint(uint32_t codepoint, uint8_t *out);
+
+// Encode codepoints as a new NUL-terminated UTF-8 string, allocated from
+// allocator or from libc when it is NULL
 st_status utf8_encode_unicode(const uint32_t *in, size_t len,
-        uint8_t **out, size_t *bytes);
+        uint8_t **out, size_t *bytes, const st_allocator_t *allocator);
 
 #endif